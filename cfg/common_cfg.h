@@ -51,6 +51,18 @@
 // <i> Default: 0
 #define  LIB_MEM_CFG_DBG_INFO_EN                            0
 
+// <q LIB_MEM_CFG_DYN_POOL_MAG_EN> Dynamic memory pool magazine caches
+// <i> Enables Mem_DynPoolMagCreate() and related functions, which cache free blocks of a dynamic pool
+// <i> for a single task so that most gets and frees do not enter a critical section.
+// <i> Default: 0
+#define  LIB_MEM_CFG_DYN_POOL_MAG_EN                        0
+
+// <q LIB_MEM_CFG_SLAB_EN> Slab allocator
+// <i> Enables Mem_SlabCreate() and related functions, which allocate and free blocks of variable size
+// <i> from power-of-two size classes carved from a memory segment.
+// <i> Default: 0
+#define  LIB_MEM_CFG_SLAB_EN                                0
+
 // <o LIB_MEM_CFG_HEAP_SIZE> Size of heap memory (in octets).
 // <i> Size, in octets, of the general-purpose heap memory used as default memory segment.
 // <i> Default: 9216
@@ -143,6 +143,16 @@
 // <i> Default: 1
 #define  NET_IF_CFG_WAIT_SETUP_READY_EN                     1
 
+// <o NET_TASK_CFG_RX_BUDGET> Network Task - Maximum number of received packets handled per wake-up
+// <i> Packets are handled under a single network lock hold. Set to 1 to handle one packet per wake-up.
+// <i> Default: 16
+#define  NET_TASK_CFG_RX_BUDGET                             16u
+
+// <o NET_TASK_CFG_RX_QUOTA_IF> Network Task - Maximum number of received packets handled per interface and wake-up
+// <i> Keeps a busy interface from starving the others. Must be between 1 and NET_TASK_CFG_RX_BUDGET.
+// <i> Default: 8
+#define  NET_TASK_CFG_RX_QUOTA_IF                           8u
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                NETWORK INTERFACE LAYER CONFIGURATION
@@ -155,6 +165,11 @@
 // <i> Default: 5
 #define  NET_ARP_CFG_CACHE_NBR                              5u
 
+// <o NET_CACHE_CFG_HASH_TBL_SIZE> Number of buckets of the ARP and NDP cache hash tables
+// <i> Must be a power of 2. Set to 0 to search the caches linearly and save the tables' memory.
+// <i> Default: 16
+#define  NET_CACHE_CFG_HASH_TBL_SIZE                        16u
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                           NEIGHBOR DISCOVERY PROTOCOL LAYER CONFIGURATION
@@ -306,6 +321,17 @@
 // <i> Default: 4096
 #define  NET_SOCK_CFG_TX_Q_SIZE_OCTET                       4096u
 
+// <o NET_CONN_CFG_HASH_TBL_SIZE> Sockets - Number of buckets of the connection hash table
+// <i> Must be a power of 2. Set to 0 to search the connections linearly and save the table's memory.
+// <i> Default: 32
+#define  NET_CONN_CFG_HASH_TBL_SIZE                         32u
+
+// <q NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN> Sockets - Copy datagram data without the network lock
+// <i> Releases the global network lock while UDP data is copied to or from the application.
+// <i> Use the 'net_udp_bench' shell command to compare both settings before enabling it.
+// <i> Default: 0
+#define  NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN             0
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                          TRANSMISSION CONTROL PROTOCOL LAYER CONFIGURATION
@@ -317,6 +343,16 @@
 // <i> Default: 1
 #define  NET_TCP_CFG_EN                                     1
 
+// <q NET_TCP_CFG_WIN_SCALE_EN> TCP Window Scale option (RFC 7323)
+// <i> Allows windows larger than 65535 octets. When disabled, window sizes are limited to 65535 octets.
+// <i> Default: 1
+#define  NET_TCP_CFG_WIN_SCALE_EN                           1
+
+// <q NET_TCP_CFG_CONN_RX_LOCK_EN> TCP - Per-connection receive lock
+// <i> Stream sockets receive with a per-connection lock and copy data without the global network lock.
+// <i> Default: 0
+#define  NET_TCP_CFG_CONN_RX_LOCK_EN                        0
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                              USER DATAGRAM PROTOCOL LAYER CONFIGURATION
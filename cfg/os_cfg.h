@@ -49,6 +49,30 @@
  *
  *           (8) Configure OS_CFG_STK_SIZE_MIN to set the minimum allowable Task Stack size (in CPU_STK
  *               elements).
+ *
+ *           (9) Configure OS_CFG_PEND_LIST_PRIO_TBL_EN to keep, in each kernel object, a priority bitmap
+ *               and the last waiting task of each priority. Inserting a task in a pend list is then done
+ *               in constant time instead of walking the waiting tasks, at the cost of OS_CFG_PRIO_MAX
+ *               pointers per kernel object. The 'pend_list' benchmark of 'os_bench' (see Note #10)
+ *               measures the insertion cost against the number of waiting tasks.
+ *
+ *           (10) Configure OS_CFG_BENCH_EN to add the 'os_bench' shell command, which measures the cost
+ *                of the main kernel services and outputs the results as CSV. It requires the Shell,
+ *                OS_CFG_TS_EN, OS_CFG_SEM_EN and OS_CFG_TASK_DEL_EN. The kernel commands are added to
+ *                the Shell by calling OSCmdInit() after Shell_Init().
+ *
+ *           (11) Configure OS_CFG_TICK_SLACK_EN to let tasks accept a tolerance on their delays and
+ *                timeouts (see OSTaskTickSlackSet()). When a task timer expires, the tasks whose delay
+ *                already elapsed but whose tolerance did not are woken at the same time, which saves
+ *                one timer interrupt and context switch per coalesced task.
+ *
+ *           (12) Configure OS_CFG_ISR_POST_DEFERRED_EN to defer the posts done by ISRs to semaphores,
+ *                message queues and event flags. The ISR only records the post in a ring, with interrupts
+ *                disabled for a constant and short time, and the kernel's ISR handler task performs the
+ *                post. OS_CFG_ISR_POST_DEFERRED_Q_SIZE sets the number of records of the ring. It must be
+ *                a power of 2. The ISR handler task is configured with OS_ConfigureIntQTask(), or with
+ *                OS_CFG_INT_Q_TASK_PRIO and OS_CFG_INT_Q_TASK_STK_SIZE in os_cfg_app.h when
+ *                OS_CFG_COMPAT_INIT_EN is enabled.
  ********************************************************************************************************
  *******************************************************************************************************/
 
@@ -87,6 +111,30 @@
 // <i> Default: 64
 #define  OS_CFG_STK_SIZE_MIN                                64u
 
+// <q OS_CFG_PEND_LIST_PRIO_TBL_EN> Enable constant-time pend list insertion
+// <i> Keep a priority bitmap and per-priority tail pointers in each pend list.
+// <i> Default: 0
+#define  OS_CFG_PEND_LIST_PRIO_TBL_EN                       0
+
+// <q OS_CFG_BENCH_EN> Add the kernel micro-benchmark shell command
+// <i> Add the 'os_bench' shell command measuring the cost of the kernel services.
+// <i> Default: 0
+#define  OS_CFG_BENCH_EN                                    0
+
+// <q OS_CFG_TICK_SLACK_EN> Enable wakeup coalescing
+// <i> Let tasks accept a tolerance on their delays so their wakeups can be batched.
+// <i> Default: 0
+#define  OS_CFG_TICK_SLACK_EN                               0
+
+// <q OS_CFG_ISR_POST_DEFERRED_EN> Enable deferred posts from ISRs
+// <i> Record the posts done by ISRs and perform them from the kernel's ISR handler task.
+// <i> Default: 0
+#define  OS_CFG_ISR_POST_DEFERRED_EN                        0
+
+// <o OS_CFG_ISR_POST_DEFERRED_Q_SIZE> Number of records of the deferred post ring (power of 2)
+// <i> Default: 32
+#define  OS_CFG_ISR_POST_DEFERRED_Q_SIZE                    32u
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                             EVENT FLAGS
@@ -106,6 +154,13 @@
 /********************************************************************************************************
  ********************************************************************************************************
  *                                     MUTUAL EXCLUSION SEMAPHORES
+ *
+ * Note(s) : (1) Configure OS_CFG_MUTEX_FAST_EN to acquire and release uncontended mutexes with a single
+ *               CPU_CmpSwap() on the mutex instead of a critical section. The owner's mutex group,
+ *               nesting counter and priority inheritance are only set up when another task, or the
+ *               owner itself, needs them; OSMutexPend() and OSMutexPost() then take the usual path.
+ *               It requires OS_CFG_DBG_EN so that mutexes held through the fast path can be found and
+ *               released when their owner is deleted.
  *********************************************************************************************************
  ********************************************************************************************************/
 
@@ -114,9 +169,18 @@
 // <i> Default: 1
 #define  OS_CFG_MUTEX_EN                                    1
 
+// <q OS_CFG_MUTEX_FAST_EN> Enable fast path for uncontended mutexes
+// <i> Acquire and release uncontended mutexes with a compare-and-swap instead of a critical section.
+// <i> Default: 0
+#define  OS_CFG_MUTEX_FAST_EN                               0
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                            MESSAGE QUEUES
+ *
+ * Note(s) : (1) Configure OS_CFG_Q_RING_EN to allow message queues to be created with OSQCreateRing().
+ *               Such a queue stores its messages in a power-of-two ring of slots supplied by the
+ *               application instead of taking OS_MSGs from the kernel's global message pool.
  *********************************************************************************************************
  ********************************************************************************************************/
 
@@ -125,6 +189,11 @@
 // <i> Default: 1
 #define  OS_CFG_Q_EN                                        1
 
+// <q OS_CFG_Q_RING_EN> Enable message queue rings
+// <i> Allow message queues to be created with OSQCreateRing() on their own ring of message slots.
+// <i> Default: 0
+#define  OS_CFG_Q_RING_EN                                   0
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                              SEMAPHORES
@@ -166,6 +235,23 @@
  *
  *           (7) Configure OS_CFG_TASK_STK_REDZONE_DEPTH to set the depth of the Redzone Stack
  *               Protection.
+ *
+ *           (8) Configure OS_CFG_TASK_PROFILE_HIST_EN to keep, per task, log2 histograms of the run slice
+ *               lengths, of the latency from ready to running and of the time spent blocked per kernel
+ *               object type. It requires OS_CFG_TASK_PROFILE_EN.
+ *
+ *           (9) Configure OS_CFG_TASK_PROFILE_HIST_SIZE to set the number of bins of each histogram, and
+ *               OS_CFG_TASK_PROFILE_HIST_SHIFT to set the log2 of the upper bound of the first bin, in
+ *               timestamp counts. Each following bin doubles the bound; the last bin also counts the
+ *               longer durations. The bound of the last but one bin must fit in 32 bits, so the shift
+ *               plus the number of bins, minus 2, must not exceed 31.
+ *
+ *           (10) Configure OS_CFG_TASK_STK_CHK_INCR_EN to make OSTaskStkChk() incremental. Instead of
+ *                counting all the free entries of the stack, it remembers the watermark of each task and
+ *                only checks the entries just below it, plus a window of OS_CFG_TASK_STK_CHK_INCR_WIN
+ *                free entries swept a little further at each call. A stack overflowing through an
+ *                unwritten area (e.g. a large uninitialized local array) is thus detected after a few
+ *                calls instead of immediately. It requires OS_CFG_STAT_TASK_STK_CHK_EN.
  *********************************************************************************************************
  ********************************************************************************************************/
 
@@ -197,6 +283,28 @@
 // <i> Default: 8
 #define  OS_CFG_TASK_STK_REDZONE_DEPTH                      8
 
+// <q OS_CFG_TASK_PROFILE_HIST_EN> Enable task profiling histograms
+// <i> Keep per-task histograms of run slices, ready latency and blocking time.
+// <i> Default: 0
+#define  OS_CFG_TASK_PROFILE_HIST_EN                        0
+
+// <o OS_CFG_TASK_PROFILE_HIST_SIZE> Number of bins of the task profiling histograms
+// <i> Default: 16
+#define  OS_CFG_TASK_PROFILE_HIST_SIZE                      16u
+
+// <o OS_CFG_TASK_PROFILE_HIST_SHIFT> Log2 of the upper bound of the first histogram bin (in timestamp counts)
+// <i> Default: 6
+#define  OS_CFG_TASK_PROFILE_HIST_SHIFT                     6u
+
+// <q OS_CFG_TASK_STK_CHK_INCR_EN> Enable incremental stack checking
+// <i> Track the stack watermark of each task instead of scanning the whole free area.
+// <i> Default: 0
+#define  OS_CFG_TASK_STK_CHK_INCR_EN                        0
+
+// <o OS_CFG_TASK_STK_CHK_INCR_WIN> Number of free stack entries swept per incremental check
+// <i> Default: 32
+#define  OS_CFG_TASK_STK_CHK_INCR_WIN                       32u
+
 /*********************************************************************************************************
  *********************************************************************************************************
  *                                    TASK LOCAL STORAGE MANAGEMENT
@@ -210,6 +318,14 @@
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           TIMER MANAGEMENT
+ *
+ * Note(s) : (1) Configure OS_CFG_TMR_WHEEL_EN to select the hashed timer wheel instead of the single
+ *               timer list. With the wheel, starting and stopping a timer are constant-time operations
+ *               and the timer task only visits the timers hashed in the spoke of the current tick.
+ *
+ *           (2) Configure OS_CFG_TMR_WHEEL_SIZE to set the number of spokes of the timer wheel. It must
+ *               be a power of 2. Timers whose delay or period is larger than the number of spokes are
+ *               visited once per wheel revolution until they expire.
  *********************************************************************************************************
  ********************************************************************************************************/
 
@@ -217,9 +333,25 @@
 // <i> Default: 1
 #define  OS_CFG_TMR_EN                                      1
 
+// <q OS_CFG_TMR_WHEEL_EN> Use the hashed timer wheel
+// <i> Default: 0
+#define  OS_CFG_TMR_WHEEL_EN                                0
+
+// <o OS_CFG_TMR_WHEEL_SIZE> Number of spokes of the timer wheel (power of 2)
+// <i> Default: 64
+#define  OS_CFG_TMR_WHEEL_SIZE                              64u
+
 /*********************************************************************************************************
  *********************************************************************************************************
  *                                           TRACE RECORDERS
+ *
+ * Note(s) : (1) Configure OS_CFG_TRACE_RING_EN to record the kernel events in the built-in binary trace
+ *               ring instead of forwarding them to the trace recorder declared in os_trace_events.h.
+ *               OS_CFG_TRACE_EN must also be enabled. 'kernel/source/OSTraceRingDecode.py' converts a
+ *               dump of the records to the Chrome trace format, which can be opened by Perfetto.
+ *
+ *           (2) Configure OS_CFG_TRACE_RING_SIZE to set the number of records of the trace ring. It must
+ *               be a power of 2. When the ring is full, the oldest records are overwritten.
  *********************************************************************************************************
  ********************************************************************************************************/
 
@@ -227,6 +359,14 @@
 // <i> Default: DEF_DISABLED
 #define  OS_CFG_TRACE_EN                                    DEF_DISABLED
 
+// <q OS_CFG_TRACE_RING_EN> Use the built-in binary trace ring recorder
+// <i> Default: DEF_DISABLED
+#define  OS_CFG_TRACE_RING_EN                               DEF_DISABLED
+
+// <o OS_CFG_TRACE_RING_SIZE> Number of records of the trace ring (power of 2)
+// <i> Default: 512
+#define  OS_CFG_TRACE_RING_SIZE                             512u
+
 /*********************************************************************************************************
  *********************************************************************************************************
  *                                             MODULE END
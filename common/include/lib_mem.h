@@ -81,6 +81,14 @@
 #define  LIB_MEM_CFG_DBG_INFO_EN                DEF_DISABLED
 #endif
 
+#ifndef  LIB_MEM_CFG_DYN_POOL_MAG_EN
+#define  LIB_MEM_CFG_DYN_POOL_MAG_EN            DEF_DISABLED
+#endif
+
+#ifndef  LIB_MEM_CFG_SLAB_EN
+#define  LIB_MEM_CFG_SLAB_EN                    DEF_DISABLED
+#endif
+
 #ifndef  LIB_MEM_CFG_HEAP_PADDING_ALIGN
 #define  LIB_MEM_CFG_HEAP_PADDING_ALIGN         LIB_MEM_PADDING_ALIGN_NONE
 #endif
@@ -289,6 +297,97 @@ struct mem_dyn_pool {                                           // -------------
 #endif
 };
 
+/*
+ ********************************************************************************************************
+ *                                   DYNAMIC MEMORY POOL MAGAZINE DATA TYPE
+ *
+ * Note(s) : (1) A magazine is a small stack of free blocks of a dynamic memory pool, cached for a single
+ *               owner (typically a task). Getting and freeing blocks through a magazine only touches the
+ *               magazine, without any critical section, as long as it does not run empty or full. The
+ *               magazine then gets or returns half of its capacity from/to the pool at once.
+ *
+ *           (2) A magazine MUST only be used by its owner. It is NOT protected against concurrent
+ *               accesses.
+ *
+ *           (3) Blocks cached in a magazine are counted as allocated from the pool.
+ *
+ *           (4) A magazine MUST be deleted with Mem_DynPoolMagDel() before its data goes out of scope or
+ *               is freed.
+ *******************************************************************************************************/
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+typedef struct mem_dyn_pool_mag MEM_DYN_POOL_MAG;
+
+struct mem_dyn_pool_mag {                                       // ------------- DYN MEM POOL MAGAZINE DATA -------------
+  MEM_DYN_POOL     *PoolPtr;                                    // Ptr to pool from which blks are cached.
+  void             **BlkTbl;                                    // Tbl of cached blks.
+  CPU_SIZE_T       BlkNbrMax;                                   // Max nbr of blks in magazine.
+  CPU_SIZE_T       BlkNbr;                                      // Cur nbr of blks in magazine.
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  const CPU_CHAR   *NamePtr;                                    // Ptr to magazine name.
+  CPU_INT32U       HitCtr;                                      // Nbr of gets/frees served by the magazine alone.
+  CPU_INT32U       RefillCtr;                                   // Nbr of refills from the pool.
+  CPU_INT32U       DrainCtr;                                    // Nbr of drains to the pool.
+  CPU_SIZE_T       BlkNbrPeak;                                  // Peak nbr of blks in magazine.
+  MEM_DYN_POOL_MAG *NextPtr;                                    // Ptr to next magazine in list.
+#endif
+};
+#endif
+
+/*
+ ********************************************************************************************************
+ *                                       SLAB ALLOCATOR DATA TYPES
+ *
+ * Note(s) : (1) A slab allocator serves blocks of variable size from power-of-two size classes, from
+ *               'BlkSizeMin' to 'BlkSizeMax' octets. Each class has a free list of blocks carved from slabs
+ *               of 'SlabSize' octets, which are allocated from the memory segment as needed.
+ *
+ *           (2) Slabs are aligned on their size and start with a pointer to their class, so that a block
+ *               can be freed without knowing its size. Blocks are aligned on their size or on
+ *               sizeof(CPU_ALIGN), whichever is smaller.
+ *               @verbatim
+ *                   +-----------+-------+-------+-----+-------+--------+
+ *                   | Class ptr | Blk 0 | Blk 1 | ... | Blk n | Unused |
+ *                   +-----------+-------+-------+-----+-------+--------+
+ *                   ^
+ *                   Aligned on 'SlabSize'
+ *               @endverbatim
+ *
+ *           (3) Memory segments cannot be freed, so a slab is never returned to its segment nor given to
+ *               another class. Mem_OutputUsage() reports the free blocks held by each class.
+ *******************************************************************************************************/
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+typedef struct mem_slab MEM_SLAB;
+
+typedef struct mem_slab_class {                                 // ----------------- SLAB SIZE CLASS ------------------
+  void       *BlkFreePtr;                                       // Ptr to first free blk.
+  CPU_SIZE_T BlkSize;                                           // Size of class blks, in octets.
+  CPU_SIZE_T SlabCnt;                                           // Nbr of slabs carved for class.
+  CPU_SIZE_T BlkAllocCnt;                                       // Nbr of blks in use.
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  CPU_SIZE_T BlkAllocPeak;                                      // Peak nbr of blks in use.
+  CPU_INT32U AllocCtr;                                          // Nbr of allocs counted in AllocWasteTot.
+  CPU_INT32U AllocWasteTot;                                     // Octets lost to rounding up, over counted allocs.
+#endif
+} MEM_SLAB_CLASS;
+
+struct mem_slab {                                               // ------------------ SLAB ALLOCATOR ------------------
+  MEM_SEG        *SegPtr;                                       // Seg from which slabs are alloc'd.
+  MEM_SLAB_CLASS *ClassTbl;                                     // Tbl of size classes, smallest first.
+  CPU_INT08U     ClassQty;                                      // Nbr of size classes.
+  CPU_INT08U     BlkSizeMinLog2;                                // Log2 of smallest class blk size.
+  CPU_SIZE_T     SlabSize;                                      // Size of slabs, in octets.
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  const CPU_CHAR *NamePtr;                                      // Ptr to slab allocator name.
+  MEM_SLAB       *NextPtr;                                      // Ptr to next slab allocator in list.
+#endif
+};
+#endif
+
 /*
  ********************************************************************************************************
  *                                   DYNAMIC MEMORY POOL INFORMATION
@@ -1187,6 +1286,51 @@ CPU_SIZE_T Mem_DynPoolBlkNbrAvailGet(MEM_DYN_POOL      *p_pool,
                                      MEM_DYN_POOL_INFO *p_pool_info,
                                      RTOS_ERR          *p_err);
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+//                                                                 ----------- DYNAMIC MEM POOL MAGAZINE FNCTS -----------
+void Mem_DynPoolMagCreate(const CPU_CHAR   *p_name,
+                          MEM_DYN_POOL_MAG *p_mag,
+                          MEM_DYN_POOL     *p_pool,
+                          MEM_SEG          *p_seg,
+                          CPU_SIZE_T       blk_nbr_max,
+                          RTOS_ERR         *p_err);
+
+void *Mem_DynPoolMagBlkGet(MEM_DYN_POOL_MAG *p_mag,
+                           RTOS_ERR         *p_err);
+
+void Mem_DynPoolMagBlkFree(MEM_DYN_POOL_MAG *p_mag,
+                           void             *p_blk,
+                           RTOS_ERR         *p_err);
+
+void Mem_DynPoolMagFlush(MEM_DYN_POOL_MAG *p_mag,
+                         RTOS_ERR         *p_err);
+
+void Mem_DynPoolMagDel(MEM_DYN_POOL_MAG *p_mag,
+                       RTOS_ERR         *p_err);
+#endif
+
+/********************************************************************************************************
+ *                                       SLAB ALLOCATOR API FNCTS
+ *******************************************************************************************************/
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+void Mem_SlabCreate(const CPU_CHAR *p_name,
+                    MEM_SLAB       *p_slab,
+                    MEM_SEG        *p_seg,
+                    CPU_SIZE_T     blk_size_min,
+                    CPU_SIZE_T     blk_size_max,
+                    CPU_SIZE_T     slab_size,
+                    RTOS_ERR       *p_err);
+
+void *Mem_SlabAlloc(MEM_SLAB   *p_slab,
+                    CPU_SIZE_T size,
+                    RTOS_ERR   *p_err);
+
+void Mem_SlabFree(MEM_SLAB *p_slab,
+                  void     *p_blk,
+                  RTOS_ERR *p_err);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
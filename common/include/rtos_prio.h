@@ -43,6 +43,10 @@
  *******************************************************************************************************/
 
 //                                                                 ------------- VERY HIGH PRIORITY TASKS -------------
+#ifndef  KERNEL_INT_Q_TASK_PRIO_DFLT
+#define  KERNEL_INT_Q_TASK_PRIO_DFLT                           3u
+#endif
+
 #ifndef  KERNEL_TICK_TASK_PRIO_DFLT
 #define  KERNEL_TICK_TASK_PRIO_DFLT                            4u
 #endif
@@ -63,6 +63,18 @@
 
 #define  CLK_INITIAL_TZ_SEC_DFLT                    CLK_TZ_SEC_FROM_UTC_GET(0u)
 
+/********************************************************************************************************
+ *                                           CLK DAY COUNT DEFINES
+ *
+ * Note(s) : (1) CLK_LEAP_DAYS_BEFORE_YR() returns the number of leap days between year 1 and the start of
+ *               year 'yr', so that the number of days between the start of two years is found without
+ *               iterating over the years in between.
+ *******************************************************************************************************/
+
+#define  CLK_LEAP_DAYS_BEFORE_YR(yr)              ((((CLK_NBR_DAYS)(yr) - 1u) /   4u) \
+                                                   - (((CLK_NBR_DAYS)(yr) - 1u) / 100u) \
+                                                   + (((CLK_NBR_DAYS)(yr) - 1u) / 400u))
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           LOCAL DATA TYPES
@@ -111,6 +123,12 @@ static const CLK_DAY Clk_DaysInMonth[2u][CLK_MONTH_PER_YR] = {
   { 31u, 29u, 31u, 30u, 31u, 30u, 31u, 31u, 30u, 31u, 30u, 31u }
 };
 
+static const CLK_DAY Clk_DaysBeforeMonth[2u][CLK_MONTH_PER_YR + 1u] = {
+  //Jan Feb  Mar  Apr   May   Jun   Jul   Aug   Sep   Oct   Nov   Dec   (end)
+  { 0u, 31u, 59u, 90u, 120u, 151u, 181u, 212u, 243u, 273u, 304u, 334u, 365u },
+  { 0u, 31u, 60u, 91u, 121u, 152u, 182u, 213u, 244u, 274u, 305u, 335u, 366u }
+};
+
 /********************************************************************************************************
  *                                           CLK STR CONV TBLS
  *******************************************************************************************************/
@@ -164,24 +182,24 @@ extern const CLK_INIT_CFG Clk_InitCfg;
 /********************************************************************************************************
  *                                               CLK CACHE DATA
  ********************************************************************************************************
- * Note(s) : (1) Since global performance can be affected by the calculation of the days of week some
- *               caches have been implemented:
+ * Note(s) : (1) Most conversions of a timestamp to a date/time fall on the same local day as the previous
+ *               one. Clk_TS_ToDateTimeHandler() therefore caches the date of the last day it converted:
  *
- *               (a) Clk_CacheMonth store the last month requested.
+ *               (a) Clk_CacheDayYrStart stores the start year of the epoch of the cached day.
  *
- *               (b) Clk_CacheMonthDays store the last number of days calculated for the month stored in
- *                   Clk_CacheMonth.
+ *               (b) Clk_CacheDayTS stores the local timestamp of the start of the cached day, in seconds
+ *                   since the start of the epoch.
  *
- *               (c) Clk_CacheYr store the last year requested.
+ *               (c) Clk_CacheDayDateTime stores the date fields ('Yr', 'Month', 'Day', 'DayOfWk' and
+ *                   'DayOfYr') of the cached day.
  *
- *               (d) Clk_CacheYrDays store the last number of days calculated for the year stored in
- *                   Clk_CacheYr.
+ *           (2) The Clock task refreshes the cache every second, so that callers of Clk_GetDateTime()
+ *               do not pay for the conversion when a new day starts.
  *******************************************************************************************************/
 
-static CLK_MONTH    Clk_CacheMonth;                             // See Note #1a.
-static CLK_DAY      Clk_CacheMonthDays;                         // See Note #1b.
-static CLK_YR       Clk_CacheYr;                                // See Note #1c.
-static CLK_NBR_DAYS Clk_CacheYrDays;                            // See Note #1d.
+static CLK_YR        Clk_CacheDayYrStart;                       // See Note #1a.
+static CLK_TS_SEC    Clk_CacheDayTS;                            // See Note #1b.
+static CLK_DATE_TIME Clk_CacheDayDateTime;                      // See Note #1c.
 
 /********************************************************************************************************
  ********************************************************************************************************
@@ -216,6 +234,9 @@ static CLK_DAY Clk_GetDayOfYrHandler(CLK_YR    yr,
                                      CLK_MONTH month,
                                      CLK_DAY   day);
 
+static CLK_NBR_DAYS Clk_GetDaysBeforeYrHandler(CLK_YR yr,
+                                               CLK_YR yr_start);
+
 static CLK_DAY Clk_GetDayOfWkHandler(CLK_YR    yr,
                                      CLK_MONTH month,
                                      CLK_DAY   day);
@@ -369,10 +390,7 @@ void Clk_Init(RTOS_ERR *p_err)
 #endif
 #endif
   Clk_Ptr->Clk_TZ_sec = CLK_INITIAL_TZ_SEC_DFLT;                // Clk TZ = UTC offset
-  Clk_CacheMonth = CLK_MONTH_NONE;
-  Clk_CacheMonthDays = CLK_DAY_NONE;
-  Clk_CacheYr = CLK_YR_NONE;
-  Clk_CacheYrDays = CLK_DAY_NONE;
+  Clk_CacheDayYrStart = CLK_YR_NONE;
 
 #if ((CLK_CFG_EXT_EN == DEF_DISABLED) \
   && (CLK_CFG_SIGNAL_EN == DEF_DISABLED))                       // ------------------- CLK/OS INIT --------------------
@@ -2606,33 +2624,15 @@ static CLK_DAY Clk_GetDayOfYrHandler(CLK_YR    yr,
 {
   CPU_BOOLEAN leap_yr;
   CPU_INT08U  leap_yr_ix;
-  CLK_MONTH   month_ix;
   CLK_DAY     day_of_yr;
-  CLK_DAY     days_month;
-  CLK_DAY     days_in_month;
-  CORE_DECLARE_IRQ_STATE;
 
   LOG_VRB(("Day of year of ", (u)day, ", ", (u)month, ", ", (u)yr, " = "));
 
-  day_of_yr = day - CLK_FIRST_DAY_OF_MONTH;
   leap_yr = Clk_IsLeapYr(yr);
   leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
 
-  CORE_ENTER_ATOMIC();
-  if ((Clk_CacheYr != yr)
-      || (Clk_CacheMonth != month)) {                           // See if cached val could be used.
-    CORE_EXIT_ATOMIC();
-    days_month = 0u;
-    for (month_ix = CLK_FIRST_MONTH_OF_YR; month_ix < month; month_ix++) {
-      days_in_month = Clk_DaysInMonth[leap_yr_ix][month_ix - CLK_FIRST_MONTH_OF_YR];
-      days_month += days_in_month;
-    }
-  } else {
-    days_month = Clk_CacheMonthDays;
-    CORE_EXIT_ATOMIC();
-  }
-
-  day_of_yr += days_month;
+  day_of_yr = day - CLK_FIRST_DAY_OF_MONTH;
+  day_of_yr += Clk_DaysBeforeMonth[leap_yr_ix][month - CLK_FIRST_MONTH_OF_YR];
   day_of_yr += CLK_FIRST_DAY_OF_YR;
   LOG_VRB(("Day of year = ", (u)day_of_yr));
 
@@ -2674,60 +2674,17 @@ static CLK_DAY Clk_GetDayOfWkHandler(CLK_YR    yr,
 {
   CPU_BOOLEAN  leap_yr;
   CPU_INT08U   leap_yr_ix;
-  CLK_YR       yr_ix;
-  CLK_MONTH    month_ix;
   CLK_DAY      day_of_wk;
-  CLK_DAY      days_in_month;
-  CLK_DAY      days_month;
-  CLK_NBR_DAYS days_yr;
   CLK_NBR_DAYS days;
-  CORE_DECLARE_IRQ_STATE;
 
   LOG_VRB(("Day of week of ", (u)day, ", ", (u)month, ", ", (u)yr));
 
-  days = day - CLK_FIRST_DAY_OF_MONTH;
   leap_yr = Clk_IsLeapYr(yr);
   leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
 
-  CORE_ENTER_ATOMIC();
-  if ((Clk_CacheYr != yr)
-      || (Clk_CacheMonth != month)) {                           // See if cached val could be used.
-    CORE_EXIT_ATOMIC();
-
-    days_month = 0u;
-    for (month_ix = CLK_FIRST_MONTH_OF_YR; month_ix < month; month_ix++) {
-      days_in_month = Clk_DaysInMonth[leap_yr_ix][month_ix - CLK_FIRST_MONTH_OF_YR];
-      days_month += days_in_month;
-    }
-
-    CORE_ENTER_ATOMIC();
-    Clk_CacheMonth = month;
-    Clk_CacheMonthDays = days_month;
-  } else {
-    days_month = Clk_CacheMonthDays;
-  }
-
-  if (Clk_CacheYr != yr) {
-    CORE_EXIT_ATOMIC();
-
-    days_yr = 0u;
-    for (yr_ix = CLK_NTP_EPOCH_YR_START; yr_ix < yr; yr_ix++) {
-      leap_yr = Clk_IsLeapYr(yr_ix);
-      leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
-      days_yr += Clk_DaysInYr[leap_yr_ix];
-    }
-
-    CORE_ENTER_ATOMIC();
-    Clk_CacheYr = yr;
-    Clk_CacheYrDays = days_yr;
-    CORE_EXIT_ATOMIC();
-  } else {
-    days_yr = Clk_CacheYrDays;
-    CORE_EXIT_ATOMIC();
-  }
-
-  days += days_month;
-  days += days_yr;
+  days = day - CLK_FIRST_DAY_OF_MONTH;
+  days += Clk_DaysBeforeMonth[leap_yr_ix][month - CLK_FIRST_MONTH_OF_YR];
+  days += Clk_GetDaysBeforeYrHandler(yr, CLK_NTP_EPOCH_YR_START);
   days += CLK_NTP_EPOCH_DAY_OF_WK;                              // See Note #1b.
   days -= CLK_FIRST_DAY_OF_WK;
   day_of_wk = days % DEF_TIME_NBR_DAY_PER_WK;
@@ -2737,6 +2694,30 @@ static CLK_DAY Clk_GetDayOfWkHandler(CLK_YR    yr,
   return (day_of_wk);
 }
 
+/****************************************************************************************************//**
+ *                                       Clk_GetDaysBeforeYrHandler()
+ *
+ * @brief    Gets the number of days between the start of the epoch and the start of a year.
+ *
+ * @param    yr          Year value [yr_start to 2136].
+ *
+ * @param    yr_start    Start year of the epoch.
+ *
+ * @return   Number of days from 'yr_start'-01-01 to 'yr'-01-01.
+ *
+ * @note     (1) See 'CLK DAY COUNT DEFINES Note #1'.
+ *******************************************************************************************************/
+static CLK_NBR_DAYS Clk_GetDaysBeforeYrHandler(CLK_YR yr,
+                                               CLK_YR yr_start)
+{
+  CLK_NBR_DAYS days;
+
+  days = (CLK_NBR_DAYS)(yr - yr_start) * DEF_TIME_NBR_DAY_PER_YR;
+  days += CLK_LEAP_DAYS_BEFORE_YR(yr) - CLK_LEAP_DAYS_BEFORE_YR(yr_start);
+
+  return (days);
+}
+
 /****************************************************************************************************//**
  *                                           Clk_SetTZ_Handler()
  *
@@ -2794,6 +2775,16 @@ static void Clk_SetTZ_Handler(CLK_TZ_SEC tz_sec)
  *
  * @note     (2) Absolute value of the time zone offset is stored into 'CLK_TS_SEC' data type to be
  *               compliant with unsigned integer verification/operations.
+ *
+ * @note     (3) When the local timestamp falls on the cached day, only the time of day is computed (see
+ *               'CLK CACHE DATA Note #1').
+ *
+ * @note     (4) Dividing the number of days by the length of a leap year gives a year that is at most one
+ *               year early over the span of an epoch, which is then corrected.
+ *
+ * @note     (5) Months are at most 31 days long and month index 'ix' never starts before day of year
+ *               32 * (ix - 1). Dividing the zero-based day of year by 32 thus gives the month index or
+ *               the one before it.
  *******************************************************************************************************/
 static CPU_BOOLEAN Clk_TS_ToDateTimeHandler(CLK_TS_SEC    ts_sec,
                                             CLK_TZ_SEC    tz_sec,
@@ -2803,12 +2794,15 @@ static CPU_BOOLEAN Clk_TS_ToDateTimeHandler(CLK_TS_SEC    ts_sec,
 {
   CLK_TS_SEC   ts_sec_rem;
   CLK_TS_SEC   tz_sec_abs;                                      // See Note #2.
+  CLK_TS_SEC   ts_day_start;
   CLK_TS_SEC   sec_to_remove;
-  CLK_NBR_DAYS days_in_yr;
-  CLK_DAY      days_in_month;
+  CLK_NBR_DAYS days;
+  CLK_YR       yr;
+  CLK_MONTH    month_ix;
   CPU_INT08U   leap_yr_ix;
   CPU_BOOLEAN  leap_yr;
   CPU_BOOLEAN  valid;
+  CORE_DECLARE_IRQ_STATE;
 
   RTOS_ASSERT_DBG((p_date_time != DEF_NULL), RTOS_ERR_NULL_PTR, DEF_FAIL);
 
@@ -2829,75 +2823,60 @@ static CPU_BOOLEAN Clk_TS_ToDateTimeHandler(CLK_TS_SEC    ts_sec,
     }
   }
 
-  //                                                               ---------------------- GET YR ----------------------
-  p_date_time->Yr = yr_start;
-  leap_yr = Clk_IsLeapYr(p_date_time->Yr);
-  leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
-  days_in_yr = Clk_DaysInYr[leap_yr_ix];
-  sec_to_remove = days_in_yr * DEF_TIME_NBR_SEC_PER_DAY;
-  while ((ts_sec_rem >= sec_to_remove)
-         && (p_date_time->Yr < yr_end)) {
-    ts_sec_rem -= sec_to_remove;
-    p_date_time->Yr++;
-    leap_yr = Clk_IsLeapYr(p_date_time->Yr);
-    leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
-    days_in_yr = Clk_DaysInYr[leap_yr_ix];
-    sec_to_remove = days_in_yr * DEF_TIME_NBR_SEC_PER_DAY;
-  }
-
-  if (p_date_time->Yr >= yr_end) {
-    LOG_ERR(("TS_ToDateTime: Year conversion has failed."));
-    return (DEF_FAIL);
-  }
-
-  //                                                               -------------------- GET MONTH ---------------------
-  p_date_time->Month = CLK_FIRST_MONTH_OF_YR;
-  days_in_month = Clk_DaysInMonth[leap_yr_ix][p_date_time->Month - CLK_FIRST_MONTH_OF_YR];
-  sec_to_remove = days_in_month * DEF_TIME_NBR_SEC_PER_DAY;
-  while ((ts_sec_rem >= sec_to_remove)
-         && (p_date_time->Month < CLK_MONTH_PER_YR)) {
-    ts_sec_rem -= sec_to_remove;
-    p_date_time->Month++;
-    days_in_month = Clk_DaysInMonth[leap_yr_ix][p_date_time->Month - CLK_FIRST_MONTH_OF_YR];
-    sec_to_remove = days_in_month * DEF_TIME_NBR_SEC_PER_DAY;
-  }
-
-  if (p_date_time->Month > CLK_MONTH_PER_YR) {
-    LOG_ERR(("TS_ToDateTime: Month conversion has failed."));
-    return (DEF_FAIL);
-  }
+  //                                                               ------------------ GET CACHED DAY ------------------
+  CORE_ENTER_ATOMIC();
+  if ((Clk_CacheDayYrStart == yr_start)                         // See Note #3.
+      && (ts_sec_rem >= Clk_CacheDayTS)
+      && ((ts_sec_rem - Clk_CacheDayTS) < DEF_TIME_NBR_SEC_PER_DAY)) {
+    p_date_time->Yr = Clk_CacheDayDateTime.Yr;
+    p_date_time->Month = Clk_CacheDayDateTime.Month;
+    p_date_time->Day = Clk_CacheDayDateTime.Day;
+    p_date_time->DayOfWk = Clk_CacheDayDateTime.DayOfWk;
+    p_date_time->DayOfYr = Clk_CacheDayDateTime.DayOfYr;
+    ts_sec_rem -= Clk_CacheDayTS;
+    CORE_EXIT_ATOMIC();
+  } else {
+    CORE_EXIT_ATOMIC();
 
-  //                                                               --------------------- GET DAY ----------------------
-  sec_to_remove = DEF_TIME_NBR_SEC_PER_DAY;
-  p_date_time->Day = (CLK_DAY)(ts_sec_rem / sec_to_remove);
-  p_date_time->Day += CLK_FIRST_DAY_OF_MONTH;
-  ts_sec_rem = ts_sec_rem % sec_to_remove;
+    days = ts_sec_rem / DEF_TIME_NBR_SEC_PER_DAY;
+    ts_day_start = days * DEF_TIME_NBR_SEC_PER_DAY;
+    ts_sec_rem -= ts_day_start;
 
-  if (p_date_time->Day > days_in_month) {
-    LOG_ERR(("TS_ToDateTime: Day conversion has failed."));
-    return (DEF_FAIL);
-  }
+    //                                                             ---------------------- GET YR ----------------------
+    yr = yr_start + (CLK_YR)(days / DEF_TIME_NBR_DAY_PER_YR_LEAP);  // See Note #4.
+    while ((yr < yr_end)
+           && (Clk_GetDaysBeforeYrHandler(yr + 1u, yr_start) <= days)) {
+      yr++;
+    }
 
-  //                                                               ------------------ GET DAY OF WK -------------------
-  p_date_time->DayOfWk = Clk_GetDayOfWkHandler(p_date_time->Yr,
-                                               p_date_time->Month,
-                                               p_date_time->Day);
-  valid = Clk_IsDayOfWkValid(p_date_time->DayOfWk);
+    if (yr >= yr_end) {
+      LOG_ERR(("TS_ToDateTime: Year conversion has failed."));
+      return (DEF_FAIL);
+    }
 
-  if ((p_date_time->Day > days_in_month)
-      || (valid == DEF_NO)) {
-    LOG_ERR(("TS_ToDateTime: Day conversion has failed."));
-    return (DEF_FAIL);
-  }
+    //                                                             -------------------- GET MONTH ---------------------
+    days -= Clk_GetDaysBeforeYrHandler(yr, yr_start);
+    leap_yr = Clk_IsLeapYr(yr);
+    leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
+    month_ix = (CLK_MONTH)(days / 32u);                         // See Note #5.
+    if (days >= Clk_DaysBeforeMonth[leap_yr_ix][month_ix + 1u]) {
+      month_ix++;
+    }
 
-  p_date_time->DayOfYr = Clk_GetDayOfYrHandler(p_date_time->Yr,
-                                               p_date_time->Month,
-                                               p_date_time->Day);
-  valid = Clk_IsDayOfYrValid(p_date_time->Yr,
-                             p_date_time->DayOfYr);
-  if (valid != DEF_OK) {
-    LOG_ERR(("TS_ToDateTime: Day of year conversion has failed."));
-    return (DEF_FAIL);
+    //                                                             ---------------- GET DAY, DAY OF WK ----------------
+    p_date_time->Yr = yr;
+    p_date_time->Month = month_ix + CLK_FIRST_MONTH_OF_YR;
+    p_date_time->Day = (CLK_DAY)(days - Clk_DaysBeforeMonth[leap_yr_ix][month_ix]) + CLK_FIRST_DAY_OF_MONTH;
+    p_date_time->DayOfYr = (CLK_DAY)days + CLK_FIRST_DAY_OF_YR;
+    p_date_time->DayOfWk = Clk_GetDayOfWkHandler(p_date_time->Yr,
+                                                 p_date_time->Month,
+                                                 p_date_time->Day);
+
+    CORE_ENTER_ATOMIC();                                        // Cache converted day (see Note #3).
+    Clk_CacheDayYrStart = yr_start;
+    Clk_CacheDayTS = ts_day_start;
+    Clk_CacheDayDateTime = *p_date_time;
+    CORE_EXIT_ATOMIC();
   }
 
   //                                                               --------------------- GET HR -----------------------
@@ -2981,8 +2960,6 @@ static CPU_BOOLEAN Clk_DateTimeToTS_Handler(CLK_TS_SEC    *p_ts_sec,
 {
   CPU_BOOLEAN  leap_yr;
   CPU_INT08U   leap_yr_ix;
-  CLK_YR       yr_ix;
-  CLK_MONTH    month_ix;
   CLK_NBR_DAYS nbr_days;
   CLK_TS_SEC   ts_sec;
   CLK_TS_SEC   tz_sec_abs;                                      // See Note #3.
@@ -3000,18 +2977,11 @@ static CPU_BOOLEAN Clk_DateTimeToTS_Handler(CLK_TS_SEC    *p_ts_sec,
            "\r\n     Time zone = ", (d)p_date_time->TZ_sec));
 
   //                                                               ------------- CONV DATE/TIME TO CLK TS -------------
-  nbr_days = p_date_time->Day - CLK_FIRST_DAY_OF_MONTH;
   leap_yr = Clk_IsLeapYr(p_date_time->Yr);
   leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
-  for (month_ix = CLK_FIRST_MONTH_OF_YR; month_ix < p_date_time->Month; month_ix++) {
-    nbr_days += Clk_DaysInMonth[leap_yr_ix][month_ix - CLK_FIRST_MONTH_OF_YR];
-  }
-
-  for (yr_ix = yr_start; yr_ix < p_date_time->Yr; yr_ix++) {
-    leap_yr = Clk_IsLeapYr(yr_ix);
-    leap_yr_ix = (leap_yr == DEF_YES) ? 1u : 0u;
-    nbr_days += Clk_DaysInYr[leap_yr_ix];
-  }
+  nbr_days = p_date_time->Day - CLK_FIRST_DAY_OF_MONTH;
+  nbr_days += Clk_DaysBeforeMonth[leap_yr_ix][p_date_time->Month - CLK_FIRST_MONTH_OF_YR];
+  nbr_days += Clk_GetDaysBeforeYrHandler(p_date_time->Yr, yr_start);
 
   ts_sec = nbr_days         * DEF_TIME_NBR_SEC_PER_DAY;
   ts_sec += p_date_time->Hr  * DEF_TIME_NBR_SEC_PER_HR;
@@ -3145,13 +3115,15 @@ static CPU_BOOLEAN Clk_DateTimeMakeHandler(CLK_DATE_TIME *p_date_time,
  *
  * @param    p_arg   Pointer to argument (unused).
  *
- * @note
+ * @note     (1) The date/time is converted once per second so that a new day is cached by the task rather
+ *               than by the first caller of the day.
  *******************************************************************************************************/
 
 #if ((CLK_CFG_EXT_EN == DEF_DISABLED) \
   && (CLK_CFG_SIGNAL_EN == DEF_DISABLED))
 static void Clk_TaskHandler(void *p_arg)
 {
+  CLK_DATE_TIME date_time;
   CORE_DECLARE_IRQ_STATE;
 
   PP_UNUSED_PARAM(p_arg);
@@ -3166,6 +3138,8 @@ static void Clk_TaskHandler(void *p_arg)
       Clk_Ptr->Clk_TS_UTC_sec++;
     }
     CORE_EXIT_ATOMIC();
+
+    (void)Clk_GetDateTime(&date_time);                          // Refresh day cache (see Note #1).
   }
 }
 #endif
@@ -25,6 +25,7 @@
 
 #include  <cpu/include/cpu.h>
 #include  <common/include/lib_def.h>
+#include  <common/include/lib_math.h>
 
 #include  <common/source/rtos/rtos_utils_priv.h>
 
@@ -37,6 +38,21 @@
 #define  LOG_DFLT_CH                       (COMMON, COLLECTIONS, MAP)
 #define  RTOS_MODULE_CUR                    RTOS_CFG_MODULE_COMMON
 
+#define  MAP_HASH_MOVE_STEP                 8u                  // Nbr of old tbl slots moved per add or remove.
+
+#define  MAP_HASH_FNV1A_OFFSET_BASIS        2166136261u
+#define  MAP_HASH_FNV1A_PRIME               16777619u
+
+#define  MAP_HASH_SLOT_IS_ITEM(p_item)      (((p_item) != DEF_NULL) && ((p_item) != &MapHashTombstone))
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           LOCAL VARIABLES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+static MAP_ITEM MapHashTombstone;                               // Marks a slot whose item was removed.
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                       LOCAL FUNCTION PROTOTYPES
@@ -49,6 +65,34 @@ static CPU_BOOLEAN MapItemExists(MAP_INSTANCE *p_map_instance,
 static CPU_BOOLEAN MapKeyExists(MAP_INSTANCE *p_map_instance,
                                 CPU_CHAR     *key);
 
+static MAP_ITEM **MapHashSlotFind(MAP_ITEM   **p_slot_tbl,
+                                  CPU_SIZE_T slot_mask,
+                                  CPU_INT32U hash,
+                                  CPU_CHAR   *key);
+
+static MAP_ITEM **MapHashLookup(MAP_HASH   *p_map_hash,
+                                CPU_INT32U hash,
+                                CPU_CHAR   *key);
+
+static MAP_ITEM **MapHashSlotFreeGet(MAP_ITEM   **p_slot_tbl,
+                                     CPU_SIZE_T slot_mask,
+                                     CPU_INT32U hash);
+
+static CPU_BOOLEAN MapHashSlotInsert(MAP_ITEM   **p_slot_tbl,
+                                     CPU_SIZE_T slot_mask,
+                                     MAP_ITEM   *p_map_item);
+
+static void MapHashResize(MAP_HASH *p_map_hash,
+                          RTOS_ERR *p_err);
+
+static void MapHashPurge(MAP_HASH *p_map_hash);
+
+static void MapHashMove(MAP_HASH   *p_map_hash,
+                        CPU_SIZE_T slot_qty);
+
+static void MapHashSlotRemove(MAP_HASH *p_map_hash,
+                              MAP_ITEM **p_slot);
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           GLOBAL FUNCTIONS
@@ -258,6 +302,397 @@ void *MapKeyValueGet(MAP_INSTANCE *p_map_instance,
   return (p_ret_item->Value);
 }
 
+/****************************************************************************************************//**
+ *                                               MapHashInit()
+ *
+ * @brief    Initializes hash map object.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_cfg       Pointer to hash map configuration. DEF_NULL to use the default hash function,
+ *                       the heap, MAP_HASH_SLOT_QTY_DFLT slots and no ordering.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_SEG_OVF
+ *******************************************************************************************************/
+void MapHashInit(MAP_HASH           *p_map_hash,
+                 const MAP_HASH_CFG *p_cfg,
+                 RTOS_ERR           *p_err)
+{
+  CPU_SIZE_T slot_qty = MAP_HASH_SLOT_QTY_DFLT;
+  CPU_SIZE_T ix;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((p_map_hash != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  p_map_hash->HashFnct = MapHashKeyFNV1a;
+  p_map_hash->MemSegPtr = DEF_NULL;
+  p_map_hash->IsOrdered = DEF_NO;
+
+  if (p_cfg != DEF_NULL) {
+    RTOS_ASSERT_DBG_ERR_SET(((p_cfg->SlotQtyInit == 0u)
+                             || (MATH_IS_PWR2(p_cfg->SlotQtyInit) == DEF_YES)), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+    if (p_cfg->HashFnct != DEF_NULL) {
+      p_map_hash->HashFnct = p_cfg->HashFnct;
+    }
+    if (p_cfg->SlotQtyInit != 0u) {
+      slot_qty = p_cfg->SlotQtyInit;
+    }
+    p_map_hash->MemSegPtr = p_cfg->MemSegPtr;
+    p_map_hash->IsOrdered = p_cfg->IsOrdered;
+  }
+
+  p_map_hash->SlotTbl = (MAP_ITEM **)Mem_SegAlloc("Map Hash Tbl",
+                                                  p_map_hash->MemSegPtr,
+                                                  sizeof(MAP_ITEM *) * slot_qty,
+                                                  p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+
+  for (ix = 0u; ix < slot_qty; ix++) {
+    p_map_hash->SlotTbl[ix] = DEF_NULL;
+  }
+
+  p_map_hash->SlotMask = slot_qty - 1u;
+  p_map_hash->SlotUsedCnt = 0u;
+  p_map_hash->OldSlotTbl = DEF_NULL;
+  p_map_hash->OldSlotMask = 0u;
+  p_map_hash->OldSlotMoveIx = 0u;
+  p_map_hash->ItemCnt = 0u;
+  p_map_hash->OrderHeadPtr = DEF_NULL;
+  p_map_hash->OrderTailPtr = DEF_NULL;
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashItemAdd()
+ *
+ * @brief    Add item to hash map.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_map_item  Pointer to map item to add to hash map.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_ALREADY_EXISTS
+ *                           - RTOS_ERR_SEG_OVF
+ *
+ * @note     (1) The table is grown or purged of its tombstones once it is 3/4 full (see MapHashResize()).
+ *               If a larger table cannot be allocated, items are still added to the current table, in
+ *               the slot of a removed item or in an empty slot as long as another one is left.
+ *******************************************************************************************************/
+void MapHashItemAdd(MAP_HASH *p_map_hash,
+                    MAP_ITEM *p_map_item,
+                    RTOS_ERR *p_err)
+{
+  CPU_INT32U hash;
+  MAP_ITEM   **p_slot;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((p_map_hash != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((p_map_item != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((p_map_item->Key != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  hash = p_map_hash->HashFnct(p_map_item->Key);
+  if (MapHashLookup(p_map_hash, hash, p_map_item->Key) != DEF_NULL) {
+    RTOS_ERR_SET(*p_err, RTOS_ERR_ALREADY_EXISTS);
+    return;
+  }
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+  if (((p_map_hash->SlotUsedCnt + 1u) * 4u) > ((p_map_hash->SlotMask + 1u) * 3u)) {
+    MapHashResize(p_map_hash, p_err);                           // See Note #1.
+  } else {
+    MapHashMove(p_map_hash, MAP_HASH_MOVE_STEP);
+  }
+
+  p_slot = MapHashSlotFreeGet(p_map_hash->SlotTbl, p_map_hash->SlotMask, hash);
+  if (*p_slot == DEF_NULL) {
+    if ((RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE)
+        && ((p_map_hash->SlotUsedCnt + 1u) > p_map_hash->SlotMask)) {
+      return;                                                   // Keep an empty slot to end probes.
+    }
+    p_map_hash->SlotUsedCnt++;
+  }
+
+  p_map_item->Hash = hash;
+  *p_slot = p_map_item;
+  p_map_hash->ItemCnt++;
+
+  if (p_map_hash->IsOrdered == DEF_YES) {                       // Append to insertion order list.
+    p_map_item->ListNode.p_next = DEF_NULL;
+    if (p_map_hash->OrderTailPtr == DEF_NULL) {
+      p_map_hash->OrderHeadPtr = &p_map_item->ListNode;
+    } else {
+      p_map_hash->OrderTailPtr->p_next = &p_map_item->ListNode;
+    }
+    p_map_hash->OrderTailPtr = &p_map_item->ListNode;
+  }
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashItemRemove()
+ *
+ * @brief    Remove map item from hash map.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_map_item  Pointer to map item to remove from hash map.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_NOT_FOUND
+ *******************************************************************************************************/
+void MapHashItemRemove(MAP_HASH *p_map_hash,
+                       MAP_ITEM *p_map_item,
+                       RTOS_ERR *p_err)
+{
+  MAP_ITEM **p_slot;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((p_map_hash != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((p_map_item != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  p_slot = MapHashLookup(p_map_hash, p_map_item->Hash, p_map_item->Key);
+  if ((p_slot == DEF_NULL)
+      || (*p_slot != p_map_item)) {
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NOT_FOUND);
+    return;
+  }
+
+  MapHashSlotRemove(p_map_hash, p_slot);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashKeyRemove()
+ *
+ * @brief    Remove hash map item associated to 'key'.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    key         String containing key of map item to remove.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_NOT_FOUND
+ *******************************************************************************************************/
+void MapHashKeyRemove(MAP_HASH *p_map_hash,
+                      CPU_CHAR *key,
+                      RTOS_ERR *p_err)
+{
+  MAP_ITEM **p_slot;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((p_map_hash != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((key != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  p_slot = MapHashLookup(p_map_hash, p_map_hash->HashFnct(key), key);
+  if (p_slot == DEF_NULL) {
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NOT_FOUND);
+    return;
+  }
+
+  MapHashSlotRemove(p_map_hash, p_slot);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashKeyItemGet()
+ *
+ * @brief    Obtain pointer to hash map item with corresponding 'key'.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    key         String containing key of map item to obtain.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_NOT_FOUND
+ *
+ * @return   Pointer to map item, if item exists,
+ *           DEF_NULL, otherwise.
+ *******************************************************************************************************/
+MAP_ITEM *MapHashKeyItemGet(MAP_HASH *p_map_hash,
+                            CPU_CHAR *key,
+                            RTOS_ERR *p_err)
+{
+  MAP_ITEM **p_slot;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, DEF_NULL);
+
+  RTOS_ASSERT_DBG_ERR_SET((p_map_hash != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, DEF_NULL);
+  RTOS_ASSERT_DBG_ERR_SET((key != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, DEF_NULL);
+
+  p_slot = MapHashLookup(p_map_hash, p_map_hash->HashFnct(key), key);
+  if (p_slot == DEF_NULL) {
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NOT_FOUND);
+    return (DEF_NULL);
+  }
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+  return (*p_slot);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashKeyValueGet()
+ *
+ * @brief    Obtain value associated to the hash map item corresponding to the 'key' passed.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    key         String containing key of map item to obtain value from.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_NOT_FOUND
+ *
+ * @return   Value to map item, if item exists,
+ *           DEF_NULL, otherwise.
+ *******************************************************************************************************/
+void *MapHashKeyValueGet(MAP_HASH *p_map_hash,
+                         CPU_CHAR *key,
+                         RTOS_ERR *p_err)
+{
+  MAP_ITEM *p_ret_item;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, DEF_NULL);
+
+  p_ret_item = MapHashKeyItemGet(p_map_hash, key, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (DEF_NULL);
+  }
+
+  return (p_ret_item->Value);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashIterInit()
+ *
+ * @brief    Initializes an iterator over the items of a hash map.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_iter      Pointer to iterator to initialize.
+ *
+ * @note     (1) Items MUST NOT be added to or removed from the hash map while it is iterated.
+ *******************************************************************************************************/
+void MapHashIterInit(MAP_HASH      *p_map_hash,
+                     MAP_HASH_ITER *p_iter)
+{
+  RTOS_ASSERT_DBG((p_map_hash != DEF_NULL), RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG((p_iter != DEF_NULL), RTOS_ERR_NULL_PTR,; );
+
+  p_iter->NextNodePtr = p_map_hash->OrderHeadPtr;
+  if (p_map_hash->OldSlotTbl != DEF_NULL) {                     // Old tbl slots below move ix are all moved.
+    p_iter->SlotIx = p_map_hash->OldSlotMoveIx;
+    p_iter->InOldTbl = DEF_YES;
+  } else {
+    p_iter->SlotIx = 0u;
+    p_iter->InOldTbl = DEF_NO;
+  }
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashIterNext()
+ *
+ * @brief    Obtain the next item of a hash map.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_iter      Pointer to iterator initialized by MapHashIterInit().
+ *
+ * @return   Pointer to next map item, if any,
+ *           DEF_NULL, otherwise.
+ *
+ * @note     (1) Items are returned in insertion order if the hash map is ordered, in no particular
+ *               order otherwise.
+ *******************************************************************************************************/
+MAP_ITEM *MapHashIterNext(MAP_HASH      *p_map_hash,
+                          MAP_HASH_ITER *p_iter)
+{
+  MAP_ITEM *p_map_item;
+
+  RTOS_ASSERT_DBG((p_map_hash != DEF_NULL), RTOS_ERR_NULL_PTR, DEF_NULL);
+  RTOS_ASSERT_DBG((p_iter != DEF_NULL), RTOS_ERR_NULL_PTR, DEF_NULL);
+
+  if (p_map_hash->IsOrdered == DEF_YES) {
+    if (p_iter->NextNodePtr == DEF_NULL) {
+      return (DEF_NULL);
+    }
+    p_map_item = SLIST_ENTRY(p_iter->NextNodePtr, MAP_ITEM, ListNode);
+    p_iter->NextNodePtr = p_iter->NextNodePtr->p_next;
+
+    return (p_map_item);
+  }
+
+  if (p_iter->InOldTbl == DEF_YES) {
+    while (p_iter->SlotIx <= p_map_hash->OldSlotMask) {
+      p_map_item = p_map_hash->OldSlotTbl[p_iter->SlotIx];
+      p_iter->SlotIx++;
+      if (MAP_HASH_SLOT_IS_ITEM(p_map_item)) {
+        return (p_map_item);
+      }
+    }
+    p_iter->SlotIx = 0u;
+    p_iter->InOldTbl = DEF_NO;
+  }
+
+  while (p_iter->SlotIx <= p_map_hash->SlotMask) {
+    p_map_item = p_map_hash->SlotTbl[p_iter->SlotIx];
+    p_iter->SlotIx++;
+    if (MAP_HASH_SLOT_IS_ITEM(p_map_item)) {
+      return (p_map_item);
+    }
+  }
+
+  return (DEF_NULL);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashKeyFNV1a()
+ *
+ * @brief    Default hash map key hash function, computing the 32-bit FNV-1a hash of a string.
+ *
+ * @param    key     String to hash.
+ *
+ * @return   Hash of 'key'.
+ *
+ * @note     (1) Like the key comparisons, only the first DEF_INT_08U_MAX_VAL characters are used.
+ *******************************************************************************************************/
+CPU_INT32U MapHashKeyFNV1a(const CPU_CHAR *key)
+{
+  CPU_INT32U hash = MAP_HASH_FNV1A_OFFSET_BASIS;
+  CPU_SIZE_T len = 0u;
+
+  while ((key[len] != '\0')
+         && (len < DEF_INT_08U_MAX_VAL)) {
+    hash ^= (CPU_INT08U)key[len];
+    hash *= MAP_HASH_FNV1A_PRIME;
+    len++;
+  }
+
+  return (hash);
+}
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           LOCAL FUNCTIONS
@@ -321,3 +756,294 @@ static CPU_BOOLEAN MapKeyExists(MAP_INSTANCE *p_map_instance,
 
   return (found);
 }
+
+/****************************************************************************************************//**
+ *                                               MapHashSlotFind()
+ *
+ * @brief    Searches a hash map table for the slot holding the item with the given key.
+ *
+ * @param    p_slot_tbl  Pointer to table of slots.
+ *
+ * @param    slot_mask   Number of slots in table - 1.
+ *
+ * @param    hash        Hash of 'key'.
+ *
+ * @param    key         String containing key to search for.
+ *
+ * @return   Pointer to slot holding the item, if found,
+ *           DEF_NULL, otherwise.
+ *******************************************************************************************************/
+static MAP_ITEM **MapHashSlotFind(MAP_ITEM   **p_slot_tbl,
+                                  CPU_SIZE_T slot_mask,
+                                  CPU_INT32U hash,
+                                  CPU_CHAR   *key)
+{
+  CPU_SIZE_T ix = hash & slot_mask;
+  MAP_ITEM   *p_map_item;
+
+  while (p_slot_tbl[ix] != DEF_NULL) {                          // Tbl always has an empty slot ending the probe.
+    p_map_item = p_slot_tbl[ix];
+    if ((p_map_item != &MapHashTombstone)
+        && (p_map_item->Hash == hash)
+        && (Str_Cmp_N(p_map_item->Key, key, DEF_INT_08U_MAX_VAL) == 0)) {
+      return (&p_slot_tbl[ix]);
+    }
+    ix = (ix + 1u) & slot_mask;
+  }
+
+  return (DEF_NULL);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashLookup()
+ *
+ * @brief    Searches a hash map for the slot holding the item with the given key.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    hash        Hash of 'key'.
+ *
+ * @param    key         String containing key to search for.
+ *
+ * @return   Pointer to slot holding the item, if found,
+ *           DEF_NULL, otherwise.
+ *******************************************************************************************************/
+static MAP_ITEM **MapHashLookup(MAP_HASH   *p_map_hash,
+                                CPU_INT32U hash,
+                                CPU_CHAR   *key)
+{
+  MAP_ITEM **p_slot;
+
+  p_slot = MapHashSlotFind(p_map_hash->SlotTbl, p_map_hash->SlotMask, hash, key);
+  if ((p_slot == DEF_NULL)
+      && (p_map_hash->OldSlotTbl != DEF_NULL)) {                // Item may not be moved yet.
+    p_slot = MapHashSlotFind(p_map_hash->OldSlotTbl, p_map_hash->OldSlotMask, hash, key);
+  }
+
+  return (p_slot);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashSlotFreeGet()
+ *
+ * @brief    Gets the first slot of a probe sequence that holds no item.
+ *
+ * @param    p_slot_tbl  Pointer to table of slots.
+ *
+ * @param    slot_mask   Number of slots in table - 1.
+ *
+ * @param    hash        Hash of the key to store.
+ *
+ * @return   Pointer to the first empty slot or tombstone of the probe sequence.
+ *******************************************************************************************************/
+static MAP_ITEM **MapHashSlotFreeGet(MAP_ITEM   **p_slot_tbl,
+                                     CPU_SIZE_T slot_mask,
+                                     CPU_INT32U hash)
+{
+  CPU_SIZE_T ix = hash & slot_mask;
+
+  while (MAP_HASH_SLOT_IS_ITEM(p_slot_tbl[ix])) {
+    ix = (ix + 1u) & slot_mask;
+  }
+
+  return (&p_slot_tbl[ix]);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashSlotInsert()
+ *
+ * @brief    Stores an item in the first free slot of its probe sequence.
+ *
+ * @param    p_slot_tbl  Pointer to table of slots.
+ *
+ * @param    slot_mask   Number of slots in table - 1.
+ *
+ * @param    p_map_item  Pointer to map item to store. Its key MUST NOT already be in the table.
+ *
+ * @return   DEF_YES, if an empty slot was used,
+ *           DEF_NO,  if a tombstone was reused.
+ *******************************************************************************************************/
+static CPU_BOOLEAN MapHashSlotInsert(MAP_ITEM   **p_slot_tbl,
+                                     CPU_SIZE_T slot_mask,
+                                     MAP_ITEM   *p_map_item)
+{
+  MAP_ITEM    **p_slot;
+  CPU_BOOLEAN is_empty;
+
+  p_slot = MapHashSlotFreeGet(p_slot_tbl, slot_mask, p_map_item->Hash);
+
+  is_empty = (*p_slot == DEF_NULL) ? DEF_YES : DEF_NO;
+  *p_slot = p_map_item;
+
+  return (is_empty);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashResize()
+ *
+ * @brief    Allocates a new table for a hash map and starts moving the items to it.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_SEG_OVF
+ *
+ * @note     (1) The table only doubles when more than half of its slots would hold items. Otherwise
+ *               it is mostly filled with tombstones, which are dropped in place without allocating a
+ *               new table (see MapHashPurge()).
+ *******************************************************************************************************/
+static void MapHashResize(MAP_HASH *p_map_hash,
+                          RTOS_ERR *p_err)
+{
+  MAP_ITEM   **p_slot_tbl;
+  CPU_SIZE_T slot_qty;
+  CPU_SIZE_T ix;
+
+  if (p_map_hash->OldSlotTbl != DEF_NULL) {                     // Finish previous resize first.
+    MapHashMove(p_map_hash, p_map_hash->OldSlotMask + 1u);
+  }
+
+  slot_qty = p_map_hash->SlotMask + 1u;
+  if (((p_map_hash->ItemCnt + 1u) * 2u) <= slot_qty) {          // See Note #1.
+    MapHashPurge(p_map_hash);
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    return;
+  }
+  slot_qty *= 2u;
+
+  p_slot_tbl = (MAP_ITEM **)Mem_SegAlloc("Map Hash Tbl",
+                                         p_map_hash->MemSegPtr,
+                                         sizeof(MAP_ITEM *) * slot_qty,
+                                         p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+
+  for (ix = 0u; ix < slot_qty; ix++) {
+    p_slot_tbl[ix] = DEF_NULL;
+  }
+
+  p_map_hash->OldSlotTbl = p_map_hash->SlotTbl;
+  p_map_hash->OldSlotMask = p_map_hash->SlotMask;
+  p_map_hash->OldSlotMoveIx = 0u;
+  p_map_hash->SlotTbl = p_slot_tbl;
+  p_map_hash->SlotMask = slot_qty - 1u;
+  p_map_hash->SlotUsedCnt = 0u;
+
+  MapHashMove(p_map_hash, MAP_HASH_MOVE_STEP);
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashPurge()
+ *
+ * @brief    Drops the tombstones of the current table of a hash map, in place.
+ *
+ * @param    p_map_hash  Pointer to hash map object. Its old table MUST have been fully moved.
+ *
+ * @note     (1) The slots are visited once, starting after an empty slot. Each item is removed and
+ *               stored again in the first empty slot of its probe sequence, which is at or before its
+ *               previous slot. Since no probe sequence goes through an empty slot, the sequences of
+ *               the items already visited are never broken by the following ones.
+ *******************************************************************************************************/
+static void MapHashPurge(MAP_HASH *p_map_hash)
+{
+  MAP_ITEM   **p_slot_tbl = p_map_hash->SlotTbl;
+  CPU_SIZE_T slot_mask = p_map_hash->SlotMask;
+  MAP_ITEM   *p_map_item;
+  CPU_SIZE_T ix;
+  CPU_SIZE_T slot_cnt;
+
+  ix = 0u;
+  while (p_slot_tbl[ix] != DEF_NULL) {                          // Tbl always keeps at least one empty slot.
+    ix++;
+  }
+
+  for (slot_cnt = 0u; slot_cnt <= slot_mask; slot_cnt++) {
+    ix = (ix + 1u) & slot_mask;
+    p_map_item = p_slot_tbl[ix];
+    p_slot_tbl[ix] = DEF_NULL;
+    if (MAP_HASH_SLOT_IS_ITEM(p_map_item)) {
+      (void)MapHashSlotInsert(p_slot_tbl, slot_mask, p_map_item);
+    }
+  }
+
+  p_map_hash->SlotUsedCnt = p_map_hash->ItemCnt;
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashMove()
+ *
+ * @brief    Moves items from the old table of a hash map to its current table.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    slot_qty    Maximum number of old table slots to process.
+ *
+ * @note     (1) Moved items are replaced by tombstones so that the probe sequences of the items left
+ *               in the old table stay intact.
+ *******************************************************************************************************/
+static void MapHashMove(MAP_HASH   *p_map_hash,
+                        CPU_SIZE_T slot_qty)
+{
+  MAP_ITEM *p_map_item;
+
+  if (p_map_hash->OldSlotTbl == DEF_NULL) {
+    return;
+  }
+
+  while ((slot_qty > 0u)
+         && (p_map_hash->OldSlotMoveIx <= p_map_hash->OldSlotMask)) {
+    p_map_item = p_map_hash->OldSlotTbl[p_map_hash->OldSlotMoveIx];
+    if (MAP_HASH_SLOT_IS_ITEM(p_map_item)) {
+      if (MapHashSlotInsert(p_map_hash->SlotTbl, p_map_hash->SlotMask, p_map_item) == DEF_YES) {
+        p_map_hash->SlotUsedCnt++;
+      }
+      p_map_hash->OldSlotTbl[p_map_hash->OldSlotMoveIx] = &MapHashTombstone;
+    }
+    p_map_hash->OldSlotMoveIx++;
+    slot_qty--;
+  }
+
+  if (p_map_hash->OldSlotMoveIx > p_map_hash->OldSlotMask) {    // All items moved, old tbl is lost.
+    p_map_hash->OldSlotTbl = DEF_NULL;
+    p_map_hash->OldSlotMask = 0u;
+    p_map_hash->OldSlotMoveIx = 0u;
+  }
+}
+
+/****************************************************************************************************//**
+ *                                               MapHashSlotRemove()
+ *
+ * @brief    Removes the item held by a slot of a hash map.
+ *
+ * @param    p_map_hash  Pointer to hash map object.
+ *
+ * @param    p_slot      Pointer to slot, in the current or old table, holding the item to remove.
+ *******************************************************************************************************/
+static void MapHashSlotRemove(MAP_HASH *p_map_hash,
+                              MAP_ITEM **p_slot)
+{
+  MAP_ITEM     *p_map_item = *p_slot;
+  SLIST_MEMBER **p_next_ptr;
+  SLIST_MEMBER *p_prev;
+
+  *p_slot = &MapHashTombstone;                                  // Keep probe sequences going through slot intact.
+  p_map_hash->ItemCnt--;
+
+  if (p_map_hash->IsOrdered == DEF_YES) {                       // Unlink from insertion order list.
+    p_prev = DEF_NULL;
+    p_next_ptr = &p_map_hash->OrderHeadPtr;
+    while (*p_next_ptr != &p_map_item->ListNode) {
+      p_prev = *p_next_ptr;
+      p_next_ptr = &((*p_next_ptr)->p_next);
+    }
+    *p_next_ptr = p_map_item->ListNode.p_next;
+    if (p_map_hash->OrderTailPtr == &p_map_item->ListNode) {
+      p_map_hash->OrderTailPtr = p_prev;
+    }
+  }
+
+  MapHashMove(p_map_hash, MAP_HASH_MOVE_STEP);
+}
@@ -37,9 +37,32 @@
 #include  <common/include/rtos_err.h>
 #include  <common/include/lib_mem.h>
 
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                                   DEFINES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  MAP_HASH_SLOT_QTY_DFLT                 16u             // Dflt nbr of slots of a new hash map tbl.
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               DATA TYPES
+ *
+ * Note(s) : (1) A hash map stores pointers to the caller's MAP_ITEMs in a power-of-two table of slots,
+ *               using open addressing with linear probing. When the table gets 3/4 full, a table twice
+ *               as large is allocated and the items are moved to it a few slots at a time by each
+ *               following add or remove, so no single call pays for the whole rehash. Until then,
+ *               lookups search both tables.
+ *
+ *           (2) Tables are allocated from a MEM_SEG and cannot be freed, so each resize loses the
+ *               previous table. A new table is only allocated when doubling, so the memory lost is
+ *               less than the size of the current table. A table mostly filled with tombstones is
+ *               purged in place instead. Set 'SlotQtyInit' to the expected nbr of items to avoid resizes.
+ *
+ *           (3) When 'IsOrdered' is set, items are also linked in insertion order through their
+ *               'ListNode', and MapHashIterNext() returns them in that order. Removing an item from
+ *               an ordered hash map then walks that list.
  ********************************************************************************************************
  *******************************************************************************************************/
 
@@ -49,8 +72,39 @@ typedef struct map_item {
   SLIST_MEMBER ListNode;
   CPU_CHAR     *Key;
   void         *Value;
+  CPU_INT32U   Hash;                                            // Key hash, only used by hash maps.
 } MAP_ITEM;
 
+typedef CPU_INT32U (*MAP_HASH_FNCT)(const CPU_CHAR *key);
+
+typedef struct map_hash_cfg {
+  MAP_HASH_FNCT HashFnct;                                       // Key hash fnct. DEF_NULL to use MapHashKeyFNV1a().
+  MEM_SEG       *MemSegPtr;                                     // Seg to alloc tbls from. DEF_NULL for the heap.
+  CPU_SIZE_T    SlotQtyInit;                                    // Initial nbr of slots, power of 2 (see Note #2).
+  CPU_BOOLEAN   IsOrdered;                                      // Iterate in insertion order (see Note #3).
+} MAP_HASH_CFG;
+
+typedef struct map_hash {
+  MAP_ITEM      **SlotTbl;                                      // Cur tbl of slots (see Note #1).
+  CPU_SIZE_T    SlotMask;                                       // Nbr of slots in cur tbl - 1.
+  CPU_SIZE_T    SlotUsedCnt;                                    // Nbr of slots in cur tbl holding an item or a tombstone.
+  MAP_ITEM      **OldSlotTbl;                                   // Tbl being moved to cur tbl, DEF_NULL if none.
+  CPU_SIZE_T    OldSlotMask;                                    // Nbr of slots in old tbl - 1.
+  CPU_SIZE_T    OldSlotMoveIx;                                  // Ix of next old tbl slot to move.
+  CPU_SIZE_T    ItemCnt;                                        // Nbr of items in map.
+  MAP_HASH_FNCT HashFnct;
+  MEM_SEG       *MemSegPtr;
+  CPU_BOOLEAN   IsOrdered;
+  SLIST_MEMBER  *OrderHeadPtr;                                  // Items in insertion order (see Note #3).
+  SLIST_MEMBER  *OrderTailPtr;
+} MAP_HASH;
+
+typedef struct map_hash_iter {
+  SLIST_MEMBER *NextNodePtr;                                    // Next item of ordered hash map.
+  CPU_SIZE_T   SlotIx;                                          // Next slot to visit.
+  CPU_BOOLEAN  InOldTbl;                                        // DEF_YES while visiting the old tbl.
+} MAP_HASH_ITER;
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           FUNCTION PROTOTYPES
@@ -79,6 +133,38 @@ void *MapKeyValueGet(MAP_INSTANCE *p_map_instance,
                      CPU_CHAR     *key,
                      RTOS_ERR     *p_err);
 
+void MapHashInit(MAP_HASH           *p_map_hash,
+                 const MAP_HASH_CFG *p_cfg,
+                 RTOS_ERR           *p_err);
+
+void MapHashItemAdd(MAP_HASH *p_map_hash,
+                    MAP_ITEM *p_map_item,
+                    RTOS_ERR *p_err);
+
+void MapHashItemRemove(MAP_HASH *p_map_hash,
+                       MAP_ITEM *p_map_item,
+                       RTOS_ERR *p_err);
+
+void MapHashKeyRemove(MAP_HASH *p_map_hash,
+                      CPU_CHAR *key,
+                      RTOS_ERR *p_err);
+
+MAP_ITEM *MapHashKeyItemGet(MAP_HASH *p_map_hash,
+                            CPU_CHAR *key,
+                            RTOS_ERR *p_err);
+
+void *MapHashKeyValueGet(MAP_HASH *p_map_hash,
+                         CPU_CHAR *key,
+                         RTOS_ERR *p_err);
+
+void MapHashIterInit(MAP_HASH      *p_map_hash,
+                     MAP_HASH_ITER *p_iter);
+
+MAP_ITEM *MapHashIterNext(MAP_HASH      *p_map_hash,
+                          MAP_HASH_ITER *p_iter);
+
+CPU_INT32U MapHashKeyFNV1a(const CPU_CHAR *key);
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               MODULE END
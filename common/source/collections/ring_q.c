@@ -0,0 +1,207 @@
+/***************************************************************************//**
+ * @file
+ * @brief Common - Lock-Free Ring Queues
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.  This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               INCLUDE FILES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#include  <common/source/collections/ring_q_priv.h>
+
+#include  <cpu/include/cpu.h>
+#include  <common/include/lib_def.h>
+#include  <common/include/lib_math.h>
+
+#include  <common/source/rtos/rtos_utils_priv.h>
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               LOCAL DEFINES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  LOG_DFLT_CH                       (COMMON, COLLECTIONS, RING_Q)
+#define  RTOS_MODULE_CUR                    RTOS_CFG_MODULE_COMMON
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           GLOBAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                               RingQ_Init()
+ *
+ * @brief    Initializes a ring queue.
+ *
+ * @param    p_q         Pointer to ring queue to initialize.
+ *
+ * @param    p_slot_tbl  Pointer to table of 'slot_qty' slots used to store the queued items.
+ *
+ * @param    slot_qty    Number of slots. MUST be a power of 2.
+ *******************************************************************************************************/
+void RingQ_Init(RING_Q     *p_q,
+                void       **p_slot_tbl,
+                CPU_SIZE_T slot_qty)
+{
+  CPU_SIZE_T ix;
+
+  RTOS_ASSERT_DBG((p_q != DEF_NULL), RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG((p_slot_tbl != DEF_NULL), RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG((MATH_IS_PWR2(slot_qty) == DEF_YES), RTOS_ERR_INVALID_ARG,; );
+
+  for (ix = 0u; ix < slot_qty; ix++) {
+    p_slot_tbl[ix] = DEF_NULL;
+  }
+
+  p_q->SlotTbl = p_slot_tbl;
+  p_q->Mask = slot_qty - 1u;
+  p_q->WrIx = 0u;
+  p_q->RdIx = 0u;
+}
+
+/****************************************************************************************************//**
+ *                                               RingQ_SPSC_Push()
+ *
+ * @brief    Adds an item to a ring queue that has a single producer.
+ *
+ * @param    p_q     Pointer to ring queue.
+ *
+ * @param    p_item  Pointer to item to add. MUST NOT be DEF_NULL.
+ *
+ * @return   DEF_OK,   if the item was added.
+ *           DEF_FAIL, if the queue is full.
+ *
+ * @note     (1) Only one task or ISR may push to a given queue with this function. The producer owns
+ *               'WrIx' and finds out whether the queue is full from the slot itself, so it never reads
+ *               the consumer's index.
+ *
+ * @note     (2) Whatever 'p_item' points to MUST be visible to the consumer before the item is.
+ *******************************************************************************************************/
+CPU_BOOLEAN RingQ_SPSC_Push(RING_Q *p_q,
+                            void   *p_item)
+{
+  void **p_slot;
+
+  RTOS_ASSERT_DBG((p_item != DEF_NULL), RTOS_ERR_NULL_PTR, DEF_FAIL);
+
+  p_slot = &p_q->SlotTbl[p_q->WrIx & p_q->Mask];
+  if (*p_slot != DEF_NULL) {                                    // Slot not drained yet, queue is full.
+    return (DEF_FAIL);
+  }
+
+  CPU_WMB();                                                    // See Note #2.
+  *p_slot = p_item;
+  p_q->WrIx++;
+
+  return (DEF_OK);
+}
+
+/****************************************************************************************************//**
+ *                                               RingQ_MPSC_Push()
+ *
+ * @brief    Adds an item to a ring queue that has multiple producers.
+ *
+ * @param    p_q     Pointer to ring queue.
+ *
+ * @param    p_item  Pointer to item to add. MUST NOT be DEF_NULL.
+ *
+ * @return   DEF_OK,   if the item was added.
+ *           DEF_FAIL, if the queue is full.
+ *
+ * @note     (1) Producers, tasks or ISRs, reserve a slot by advancing 'WrIx' with CPU_CmpSwap(), then
+ *               fill it. On cores without an atomic compare-and-swap, CPU_CmpSwap() falls back to a
+ *               critical section covering the compare and the store only.
+ *
+ * @note     (2) A producer preempted between its reservation and its store delays the items queued
+ *               after it: RingQ_Pop() returns DEF_NULL until the reserved slot is filled.
+ *******************************************************************************************************/
+CPU_BOOLEAN RingQ_MPSC_Push(RING_Q *p_q,
+                            void   *p_item)
+{
+  CPU_ADDR wr_ix;
+
+  RTOS_ASSERT_DBG((p_item != DEF_NULL), RTOS_ERR_NULL_PTR, DEF_FAIL);
+
+  do {                                                          // Reserve a slot (see Note #1).
+    wr_ix = p_q->WrIx;
+    if ((wr_ix - p_q->RdIx) > p_q->Mask) {                      // All slots reserved or not drained yet.
+      return (DEF_FAIL);
+    }
+  } while (CPU_CmpSwap(&p_q->WrIx, wr_ix, wr_ix + 1u) != DEF_YES);
+
+  CPU_WMB();
+  p_q->SlotTbl[wr_ix & p_q->Mask] = p_item;
+
+  return (DEF_OK);
+}
+
+/****************************************************************************************************//**
+ *                                                   RingQ_Pop()
+ *
+ * @brief    Removes the oldest item from a ring queue.
+ *
+ * @param    p_q     Pointer to ring queue.
+ *
+ * @return   Pointer to removed item, if any.
+ *           DEF_NULL, if the queue is empty.
+ *
+ * @note     (1) Only one task may pop from a given queue.
+ *
+ * @note     (2) The slot is emptied before 'RdIx' advances, so a producer never sees a free slot that
+ *               still holds an item.
+ *******************************************************************************************************/
+void *RingQ_Pop(RING_Q *p_q)
+{
+  void **p_slot;
+  void *p_item;
+
+  p_slot = &p_q->SlotTbl[p_q->RdIx & p_q->Mask];
+  p_item = *p_slot;
+  if (p_item == DEF_NULL) {
+    return (DEF_NULL);
+  }
+
+  CPU_RMB();
+  *p_slot = DEF_NULL;
+  CPU_MB();                                                     // See Note #2.
+  p_q->RdIx++;
+
+  return (p_item);
+}
+
+/****************************************************************************************************//**
+ *                                               RingQ_IsEmpty()
+ *
+ * @brief    Checks if a ring queue holds an item ready to be popped.
+ *
+ * @param    p_q     Pointer to ring queue.
+ *
+ * @return   DEF_YES, if RingQ_Pop() would return DEF_NULL.
+ *           DEF_NO,  otherwise.
+ *
+ * @note     (1) The result is only reliable when called by the consumer.
+ *******************************************************************************************************/
+CPU_BOOLEAN RingQ_IsEmpty(RING_Q *p_q)
+{
+  if (p_q->SlotTbl[p_q->RdIx & p_q->Mask] == DEF_NULL) {
+    return (DEF_YES);
+  }
+
+  return (DEF_NO);
+}
@@ -0,0 +1,96 @@
+/***************************************************************************//**
+ * @file
+ * @brief Common - Lock-Free Ring Queues
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.  This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               MODULE
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef  _RING_Q_PRIV_H_
+#define  _RING_Q_PRIV_H_
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               INCLUDE FILES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#include  <cpu/include/cpu.h>
+#include  <common/include/lib_def.h>
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                                   DEFINES
+ *
+ * Note(s) : (1) The producer and consumer indexes of a ring queue are kept RING_Q_CACHE_LINE_SIZE octets
+ *               apart so that, on cores with a data cache, a producer and a consumer running on
+ *               different bus masters do not keep invalidating each other's line. It MUST be greater
+ *               than sizeof(CPU_ADDR) and MAY be overridden from the compiler command line.
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef  RING_Q_CACHE_LINE_SIZE
+#define  RING_Q_CACHE_LINE_SIZE                 32u             // See Note #1.
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               DATA TYPES
+ *
+ * Note(s) : (1) A ring queue stores pointers in a power-of-two table of slots supplied by the caller. An
+ *               empty slot holds DEF_NULL, so DEF_NULL cannot be queued.
+ *
+ *           (2) Indexes are free-running and are masked when a slot is accessed.
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+typedef struct ring_q {
+  void       **SlotTbl;                                         // Tbl of slots (see Note #1).
+  CPU_SIZE_T Mask;                                              // Nbr of slots - 1.
+  CPU_ADDR   WrIx;                                              // Next slot to fill   (see Note #2).
+  CPU_INT08U WrPad[RING_Q_CACHE_LINE_SIZE - sizeof(CPU_ADDR)];  // Keep consumer's ix on its own line.
+  CPU_ADDR   RdIx;                                              // Next slot to drain  (see Note #2).
+} RING_Q;
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           FUNCTION PROTOTYPES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+void RingQ_Init(RING_Q     *p_q,
+                void       **p_slot_tbl,
+                CPU_SIZE_T slot_qty);
+
+CPU_BOOLEAN RingQ_SPSC_Push(RING_Q *p_q,
+                            void   *p_item);
+
+CPU_BOOLEAN RingQ_MPSC_Push(RING_Q *p_q,
+                            void   *p_item);
+
+void *RingQ_Pop(RING_Q *p_q);
+
+CPU_BOOLEAN RingQ_IsEmpty(RING_Q *p_q);
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               MODULE END
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#endif // End of private ring queue module include.
@@ -45,6 +45,7 @@
 
 #include  <common/source/rtos/rtos_utils_priv.h>
 #include  <common/source/kal/kal_priv.h>
+#include  <common/source/collections/ring_q_priv.h>
 #include  <common/include/lib_math.h>
 #include  <common/include/lib_mem.h>
 #include  <common/include/toolchains.h>
@@ -86,6 +87,7 @@ KAL_CPP_EXT const KAL_LOCK_HANDLE     KAL_LockHandleNull = KAL_OBJ_HANDLE_NULL;
 KAL_CPP_EXT const KAL_SEM_HANDLE      KAL_SemHandleNull = KAL_OBJ_HANDLE_NULL;
 KAL_CPP_EXT const KAL_TMR_HANDLE      KAL_TmrHandleNull = KAL_OBJ_HANDLE_NULL;
 KAL_CPP_EXT const KAL_Q_HANDLE        KAL_QHandleNull = KAL_OBJ_HANDLE_NULL;
+KAL_CPP_EXT const KAL_RING_Q_HANDLE   KAL_RingQHandleNull = KAL_OBJ_HANDLE_NULL;
 KAL_CPP_EXT const KAL_MON_HANDLE      KAL_MonHandleNull = KAL_OBJ_HANDLE_NULL;
 KAL_CPP_EXT const KAL_TASK_REG_HANDLE KAL_TaskRegHandleNull = KAL_OBJ_HANDLE_NULL;
 
@@ -114,6 +116,15 @@ typedef struct kal_lock {
 } KAL_LOCK;
 #endif
 
+//                                                                 ------------------ KAL RING Q TYPE -----------------
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+typedef struct kal_ring_q {
+  RING_Q   RingQ;                                               // Lock-free ring holding the msgs.
+  OS_SEM   Sem;                                                 // OS-III sem the consumer waits on when ring is empty.
+  CPU_ADDR IsWaiting;                                           // Set by the consumer before waiting on the sem.
+} KAL_RING_Q;
+#endif
+
 //                                                                 ------------------- KAL MON TYPE -------------------
 #if (OS_CFG_MON_EN == DEF_ENABLED)
 typedef struct kal_mon_arg_wrapper {
@@ -334,6 +345,12 @@ CPU_BOOLEAN KAL_FeatureQuery(KAL_FEATURE feature,
              #endif
       break;
 
+    case KAL_FEATURE_RING_Q:                                    // -------------------- RING QUEUES -------------------
+             #if (OS_CFG_SEM_EN == DEF_ENABLED)
+      is_en = DEF_YES;
+             #endif
+      break;
+
     default:
       break;
   }
@@ -1607,6 +1624,287 @@ void KAL_QPost(KAL_Q_HANDLE q_handle,
     #endif
 }
 
+/********************************************************************************************************
+ *                                           RING Q API FUNCTIONS
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                               KAL_RingQCreate()
+ *
+ * @brief    Create an empty ring queue.
+ *
+ * @param    p_name          Pointer to name of the ring queue.
+ *
+ * @param    max_msg_qty     Maximum number of message contained in the ring queue. MUST be a power of 2.
+ *
+ * @param    p_cfg           Pointer to KAL ring queue configuration structure.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_NOT_AVAIL
+ *                               - RTOS_ERR_OS_ILLEGAL_RUN_TIME
+ *                               - RTOS_ERR_SEG_OVF
+ *
+ * @return   Created ring queue handle.
+ *
+ * @note     (1) This function will initialize KAL if KAL has not yet been initialized.
+ *
+ * @note     (2) A ring queue hands messages from any number of tasks or ISRs to a single consumer task.
+ *               Messages are stored in a lock-free ring (see 'ring_q.c') and the kernel is only called
+ *               when the consumer has to wait for a message and when a producer wakes it up, instead
+ *               of once per message as with KAL_QPost()/KAL_QPend(). A message MUST NOT be DEF_NULL.
+ *******************************************************************************************************/
+KAL_RING_Q_HANDLE KAL_RingQCreate(const CPU_CHAR     *p_name,
+                                  KAL_MSG_QTY        max_msg_qty,
+                                  KAL_RING_Q_EXT_CFG *p_cfg,
+                                  RTOS_ERR           *p_err)
+{
+  KAL_RING_Q_HANDLE handle = KAL_RingQHandleNull;
+
+  //                                                               ---------------- VALIDATE ARGUMENTS ----------------
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, handle);
+
+  //                                                               Make sure no unsupported cfg recv.
+  RTOS_ASSERT_DBG_ERR_SET((p_cfg == DEF_NULL), *p_err, RTOS_ERR_NOT_SUPPORTED, handle);
+
+  RTOS_ASSERT_DBG_ERR_SET((MATH_IS_PWR2(max_msg_qty) == DEF_YES), *p_err, RTOS_ERR_INVALID_ARG, handle);
+
+  if (KAL_DataPtr == DEF_NULL) {
+    KAL_Init(p_err);                                            // KAL initialization (see Note #1).
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      return(handle);
+    }
+  }
+
+    #if (OS_CFG_SEM_EN == DEF_ENABLED)
+  {
+    MEM_SEG    *p_mem_seg;
+    KAL_RING_Q *p_ring_q;
+    void       **p_slot_tbl;
+
+    p_mem_seg = Common_MemSegPtrGet();
+
+    p_ring_q = (KAL_RING_Q *)Mem_SegAlloc("KAL Ring Q",
+                                          p_mem_seg,
+                                          sizeof(KAL_RING_Q),
+                                          p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      return (handle);
+    }
+
+    p_slot_tbl = (void **)Mem_SegAlloc("KAL Ring Q Slots",
+                                       p_mem_seg,
+                                       sizeof(void *) * max_msg_qty,
+                                       p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      LOG_DBG(("Ring Q slots allocation failed. Memory allocated for Ring Q is lost."));
+      return (handle);
+    }
+
+    RingQ_Init(&p_ring_q->RingQ,
+               p_slot_tbl,
+               max_msg_qty);
+    p_ring_q->IsWaiting = DEF_NO;
+
+    OSSemCreate(&p_ring_q->Sem,
+                (CPU_CHAR *)p_name,
+                0u,
+                p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) == RTOS_ERR_NONE) {
+      handle.RingQObjPtr = (void *)p_ring_q;
+      LOG_VRB(("KAL_RingQCreate call successful."));
+    } else {
+      LOG_DBG(("Call to OSSemCreate failed with err: ", RTOS_ERR_LOG_ARG_GET(*p_err), ". Memory allocated for Ring Q is lost."));
+    }
+
+    return (handle);
+  }
+    #else
+  PP_UNUSED_PARAM(p_name);
+  PP_UNUSED_PARAM(max_msg_qty);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NOT_AVAIL);
+
+  return (handle);
+    #endif
+}
+
+/****************************************************************************************************//**
+ *                                               KAL_RingQPend()
+ *
+ * @brief    Pend/get first message of ring queue.
+ *
+ * @param    ring_q_handle   Handle of the ring queue to pend on.
+ *
+ * @param    opt             Options available:
+ *                               - KAL_OPT_PEND_NONE:          block until timeout expires or message is available.
+ *                               - KAL_OPT_PEND_BLOCKING:      block until timeout expires or message is available.
+ *                               - KAL_OPT_PEND_NON_BLOCKING:  return immediately with or without message.
+ *
+ * @param    timeout_ms      Timeout, in milliseconds. A value of 0 will never timeout.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error code(s)
+ *                           from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_NOT_AVAIL
+ *                               - RTOS_ERR_WOULD_BLOCK
+ *                               - RTOS_ERR_OS_SCHED_LOCKED
+ *                               - RTOS_ERR_ABORT
+ *                               - RTOS_ERR_TIMEOUT
+ *
+ * @return   Pointer to message obtained, if any, if no error.
+ *           Null pointer, otherwise.
+ *
+ * @note     (1) Only one task may pend on a given ring queue.
+ *
+ * @note     (2) The consumer flags itself as waiting and checks the ring once more before pending on the
+ *               semaphore, so a message posted in between is either found by that check or followed by
+ *               a semaphore post. When both happen, the next pend returns from the semaphore with no
+ *               message and simply waits again, starting a new timeout.
+ *******************************************************************************************************/
+void *KAL_RingQPend(KAL_RING_Q_HANDLE ring_q_handle,
+                    KAL_OPT           opt,
+                    CPU_INT32U        timeout_ms,
+                    RTOS_ERR          *p_err)
+{
+  //                                                               ---------------- VALIDATE ARGUMENTS ----------------
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, DEF_NULL);
+
+  RTOS_ASSERT_DBG_ERR_SET((KAL_RING_Q_HANDLE_IS_NULL(ring_q_handle) == DEF_NO), *p_err, RTOS_ERR_NULL_PTR, DEF_NULL);
+
+  RTOS_ASSERT_DBG_ERR_SET((DEF_BIT_IS_SET_ANY(opt, (KAL_OPT)(~(KAL_OPT_PEND_NONE | KAL_OPT_PEND_NON_BLOCKING))) == DEF_NO), *p_err, RTOS_ERR_INVALID_ARG, DEF_NULL);
+
+    #if (OS_CFG_SEM_EN == DEF_ENABLED)
+  {
+    KAL_RING_Q *p_ring_q;
+    void       *p_msg;
+    CPU_INT32U timeout_ticks;
+
+    p_ring_q = (KAL_RING_Q *)ring_q_handle.RingQObjPtr;
+
+    if (timeout_ms != KAL_TIMEOUT_INFINITE) {
+      timeout_ticks = KAL_msToTicks(timeout_ms);
+    } else {
+      timeout_ticks = 0u;
+    }
+
+    while (DEF_ON) {
+      p_msg = RingQ_Pop(&p_ring_q->RingQ);
+      if (p_msg != DEF_NULL) {
+        break;
+      }
+
+      if (DEF_BIT_IS_SET(opt, KAL_OPT_PEND_NON_BLOCKING) == DEF_YES) {
+        RTOS_ERR_SET(*p_err, RTOS_ERR_WOULD_BLOCK);
+        return (DEF_NULL);
+      }
+
+      p_ring_q->IsWaiting = DEF_YES;                            // See Note #2.
+      CPU_MB();
+      p_msg = RingQ_Pop(&p_ring_q->RingQ);
+      if (p_msg != DEF_NULL) {
+        (void)CPU_CmpSwap(&p_ring_q->IsWaiting, DEF_YES, DEF_NO);
+        break;
+      }
+
+      (void)OSSemPend(&p_ring_q->Sem,
+                      timeout_ticks,
+                      OS_OPT_PEND_BLOCKING,
+                      DEF_NULL,
+                      p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        (void)CPU_CmpSwap(&p_ring_q->IsWaiting, DEF_YES, DEF_NO);
+        LOG_DBG(("Call to OSSemPend failed with err: ", RTOS_ERR_LOG_ARG_GET(*p_err)));
+        return (DEF_NULL);
+      }
+    }
+
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+    return (p_msg);
+  }
+    #else
+  PP_UNUSED_PARAM(ring_q_handle);
+  PP_UNUSED_PARAM(opt);
+  PP_UNUSED_PARAM(timeout_ms);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NOT_AVAIL);
+
+  return (DEF_NULL);
+    #endif
+}
+
+/****************************************************************************************************//**
+ *                                               KAL_RingQPost()
+ *
+ * @brief    Post message on ring queue.
+ *
+ * @param    ring_q_handle   Handle of the ring queue on which to post message.
+ *
+ * @param    p_msg           Pointer to message to post. MUST NOT be DEF_NULL.
+ *
+ * @param    opt             Options available:
+ *                           KAL_OPT_POST_NONE:     wake the consumer task if it is waiting.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error code(s)
+ *                           from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_NOT_AVAIL
+ *                               - RTOS_ERR_WOULD_OVF
+ *
+ * @note     (1) This function may be called from any number of tasks and ISRs. The semaphore is only
+ *               posted by the producer that finds the consumer waiting.
+ *******************************************************************************************************/
+void KAL_RingQPost(KAL_RING_Q_HANDLE ring_q_handle,
+                   void              *p_msg,
+                   KAL_OPT           opt,
+                   RTOS_ERR          *p_err)
+{
+  //                                                               ---------------- VALIDATE ARGUMENTS ----------------
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((KAL_RING_Q_HANDLE_IS_NULL(ring_q_handle) == DEF_NO), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((p_msg != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  RTOS_ASSERT_DBG_ERR_SET((opt == KAL_OPT_POST_NONE), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+    #if (OS_CFG_SEM_EN == DEF_ENABLED)
+  {
+    KAL_RING_Q *p_ring_q;
+
+    p_ring_q = (KAL_RING_Q *)ring_q_handle.RingQObjPtr;
+
+    if (RingQ_MPSC_Push(&p_ring_q->RingQ, p_msg) != DEF_OK) {
+      RTOS_ERR_SET(*p_err, RTOS_ERR_WOULD_OVF);
+      return;
+    }
+
+    CPU_MB();
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    if ((p_ring_q->IsWaiting == DEF_YES)                        // Wake consumer only once (see Note #1).
+        && (CPU_CmpSwap(&p_ring_q->IsWaiting, DEF_YES, DEF_NO) == DEF_YES)) {
+      (void)OSSemPost(&p_ring_q->Sem,
+                      OS_OPT_POST_1,
+                      p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        LOG_DBG(("Call to OSSemPost failed with err: ", RTOS_ERR_LOG_ARG_GET(*p_err)));
+      }
+    }
+
+    return;
+  }
+    #else
+  PP_UNUSED_PARAM(ring_q_handle);
+  PP_UNUSED_PARAM(p_msg);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NOT_AVAIL);
+
+  return;
+    #endif
+}
+
 /********************************************************************************************************
  *                                           MON API FUNCTIONS
  *******************************************************************************************************/
@@ -61,6 +61,7 @@
 #define  KAL_LOCK_HANDLE_NULL                   KAL_OBJ_HANDLE_NULL
 #define  KAL_SEM_HANDLE_NULL                    KAL_OBJ_HANDLE_NULL
 #define  KAL_Q_HANDLE_NULL                      KAL_OBJ_HANDLE_NULL
+#define  KAL_RING_Q_HANDLE_NULL                 KAL_OBJ_HANDLE_NULL
 #define  KAL_MON_HANDLE_NULL                    KAL_OBJ_HANDLE_NULL
 #define  KAL_TASK_REG_HANDLE_NULL               KAL_OBJ_HANDLE_NULL
 
@@ -224,6 +225,10 @@ typedef struct kal_q_handle {                                   // -------------
   void *QObjPtr;
 } KAL_Q_HANDLE;
 
+typedef struct kal_ring_q_handle {                              // ------------------- RING Q HANDLE ------------------
+  void *RingQObjPtr;
+} KAL_RING_Q_HANDLE;
+
 typedef struct kal_mon_handle {
   void *MonObjPtr;
 } KAL_MON_HANDLE;
@@ -256,6 +261,10 @@ typedef struct kal_q_ext_cfg {                                  // -------------
   CPU_INT32U Rsvd;                                              // Rsvd for future use.
 } KAL_Q_EXT_CFG;
 
+typedef struct kal_ring_q_ext_cfg {                             // ----------------- RING Q EXT CFG -------------------
+  CPU_INT32U Rsvd;                                              // Rsvd for future use.
+} KAL_RING_Q_EXT_CFG;
+
 typedef struct kal_mon_ext_cfg {                                // ------------------- MON EXT CFG --------------------
   CPU_INT32U Rsvd;                                              // Rsvd for future use.
 } KAL_MON_EXT_CFG;
@@ -305,7 +314,9 @@ typedef enum kal_feature {
   KAL_FEATURE_MON,                                              // Mon creation and exec.
   KAL_FEATURE_MON_DEL,                                          // Mon deletion.
 
-  KAL_FEATURE_CPU_USAGE_GET                                     // Get OS overall CPU usage.
+  KAL_FEATURE_CPU_USAGE_GET,                                    // Get OS overall CPU usage.
+
+  KAL_FEATURE_RING_Q                                            // Ring Q creation, post and pend.
 } KAL_FEATURE;
 
 /********************************************************************************************************
@@ -319,6 +330,7 @@ extern const KAL_TASK_HANDLE     KAL_TaskHandleNull;
 extern const KAL_LOCK_HANDLE     KAL_LockHandleNull;
 extern const KAL_SEM_HANDLE      KAL_SemHandleNull;
 extern const KAL_Q_HANDLE        KAL_QHandleNull;
+extern const KAL_RING_Q_HANDLE   KAL_RingQHandleNull;
 extern const KAL_MON_HANDLE      KAL_MonHandleNull;
 extern const KAL_TASK_REG_HANDLE KAL_TaskRegHandleNull;
 
@@ -332,6 +344,7 @@ extern const KAL_TASK_REG_HANDLE KAL_TaskRegHandleNull;
 #define  KAL_LOCK_HANDLE_IS_NULL(lock_handle)            (((lock_handle).LockObjPtr == KAL_LockHandleNull.LockObjPtr)       ? DEF_YES : DEF_NO)
 #define  KAL_SEM_HANDLE_IS_NULL(sem_handle)              (((sem_handle).SemObjPtr == KAL_SemHandleNull.SemObjPtr)         ? DEF_YES : DEF_NO)
 #define  KAL_Q_HANDLE_IS_NULL(q_handle)                  (((q_handle).QObjPtr == KAL_QHandleNull.QObjPtr)             ? DEF_YES : DEF_NO)
+#define  KAL_RING_Q_HANDLE_IS_NULL(ring_q_handle)        (((ring_q_handle).RingQObjPtr == KAL_RingQHandleNull.RingQObjPtr) ? DEF_YES : DEF_NO)
 #define  KAL_MON_HANDLE_IS_NULL(mon_handle)              (((mon_handle).MonObjPtr == KAL_MonHandleNull.MonObjPtr)         ? DEF_YES : DEF_NO)
 #define  KAL_TMR_HANDLE_IS_NULL(tmr_handle)              (((tmr_handle).TmrObjPtr == KAL_TmrHandleNull.TmrObjPtr)         ? DEF_YES : DEF_NO)
 #define  KAL_TASK_REG_HANDLE_IS_NULL(task_reg_handle)    (((task_reg_handle).TaskRegObjPtr == KAL_TaskRegHandleNull.TaskRegObjPtr) ? DEF_YES : DEF_NO)
@@ -451,6 +464,25 @@ void KAL_QPost(KAL_Q_HANDLE q_handle,
                KAL_OPT      opt,
                RTOS_ERR     *p_err);
 
+/********************************************************************************************************
+ *                                               RING QS
+ *******************************************************************************************************/
+
+KAL_RING_Q_HANDLE KAL_RingQCreate(const CPU_CHAR     *p_name,
+                                  KAL_MSG_QTY        max_msg_qty,
+                                  KAL_RING_Q_EXT_CFG *p_cfg,
+                                  RTOS_ERR           *p_err);
+
+void *KAL_RingQPend(KAL_RING_Q_HANDLE ring_q_handle,
+                    KAL_OPT           opt,
+                    CPU_INT32U        timeout,
+                    RTOS_ERR          *p_err);
+
+void KAL_RingQPost(KAL_RING_Q_HANDLE ring_q_handle,
+                   void              *p_msg,
+                   KAL_OPT           opt,
+                   RTOS_ERR          *p_err);
+
 /********************************************************************************************************
  *                                                   MON
  *******************************************************************************************************/
@@ -56,6 +56,38 @@
 #define  MEM_DYN_POOL_OPT_HW                DEF_BIT_00
 #define  MEM_DYN_POOL_OPT_PERSISTENT        DEF_BIT_01
 
+/********************************************************************************************************
+ *                                       MEMORY WORD ACCESS DEFINES
+ *
+ * Note(s) : (1) MEM_WORD_SIZE_MIN is the minimum buffer size, in octets, for which Mem_Set(), Mem_Copy(),
+ *               Mem_Move() and Mem_Cmp() use 'CPU_ALIGN'-sized words. Shorter buffers are processed by
+ *               octets, which is faster than aligning them.
+ *
+ *           (2) MEM_WORD_MERGE() returns the 'CPU_ALIGN'-sized word starting 'shift' bits into 'lo', with
+ *               its last octets taken from the following word 'hi'. 'shift' MUST NOT be 0.
+ *******************************************************************************************************/
+
+#define  MEM_WORD_SIZE_MIN                  (2u * sizeof(CPU_ALIGN))
+
+#define  MEM_WORD_NBR_BITS                  (sizeof(CPU_ALIGN) * DEF_OCTET_NBR_BITS)
+
+#if (CPU_CFG_ENDIAN_TYPE == CPU_ENDIAN_TYPE_BIG)
+#define  MEM_WORD_MERGE(lo, hi, shift)      (((lo) << (shift)) | ((hi) >> (MEM_WORD_NBR_BITS - (shift))))
+#else
+#define  MEM_WORD_MERGE(lo, hi, shift)      (((lo) >> (shift)) | ((hi) << (MEM_WORD_NBR_BITS - (shift))))
+#endif
+
+/********************************************************************************************************
+ *                                       SLAB ALLOCATOR DEFINES
+ *
+ * Note(s) : (1) MEM_SLAB_HDR_SIZE is the size of the header at the start of each slab, which holds a
+ *               pointer to the slab's size class. It is rounded up so that blocks stay 'CPU_ALIGN'-aligned.
+ *******************************************************************************************************/
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+#define  MEM_SLAB_HDR_SIZE                  MATH_ROUND_INC_UP_PWR2(sizeof(void *), sizeof(CPU_ALIGN))
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           LOCAL DATA TYPES
@@ -85,6 +117,16 @@ MEM_SEG Mem_SegHeap = MEM_SEG_INIT("Heap", (CPU_ADDR)LIB_MEM_CFG_HEAP_BASE_ADDR,
 
 MEM_SEG *Mem_SegHeadPtr;                                        // Ptr to head of seg list.
 
+#if ((LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED) \
+  && (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+static MEM_DYN_POOL_MAG *Mem_DynPoolMagHeadPtr = DEF_NULL;      // Ptr to head of magazine list.
+#endif
+
+#if ((LIB_MEM_CFG_SLAB_EN == DEF_ENABLED) \
+  && (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED))
+static MEM_SLAB *Mem_SlabHeadPtr = DEF_NULL;                    // Ptr to head of slab allocator list.
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                       LOCAL FUNCTION PROTOTYPES
@@ -134,6 +176,19 @@ static void Mem_SegAllocTrackCritical(const CPU_CHAR *p_name,
                                       RTOS_ERR       *p_err);
 #endif
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+static CPU_SIZE_T Mem_DynPoolMagRefill(MEM_DYN_POOL_MAG *p_mag);
+
+static void Mem_DynPoolMagDrain(MEM_DYN_POOL_MAG *p_mag,
+                                CPU_SIZE_T       blk_nbr);
+#endif
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+static void Mem_SlabGrow(MEM_SLAB       *p_slab,
+                         MEM_SLAB_CLASS *p_class,
+                         RTOS_ERR       *p_err);
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           GLOBAL FUNCTIONS
@@ -210,6 +265,9 @@ void Mem_Clr(void       *p_mem,
  *               Modulo arithmetic in ANSI-C REQUIREs operations are performed on integer values, so
  *               address values MUST be cast to an appropriately-sized integer value before any
  *               'mem_align_mod' arithmetic operation.
+ *
+ * @note     (4) Buffers shorter than MEM_WORD_SIZE_MIN octets are filled by octets only. Longer buffers
+ *               are filled 4 'CPU_ALIGN'-sized words per loop iteration.
  *******************************************************************************************************/
 
 #if (LIB_MEM_CFG_STD_C_LIB_EN == DEF_DISABLED)
@@ -229,33 +287,42 @@ void Mem_Set(void       *p_mem,
     return;
   }
 
-  data_align = 0u;
-  for (i = 0u; i < sizeof(CPU_ALIGN); i++) {                    // Fill each data_align octet with data val.
-    data_align <<= DEF_OCTET_NBR_BITS;
-    data_align |= (CPU_ALIGN)data_val;
-  }
+  size_rem = size;
+  p_mem_08 = (CPU_INT08U *)p_mem;
 
-  size_rem = size;                                              // See Note #3.
-  mem_align_mod = (CPU_INT08U)((CPU_ADDR)p_mem % sizeof(CPU_ALIGN));
+  if (size_rem >= MEM_WORD_SIZE_MIN) {                          // See Note #4.
+    data_align = 0u;
+    for (i = 0u; i < sizeof(CPU_ALIGN); i++) {                  // Fill each data_align octet with data val.
+      data_align <<= DEF_OCTET_NBR_BITS;
+      data_align |= (CPU_ALIGN)data_val;
+    }
+    //                                                             See Note #3.
+    mem_align_mod = (CPU_DATA)((CPU_ADDR)p_mem_08 % sizeof(CPU_ALIGN));
+    if (mem_align_mod != 0u) {                                  // If leading octets avail,                   ...
+      while (mem_align_mod < sizeof(CPU_ALIGN)) {               // ... start mem buf fill with leading octets ...
+        *p_mem_08++ = data_val;                                 // ... until next CPU_ALIGN word boundary.
+        size_rem -= sizeof(CPU_INT08U);
+        mem_align_mod++;
+      }
+    }
 
-  p_mem_08 = (CPU_INT08U *)p_mem;
-  if (mem_align_mod != 0u) {                                    // If leading octets avail,                   ...
-    i = mem_align_mod;
-    while ((size_rem > 0)                                       // ... start mem buf fill with leading octets ...
-           && (i < sizeof(CPU_ALIGN))) {                        // ... until next CPU_ALIGN word boundary.
-      *p_mem_08++ = data_val;
-      size_rem -= sizeof(CPU_INT08U);
-      i++;
+    p_mem_align = (CPU_ALIGN *)p_mem_08;                        // See Note #2.
+    while (size_rem >= (4u * sizeof(CPU_ALIGN))) {              // While 4 words or more rem, fill 4 words at once.
+      p_mem_align[0u] = data_align;
+      p_mem_align[1u] = data_align;
+      p_mem_align[2u] = data_align;
+      p_mem_align[3u] = data_align;
+      p_mem_align += 4u;
+      size_rem -= 4u * sizeof(CPU_ALIGN);
+    }
+    while (size_rem >= sizeof(CPU_ALIGN)) {                     // Fill rem words.
+      *p_mem_align++ = data_align;
+      size_rem -= sizeof(CPU_ALIGN);
     }
-  }
 
-  p_mem_align = (CPU_ALIGN *)p_mem_08;                          // See Note #2.
-  while (size_rem >= sizeof(CPU_ALIGN)) {                       // While mem buf aligned on CPU_ALIGN word boundaries,
-    *p_mem_align++ = data_align;                                // ... fill mem buf with    CPU_ALIGN-sized data.
-    size_rem -= sizeof(CPU_ALIGN);
+    p_mem_08 = (CPU_INT08U *)p_mem_align;
   }
 
-  p_mem_08 = (CPU_INT08U *)p_mem_align;
   while (size_rem > 0) {                                        // Finish mem buf fill with trailing octets.
     *p_mem_08++ = data_val;
     size_rem -= sizeof(CPU_INT08U);
@@ -304,6 +371,14 @@ void Mem_Set(void       *p_mem,
  *               Modulo arithmetic in ANSI-C REQUIRE operations are performed on integer values, so
  *               address values MUST be cast to an appropriately-sized integer value before any
  *               'mem_align_mod' arithmetic operation.
+ *
+ * @note     (5) Once the destination is aligned, the source may still be misaligned (e.g. a buffer
+ *               offset by 2 octets for an Ethernet header). The source is then read by aligned words
+ *               and each destination word is merged from two consecutive shifted source words. The
+ *               first and last source words read may hold octets outside of the source buffer, but
+ *               always within the 'CPU_ALIGN' words that hold the buffer.
+ *
+ * @note     (6) Buffers shorter than MEM_WORD_SIZE_MIN octets are copied by octets only.
  *******************************************************************************************************/
 
 #if ((LIB_MEM_CFG_STD_C_LIB_EN == DEF_DISABLED) \
@@ -316,12 +391,13 @@ LIB_MEM_COPY_FNCT_PREFIX void Mem_Copy(void       *p_dest,
   CPU_SIZE_T       mem_gap_octets;
   CPU_ALIGN        *p_mem_align_dest;
   const CPU_ALIGN  *p_mem_align_src;
+  CPU_ALIGN        data_lo;
+  CPU_ALIGN        data_hi;
   CPU_INT08U       *p_mem_08_dest;
   const CPU_INT08U *p_mem_08_src;
-  CPU_DATA         i;
   CPU_DATA         mem_align_mod_dest;
   CPU_DATA         mem_align_mod_src;
-  CPU_BOOLEAN      mem_aligned;
+  CPU_DATA         shift;
 
   if ((size < 1)                                                // See Note #1.
       || (p_dest == DEF_NULL)
@@ -336,38 +412,55 @@ LIB_MEM_COPY_FNCT_PREFIX void Mem_Copy(void       *p_dest,
 
   mem_gap_octets = (CPU_SIZE_T)(p_mem_08_src - p_mem_08_dest);
 
-  if (mem_gap_octets >= sizeof(CPU_ALIGN)) {                    // Avoid bufs overlap.
+  if ((mem_gap_octets >= sizeof(CPU_ALIGN))                     // Avoid bufs overlap.
+      && (size_rem >= MEM_WORD_SIZE_MIN)) {                     // See Note #6.
                                                                 // See Note #4.
-    mem_align_mod_dest = (CPU_INT08U)((CPU_ADDR)p_mem_08_dest % sizeof(CPU_ALIGN));
-    mem_align_mod_src = (CPU_INT08U)((CPU_ADDR)p_mem_08_src  % sizeof(CPU_ALIGN));
-
-    mem_aligned = (mem_align_mod_dest == mem_align_mod_src) ? DEF_YES : DEF_NO;
-
-    if (mem_aligned == DEF_YES) {
-      //                                                           If mem bufs' alignment offset equal, optimize copy for mem buf alignment.
-      if (mem_align_mod_dest != 0u) {                           // If leading octets avail,                   ...
-        i = mem_align_mod_dest;
-        while ((size_rem > 0)                                   // ... start mem buf copy with leading octets ...
-               && (i < sizeof(CPU_ALIGN))) {                    // ... until next CPU_ALIGN word boundary.
-          *p_mem_08_dest++ = *p_mem_08_src++;
-          size_rem -= sizeof(CPU_INT08U);
-          i++;
-        }
+    mem_align_mod_dest = (CPU_DATA)((CPU_ADDR)p_mem_08_dest % sizeof(CPU_ALIGN));
+    if (mem_align_mod_dest != 0u) {                             // If leading octets avail,                   ...
+      while (mem_align_mod_dest < sizeof(CPU_ALIGN)) {          // ... start mem buf copy with leading octets ...
+        *p_mem_08_dest++ = *p_mem_08_src++;                     // ... until dest on next CPU_ALIGN word boundary.
+        size_rem -= sizeof(CPU_INT08U);
+        mem_align_mod_dest++;
       }
+    }
 
-      p_mem_align_dest = (CPU_ALIGN *)p_mem_08_dest;            // See Note #3.
+    p_mem_align_dest = (CPU_ALIGN *)p_mem_08_dest;              // See Note #3.
+    mem_align_mod_src = (CPU_DATA)((CPU_ADDR)p_mem_08_src % sizeof(CPU_ALIGN));
+    if (mem_align_mod_src == 0u) {                              // If src also aligned, copy words.
       p_mem_align_src = (const CPU_ALIGN *)p_mem_08_src;
-      while (size_rem >= sizeof(CPU_ALIGN)) {                   // While mem bufs aligned on CPU_ALIGN word boundaries,
-        *p_mem_align_dest++ = *p_mem_align_src++;               // ... copy psrc to pdest with CPU_ALIGN-sized words.
+      while (size_rem >= (4u * sizeof(CPU_ALIGN))) {            // While 4 words or more rem, copy 4 words at once.
+        p_mem_align_dest[0u] = p_mem_align_src[0u];
+        p_mem_align_dest[1u] = p_mem_align_src[1u];
+        p_mem_align_dest[2u] = p_mem_align_src[2u];
+        p_mem_align_dest[3u] = p_mem_align_src[3u];
+        p_mem_align_dest += 4u;
+        p_mem_align_src += 4u;
+        size_rem -= 4u * sizeof(CPU_ALIGN);
+      }
+      while (size_rem >= sizeof(CPU_ALIGN)) {                   // Copy rem words.
+        *p_mem_align_dest++ = *p_mem_align_src++;
         size_rem -= sizeof(CPU_ALIGN);
       }
 
-      p_mem_08_dest = (CPU_INT08U *)p_mem_align_dest;
       p_mem_08_src = (const CPU_INT08U *)p_mem_align_src;
+    } else {                                                    // Else, merge shifted src words (see Note #5).
+      p_mem_align_src = (const CPU_ALIGN *)(p_mem_08_src - mem_align_mod_src);
+      shift = mem_align_mod_src * DEF_OCTET_NBR_BITS;
+      data_lo = *p_mem_align_src++;
+      while (size_rem >= sizeof(CPU_ALIGN)) {
+        data_hi = *p_mem_align_src++;
+        *p_mem_align_dest++ = MEM_WORD_MERGE(data_lo, data_hi, shift);
+        data_lo = data_hi;
+        size_rem -= sizeof(CPU_ALIGN);
+      }
+
+      p_mem_08_src = ((const CPU_INT08U *)p_mem_align_src - sizeof(CPU_ALIGN)) + mem_align_mod_src;
     }
+
+    p_mem_08_dest = (CPU_INT08U *)p_mem_align_dest;
   }
 
-  while (size_rem > 0) {                                        // For unaligned mem bufs or trailing octets, ...
+  while (size_rem > 0) {                                        // For short mem bufs or trailing octets, ...
     *p_mem_08_dest++ = *p_mem_08_src++;                         // ... copy psrc to pdest by octets.
     size_rem -= sizeof(CPU_INT08U);
   }
@@ -401,6 +494,10 @@ LIB_MEM_COPY_FNCT_PREFIX void Mem_Copy(void       *p_dest,
  *               Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values, so
  *               address values MUST be cast to an appropriately-sized integer value before any
  *               'mem_align_mod' arithmetic operation.
+ *
+ * @note     (5) When the destination is at a higher address than the source, the buffers are copied
+ *               from their end. A misaligned source is handled as in Mem_Copy() (see 'Mem_Copy()
+ *               Note #5'), merging shifted source words towards lower addresses.
  *******************************************************************************************************/
 
 #if (LIB_MEM_CFG_STD_C_LIB_EN == DEF_DISABLED)
@@ -412,12 +509,13 @@ void Mem_Move(void       *p_dest,
   CPU_SIZE_T       mem_gap_octets;
   CPU_ALIGN        *p_mem_align_dest;
   const CPU_ALIGN  *p_mem_align_src;
+  CPU_ALIGN        data_lo;
+  CPU_ALIGN        data_hi;
   CPU_INT08U       *p_mem_08_dest;
   const CPU_INT08U *p_mem_08_src;
-  CPU_INT08S       i;
   CPU_DATA         mem_align_mod_dest;
   CPU_DATA         mem_align_mod_src;
-  CPU_BOOLEAN      mem_aligned;
+  CPU_DATA         shift;
 
   if ((size < 1)                                                // See Note #1.
       || (p_dest == DEF_NULL)
@@ -433,46 +531,60 @@ void Mem_Move(void       *p_dest,
   }
 
   size_rem = size;
-
-  p_mem_08_dest = (CPU_INT08U *)p_dest + size - 1;
-  p_mem_08_src = (const CPU_INT08U *)p_src  + size - 1;
+  //                                                               Start @ end of mem bufs (see Note #5).
+  p_mem_08_dest = (CPU_INT08U *)p_dest + size;
+  p_mem_08_src = (const CPU_INT08U *)p_src  + size;
 
   mem_gap_octets = (CPU_SIZE_T)(p_mem_08_dest - p_mem_08_src);
 
-  if (mem_gap_octets >= sizeof(CPU_ALIGN)) {                    // Avoid bufs overlap.
+  if ((mem_gap_octets >= sizeof(CPU_ALIGN))                     // Avoid bufs overlap.
+      && (size_rem >= MEM_WORD_SIZE_MIN)) {
                                                                 // See Note #4.
-    mem_align_mod_dest = (CPU_INT08U)((CPU_ADDR)p_mem_08_dest % sizeof(CPU_ALIGN));
-    mem_align_mod_src = (CPU_INT08U)((CPU_ADDR)p_mem_08_src  % sizeof(CPU_ALIGN));
-
-    mem_aligned = (mem_align_mod_dest == mem_align_mod_src) ? DEF_YES : DEF_NO;
-
-    if (mem_aligned == DEF_YES) {
-      //                                                           If mem bufs' alignment offset equal, optimize copy for mem buf alignment.
-      if (mem_align_mod_dest != (sizeof(CPU_ALIGN) - 1)) {      // If leading octets avail,                   ...
-        i = (CPU_INT08S)mem_align_mod_dest;
-        while ((size_rem > 0)                                   // ... start mem buf copy with leading octets ...
-               && (i >= 0)) {                                   // ... until next CPU_ALIGN word boundary.
-          *p_mem_08_dest-- = *p_mem_08_src--;
-          size_rem -= sizeof(CPU_INT08U);
-          i--;
-        }
+    mem_align_mod_dest = (CPU_DATA)((CPU_ADDR)p_mem_08_dest % sizeof(CPU_ALIGN));
+    while (mem_align_mod_dest > 0u) {                           // Start mem buf copy with trailing octets ...
+      *--p_mem_08_dest = *--p_mem_08_src;                       // ... until dest on prev CPU_ALIGN word boundary.
+      size_rem -= sizeof(CPU_INT08U);
+      mem_align_mod_dest--;
+    }
+
+    p_mem_align_dest = (CPU_ALIGN *)p_mem_08_dest;              // See Note #3.
+    mem_align_mod_src = (CPU_DATA)((CPU_ADDR)p_mem_08_src % sizeof(CPU_ALIGN));
+    if (mem_align_mod_src == 0u) {                              // If src also aligned, copy words.
+      p_mem_align_src = (const CPU_ALIGN *)p_mem_08_src;
+      while (size_rem >= (4u * sizeof(CPU_ALIGN))) {            // While 4 words or more rem, copy 4 words at once.
+        p_mem_align_dest -= 4u;
+        p_mem_align_src -= 4u;
+        p_mem_align_dest[3u] = p_mem_align_src[3u];
+        p_mem_align_dest[2u] = p_mem_align_src[2u];
+        p_mem_align_dest[1u] = p_mem_align_src[1u];
+        p_mem_align_dest[0u] = p_mem_align_src[0u];
+        size_rem -= 4u * sizeof(CPU_ALIGN);
+      }
+      while (size_rem >= sizeof(CPU_ALIGN)) {                   // Copy rem words.
+        *--p_mem_align_dest = *--p_mem_align_src;
+        size_rem -= sizeof(CPU_ALIGN);
       }
 
-      //                                                           See Note #3.
-      p_mem_align_dest = (CPU_ALIGN *)(((CPU_INT08U *)p_mem_08_dest - sizeof(CPU_ALIGN)) + 1);
-      p_mem_align_src = (const CPU_ALIGN *)(((CPU_INT08U *)p_mem_08_src  - sizeof(CPU_ALIGN)) + 1);
-      while (size_rem >= sizeof(CPU_ALIGN)) {                   // While mem bufs aligned on CPU_ALIGN word boundaries,
-        *p_mem_align_dest-- = *p_mem_align_src--;               // ... copy psrc to pdest with CPU_ALIGN-sized words.
+      p_mem_08_src = (const CPU_INT08U *)p_mem_align_src;
+    } else {                                                    // Else, merge shifted src words (see Note #5).
+      p_mem_align_src = (const CPU_ALIGN *)(p_mem_08_src - mem_align_mod_src);
+      shift = mem_align_mod_src * DEF_OCTET_NBR_BITS;
+      data_hi = *p_mem_align_src;
+      while (size_rem >= sizeof(CPU_ALIGN)) {
+        data_lo = *--p_mem_align_src;
+        *--p_mem_align_dest = MEM_WORD_MERGE(data_lo, data_hi, shift);
+        data_hi = data_lo;
         size_rem -= sizeof(CPU_ALIGN);
       }
 
-      p_mem_08_dest = (CPU_INT08U *)p_mem_align_dest + sizeof(CPU_ALIGN) - 1;
-      p_mem_08_src = (const CPU_INT08U *)p_mem_align_src  + sizeof(CPU_ALIGN) - 1;
+      p_mem_08_src = (const CPU_INT08U *)p_mem_align_src + mem_align_mod_src;
     }
+
+    p_mem_08_dest = (CPU_INT08U *)p_mem_align_dest;
   }
 
-  while (size_rem > 0) {                                        // For unaligned mem bufs or trailing octets, ...
-    *p_mem_08_dest-- = *p_mem_08_src--;                         // ... copy psrc to pdest by octets.
+  while (size_rem > 0) {                                        // For short mem bufs or leading octets, ...
+    *--p_mem_08_dest = *--p_mem_08_src;                         // ... copy psrc to pdest by octets.
     size_rem -= sizeof(CPU_INT08U);
   }
 }
@@ -511,6 +623,9 @@ void Mem_Move(void       *p_dest,
  *               Modulo arithmetic in ANSI-C REQUIREs operations performed on integer values, so
  *               address values MUST be cast to an appropriately-sized integer value before any
  *               'mem_align_mod' arithmetic operation.
+ *
+ * @note     (5) Once the first buffer is aligned, a misaligned second buffer is read by aligned words
+ *               and merged as in Mem_Move() (see 'Mem_Move() Note #5').
  *******************************************************************************************************/
 
 #if (LIB_MEM_CFG_STD_C_LIB_EN == DEF_DISABLED)
@@ -519,14 +634,15 @@ CPU_BOOLEAN Mem_Cmp(const void *p1_mem,
                     CPU_SIZE_T size)
 {
   CPU_SIZE_T       size_rem;
-  CPU_ALIGN        *p1_mem_align;
-  CPU_ALIGN        *p2_mem_align;
+  const CPU_ALIGN  *p1_mem_align;
+  const CPU_ALIGN  *p2_mem_align;
+  CPU_ALIGN        data_lo;
+  CPU_ALIGN        data_hi;
   const CPU_INT08U *p1_mem_08;
   const CPU_INT08U *p2_mem_08;
-  CPU_DATA         i;
   CPU_DATA         mem_align_mod_1;
   CPU_DATA         mem_align_mod_2;
-  CPU_BOOLEAN      mem_aligned;
+  CPU_DATA         shift;
   CPU_BOOLEAN      mem_cmp;
 
   if ((size < 1)                                                // See Note #1.
@@ -540,35 +656,27 @@ CPU_BOOLEAN Mem_Cmp(const void *p1_mem,
   //                                                               Start @ end of mem bufs (see Note #2).
   p1_mem_08 = (const CPU_INT08U *)p1_mem + size;
   p2_mem_08 = (const CPU_INT08U *)p2_mem + size;
-  //                                                               See Note #4.
-  mem_align_mod_1 = (CPU_INT08U)((CPU_ADDR)p1_mem_08 % sizeof(CPU_ALIGN));
-  mem_align_mod_2 = (CPU_INT08U)((CPU_ADDR)p2_mem_08 % sizeof(CPU_ALIGN));
-
-  mem_aligned = (mem_align_mod_1 == mem_align_mod_2) ? DEF_YES : DEF_NO;
-
-  if (mem_aligned == DEF_YES) {
-    //                                                             If mem bufs' alignment offset equal, optimize cmp for mem buf alignment.
-    if (mem_align_mod_1 != 0u) {                                // If trailing octets avail,                  ...
-      i = mem_align_mod_1;
-      while ((mem_cmp == DEF_YES)                               // ... cmp mem bufs while identical &         ...
-             && (size_rem > 0)                                  // ... start mem buf cmp with trailing octets ...
-             && (i > 0)) {                                      // ... until next CPU_ALIGN word boundary.
-        p1_mem_08--;
-        p2_mem_08--;
-        if (*p1_mem_08 != *p2_mem_08) {                         // If ANY data octet(s) NOT identical, cmp fails.
-          mem_cmp = DEF_NO;
-        }
-        size_rem -= sizeof(CPU_INT08U);
-        i--;
+
+  if (size_rem >= MEM_WORD_SIZE_MIN) {
+    //                                                             See Note #4.
+    mem_align_mod_1 = (CPU_DATA)((CPU_ADDR)p1_mem_08 % sizeof(CPU_ALIGN));
+    while ((mem_cmp == DEF_YES)                                 // Cmp mem bufs while identical &             ...
+           && (mem_align_mod_1 > 0u)) {                         // ... start with trailing octets until buf 1 aligned.
+      p1_mem_08--;
+      p2_mem_08--;
+      if (*p1_mem_08 != *p2_mem_08) {                           // If ANY data octet(s) NOT identical, cmp fails.
+        mem_cmp = DEF_NO;
       }
+      size_rem -= sizeof(CPU_INT08U);
+      mem_align_mod_1--;
     }
 
-    if (mem_cmp == DEF_YES) {                                   // If cmp still identical, cmp aligned mem bufs.
-      p1_mem_align = (CPU_ALIGN *)p1_mem_08;                    // See Note #3.
-      p2_mem_align = (CPU_ALIGN *)p2_mem_08;
-
-      while ((mem_cmp == DEF_YES)                               // Cmp mem bufs while identical & ...
-             && (size_rem >= sizeof(CPU_ALIGN))) {              // ... mem bufs aligned on CPU_ALIGN word boundaries.
+    p1_mem_align = (const CPU_ALIGN *)p1_mem_08;                // See Note #3.
+    mem_align_mod_2 = (CPU_DATA)((CPU_ADDR)p2_mem_08 % sizeof(CPU_ALIGN));
+    if (mem_align_mod_2 == 0u) {                                // If buf 2 also aligned, cmp words.
+      p2_mem_align = (const CPU_ALIGN *)p2_mem_08;
+      while ((mem_cmp == DEF_YES)
+             && (size_rem >= sizeof(CPU_ALIGN))) {
         p1_mem_align--;
         p2_mem_align--;
         if (*p1_mem_align != *p2_mem_align) {                   // If ANY data octet(s) NOT identical, cmp fails.
@@ -577,13 +685,30 @@ CPU_BOOLEAN Mem_Cmp(const void *p1_mem,
         size_rem -= sizeof(CPU_ALIGN);
       }
 
-      p1_mem_08 = (CPU_INT08U *)p1_mem_align;
-      p2_mem_08 = (CPU_INT08U *)p2_mem_align;
+      p2_mem_08 = (const CPU_INT08U *)p2_mem_align;
+    } else {                                                    // Else, merge shifted buf 2 words (see Note #5).
+      p2_mem_align = (const CPU_ALIGN *)(p2_mem_08 - mem_align_mod_2);
+      shift = mem_align_mod_2 * DEF_OCTET_NBR_BITS;
+      data_hi = *p2_mem_align;
+      while ((mem_cmp == DEF_YES)
+             && (size_rem >= sizeof(CPU_ALIGN))) {
+        p1_mem_align--;
+        data_lo = *--p2_mem_align;
+        if (*p1_mem_align != MEM_WORD_MERGE(data_lo, data_hi, shift)) {
+          mem_cmp = DEF_NO;                                     // If ANY data octet(s) NOT identical, cmp fails.
+        }
+        data_hi = data_lo;
+        size_rem -= sizeof(CPU_ALIGN);
+      }
+
+      p2_mem_08 = (const CPU_INT08U *)p2_mem_align + mem_align_mod_2;
     }
+
+    p1_mem_08 = (const CPU_INT08U *)p1_mem_align;
   }
 
   while ((mem_cmp == DEF_YES)                                   // Cmp mem bufs while identical ...
-         && (size_rem > 0)) {                                   // ... for unaligned mem bufs or trailing octets.
+         && (size_rem > 0)) {                                   // ... for short mem bufs or leading octets.
     p1_mem_08--;
     p2_mem_08--;
     if (*p1_mem_08 != *p2_mem_08) {                             // If ANY data octet(s) NOT identical, cmp fails.
@@ -1441,6 +1566,513 @@ CPU_SIZE_T Mem_DynPoolBlkNbrAvailGet(MEM_DYN_POOL      *p_pool,
   return (blk_nbr_rem);
 }
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagCreate()
+ *
+ * @brief    Creates a magazine caching free blocks of a dynamic memory pool for a single owner.
+ *
+ * @param    p_name          Pointer to the magazine name.
+ *
+ * @param    p_mag           Pointer to the magazine data.
+ *
+ * @param    p_pool          Pointer to the pool from which blocks are cached.
+ *
+ * @param    p_seg           Pointer to segment from which to allocate the magazine's table of blocks.
+ *                           If NULL, it will be allocated from the general-purpose heap.
+ *
+ * @param    blk_nbr_max     Maximum number of blocks cached in the magazine.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_SEG_OVF
+ *
+ * @note     (1) See 'DYNAMIC MEMORY POOL MAGAZINE DATA TYPE Note #1' in lib_mem.h.
+ *******************************************************************************************************/
+void Mem_DynPoolMagCreate(const CPU_CHAR   *p_name,
+                          MEM_DYN_POOL_MAG *p_mag,
+                          MEM_DYN_POOL     *p_pool,
+                          MEM_SEG          *p_seg,
+                          CPU_SIZE_T       blk_nbr_max,
+                          RTOS_ERR         *p_err)
+{
+  void **p_blk_tbl;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  CORE_DECLARE_IRQ_STATE;
+#endif
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  //                                                               Chk for NULL magazine and pool data ptrs.
+  RTOS_ASSERT_DBG_ERR_SET((p_mag != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((p_pool != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  //                                                               Chk for invalid magazine size.
+  RTOS_ASSERT_DBG_ERR_SET((blk_nbr_max != 0u), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+  p_blk_tbl = (void **)Mem_SegAlloc(p_name,
+                                    p_seg,
+                                    blk_nbr_max * sizeof(void *),
+                                    p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+
+  p_mag->PoolPtr = p_pool;
+  p_mag->BlkTbl = p_blk_tbl;
+  p_mag->BlkNbrMax = blk_nbr_max;
+  p_mag->BlkNbr = 0u;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  p_mag->NamePtr = p_name;
+  p_mag->HitCtr = 0u;
+  p_mag->RefillCtr = 0u;
+  p_mag->DrainCtr = 0u;
+  p_mag->BlkNbrPeak = 0u;
+
+  CORE_ENTER_ATOMIC();                                          // Add magazine to list, for Mem_OutputUsage().
+  p_mag->NextPtr = Mem_DynPoolMagHeadPtr;
+  Mem_DynPoolMagHeadPtr = p_mag;
+  CORE_EXIT_ATOMIC();
+#else
+  PP_UNUSED_PARAM(p_name);
+#endif
+}
+
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagBlkGet()
+ *
+ * @brief    Gets a memory block through a magazine.
+ *
+ * @param    p_mag   Pointer to the magazine data.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *                       - RTOS_ERR_POOL_EMPTY
+ *                       - RTOS_ERR_BLK_ALLOC_CALLBACK
+ *                       - RTOS_ERR_SEG_OVF
+ *
+ * @return   Pointer to memory block, if successful.
+ *           DEF_NULL, otherwise.
+ *
+ * @note     (1) When the magazine is empty, it is refilled with up to half of its capacity from the
+ *               free blocks of the pool, in a single critical section. If the pool has no free block,
+ *               the block is obtained with Mem_DynPoolBlkGet(), which may grow the pool.
+ *******************************************************************************************************/
+void *Mem_DynPoolMagBlkGet(MEM_DYN_POOL_MAG *p_mag,
+                           RTOS_ERR         *p_err)
+{
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, DEF_NULL);
+
+  //                                                               Chk for NULL magazine data ptr.
+  RTOS_ASSERT_DBG_ERR_SET((p_mag != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, DEF_NULL);
+
+  if (p_mag->BlkNbr == 0u) {                                    // Refill empty magazine (see Note #1).
+    if (Mem_DynPoolMagRefill(p_mag) == 0u) {
+      return (Mem_DynPoolBlkGet(p_mag->PoolPtr, p_err));
+    }
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_mag->RefillCtr++;
+  } else {
+    p_mag->HitCtr++;
+#endif
+  }
+
+  p_mag->BlkNbr--;
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+  return (p_mag->BlkTbl[p_mag->BlkNbr]);
+}
+
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagBlkFree()
+ *
+ * @brief    Frees a memory block through a magazine.
+ *
+ * @param    p_mag   Pointer to the magazine data.
+ *
+ * @param    p_blk   Pointer to first byte of memory block. MUST have been obtained from the magazine's
+ *                   pool.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *
+ * @note     (1) When the magazine is full, half of its blocks are returned to the pool in a single
+ *               critical section before the block is cached.
+ *******************************************************************************************************/
+void Mem_DynPoolMagBlkFree(MEM_DYN_POOL_MAG *p_mag,
+                           void             *p_blk,
+                           RTOS_ERR         *p_err)
+{
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  //                                                               Chk for NULL magazine data and blk ptrs.
+  RTOS_ASSERT_DBG_ERR_SET((p_mag != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((p_blk != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  if (p_mag->BlkNbr >= p_mag->BlkNbrMax) {                      // Drain full magazine (see Note #1).
+    Mem_DynPoolMagDrain(p_mag, (p_mag->BlkNbrMax + 1u) / 2u);
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_mag->DrainCtr++;
+  } else {
+    p_mag->HitCtr++;
+#endif
+  }
+
+  p_mag->BlkTbl[p_mag->BlkNbr] = p_blk;
+  p_mag->BlkNbr++;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  if (p_mag->BlkNbrPeak < p_mag->BlkNbr) {
+    p_mag->BlkNbrPeak = p_mag->BlkNbr;
+  }
+#endif
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagFlush()
+ *
+ * @brief    Returns all the blocks cached in a magazine to its pool.
+ *
+ * @param    p_mag   Pointer to the magazine data.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *
+ * @note     (1) The owner of a magazine should flush it before it stops using it, so that the cached
+ *               blocks can be obtained by other users of the pool.
+ *******************************************************************************************************/
+void Mem_DynPoolMagFlush(MEM_DYN_POOL_MAG *p_mag,
+                         RTOS_ERR         *p_err)
+{
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  //                                                               Chk for NULL magazine data ptr.
+  RTOS_ASSERT_DBG_ERR_SET((p_mag != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  Mem_DynPoolMagDrain(p_mag, p_mag->BlkNbr);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagDel()
+ *
+ * @brief    Deletes a magazine, returning all its cached blocks to its pool.
+ *
+ * @param    p_mag   Pointer to the magazine data.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *
+ * @note     (1) A magazine MUST be deleted before its data goes out of scope or is freed, since it is
+ *               linked in the list of magazines walked by Mem_OutputUsage().
+ *
+ * @note     (2) The magazine's table of blocks is NOT returned to its memory segment.
+ *******************************************************************************************************/
+void Mem_DynPoolMagDel(MEM_DYN_POOL_MAG *p_mag,
+                       RTOS_ERR         *p_err)
+{
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  MEM_DYN_POOL_MAG **p_mag_prev_next;
+  CORE_DECLARE_IRQ_STATE;
+#endif
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  //                                                               Chk for NULL magazine data ptr.
+  RTOS_ASSERT_DBG_ERR_SET((p_mag != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  Mem_DynPoolMagDrain(p_mag, p_mag->BlkNbr);
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  CORE_ENTER_ATOMIC();                                          // Unlink magazine from list (see Note #1).
+  p_mag_prev_next = &Mem_DynPoolMagHeadPtr;
+  while ((*p_mag_prev_next != DEF_NULL)
+         && (*p_mag_prev_next != p_mag)) {
+    p_mag_prev_next = &(*p_mag_prev_next)->NextPtr;
+  }
+  if (*p_mag_prev_next == p_mag) {
+    *p_mag_prev_next = p_mag->NextPtr;
+  }
+  CORE_EXIT_ATOMIC();
+
+  p_mag->NextPtr = DEF_NULL;
+#endif
+
+  p_mag->PoolPtr = DEF_NULL;
+  p_mag->BlkNbrMax = 0u;
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+#endif
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                               Mem_SlabCreate()
+ *
+ * @brief    Creates a slab allocator serving blocks of variable size from power-of-two size classes.
+ *
+ * @param    p_name          Pointer to the slab allocator name.
+ *
+ * @param    p_slab          Pointer to the slab allocator data.
+ *
+ * @param    p_seg           Pointer to segment from which to allocate the slabs and the table of size
+ *                           classes. If NULL, they will be allocated from the general-purpose heap.
+ *
+ * @param    blk_size_min    Size of the smallest size class, in octets. MUST be a power of 2 and at
+ *                           least sizeof(void *).
+ *
+ * @param    blk_size_max    Size of the largest size class, in octets. MUST be a power of 2.
+ *
+ * @param    slab_size       Size of each slab, in octets. MUST be a power of 2 and at least twice
+ *                           'blk_size_max'.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_SEG_OVF
+ *
+ * @note     (1) See 'SLAB ALLOCATOR DATA TYPES Note #1' in lib_mem.h. No slab is allocated until a
+ *               block of its class is requested.
+ *
+ * @note     (2) Slabs are aligned on 'slab_size' (see 'SLAB ALLOCATOR DATA TYPES Note #2' in lib_mem.h).
+ *               When 'p_seg' is shared, the octets skipped to align a slab are lost, so a segment
+ *               dedicated to the slab allocator, whose base is aligned on 'slab_size', should be used.
+ *******************************************************************************************************/
+void Mem_SlabCreate(const CPU_CHAR *p_name,
+                    MEM_SLAB       *p_slab,
+                    MEM_SEG        *p_seg,
+                    CPU_SIZE_T     blk_size_min,
+                    CPU_SIZE_T     blk_size_max,
+                    CPU_SIZE_T     slab_size,
+                    RTOS_ERR       *p_err)
+{
+  MEM_SLAB_CLASS *p_class_tbl;
+  CPU_INT08U     class_qty;
+  CPU_INT08U     class_ix;
+  CPU_INT08U     blk_size_min_log2;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  CORE_DECLARE_IRQ_STATE;
+#endif
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  //                                                               Chk for NULL slab allocator data ptr.
+  RTOS_ASSERT_DBG_ERR_SET((p_slab != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  //                                                               Chk for invalid class and slab sizes.
+  RTOS_ASSERT_DBG_ERR_SET((MATH_IS_PWR2(blk_size_min) == DEF_YES), *p_err, RTOS_ERR_INVALID_ARG,; );
+  RTOS_ASSERT_DBG_ERR_SET((MATH_IS_PWR2(blk_size_max) == DEF_YES), *p_err, RTOS_ERR_INVALID_ARG,; );
+  RTOS_ASSERT_DBG_ERR_SET((MATH_IS_PWR2(slab_size) == DEF_YES), *p_err, RTOS_ERR_INVALID_ARG,; );
+  RTOS_ASSERT_DBG_ERR_SET((blk_size_min >= sizeof(void *)), *p_err, RTOS_ERR_INVALID_ARG,; );
+  RTOS_ASSERT_DBG_ERR_SET((blk_size_max >= blk_size_min), *p_err, RTOS_ERR_INVALID_ARG,; );
+  RTOS_ASSERT_DBG_ERR_SET((blk_size_max <= (slab_size / 2u)), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+  blk_size_min_log2 = (CPU_INT08U)(DEF_INT_CPU_NBR_BITS - 1u - CPU_CntLeadZeros((CPU_DATA)blk_size_min));
+  class_qty = (CPU_INT08U)((DEF_INT_CPU_NBR_BITS - 1u - CPU_CntLeadZeros((CPU_DATA)blk_size_max)) - blk_size_min_log2 + 1u);
+
+  p_class_tbl = (MEM_SLAB_CLASS *)Mem_SegAlloc(p_name,
+                                               p_seg,
+                                               class_qty * sizeof(MEM_SLAB_CLASS),
+                                               p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+
+  for (class_ix = 0u; class_ix < class_qty; class_ix++) {
+    MEM_SLAB_CLASS *p_class = &p_class_tbl[class_ix];
+
+    p_class->BlkFreePtr = DEF_NULL;
+    p_class->BlkSize = blk_size_min << class_ix;
+    p_class->SlabCnt = 0u;
+    p_class->BlkAllocCnt = 0u;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    p_class->BlkAllocPeak = 0u;
+    p_class->AllocCtr = 0u;
+    p_class->AllocWasteTot = 0u;
+#endif
+  }
+
+  p_slab->SegPtr = p_seg;
+  p_slab->ClassTbl = p_class_tbl;
+  p_slab->ClassQty = class_qty;
+  p_slab->BlkSizeMinLog2 = blk_size_min_log2;
+  p_slab->SlabSize = slab_size;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  p_slab->NamePtr = p_name;
+
+  CORE_ENTER_ATOMIC();                                          // Add slab allocator to list, for Mem_OutputUsage().
+  p_slab->NextPtr = Mem_SlabHeadPtr;
+  Mem_SlabHeadPtr = p_slab;
+  CORE_EXIT_ATOMIC();
+#else
+  PP_UNUSED_PARAM(p_name);
+#endif
+}
+
+/****************************************************************************************************//**
+ *                                               Mem_SlabAlloc()
+ *
+ * @brief    Allocates a block from a slab allocator.
+ *
+ * @param    p_slab  Pointer to the slab allocator data.
+ *
+ * @param    size    Size of the block, in octets. MUST be less than or equal to the size of the largest
+ *                   size class.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *                       - RTOS_ERR_SIZE_INVALID
+ *                       - RTOS_ERR_SEG_OVF
+ *
+ * @return   Pointer to memory block, if successful.
+ *           DEF_NULL, otherwise.
+ *
+ * @note     (1) The block is taken from the smallest size class that fits 'size'. When the free list of
+ *               the class is empty, a new slab is allocated from the segment and split into blocks.
+ *
+ * @note     (2) The allocations counter & the total waste of the class stop being updated when either
+ *               would overflow, so that the average waste reported by Mem_OutputUsage() remains the
+ *               average over the allocations counted so far.
+ *******************************************************************************************************/
+void *Mem_SlabAlloc(MEM_SLAB   *p_slab,
+                    CPU_SIZE_T size,
+                    RTOS_ERR   *p_err)
+{
+  MEM_SLAB_CLASS *p_class;
+  void           *p_blk;
+  CPU_INT08U     class_ix;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  CPU_INT32U     waste;
+#endif
+  CORE_DECLARE_IRQ_STATE;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, DEF_NULL);
+
+  //                                                               Chk for NULL slab allocator data ptr.
+  RTOS_ASSERT_DBG_ERR_SET((p_slab != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, DEF_NULL);
+
+  if ((size == 0u)
+      || (size > p_slab->ClassTbl[p_slab->ClassQty - 1u].BlkSize)) {
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    RTOS_ERR_SET_AND_LOG_DBG(*p_err, RTOS_ERR_SIZE_INVALID, ("Mem_SlabAlloc: no size class of slab allocator ", (s)p_slab->NamePtr, " fits the requested size."));
+#else
+    RTOS_ERR_SET_AND_LOG_DBG(*p_err, RTOS_ERR_SIZE_INVALID, ("Mem_SlabAlloc: no size class fits the requested size."));
+#endif
+    return (DEF_NULL);
+  }
+
+  //                                                               Find size class (see Note #1).
+  if (size <= p_slab->ClassTbl[0u].BlkSize) {
+    class_ix = 0u;
+  } else {
+    class_ix = (CPU_INT08U)((DEF_INT_CPU_NBR_BITS - CPU_CntLeadZeros((CPU_DATA)(size - 1u))) - p_slab->BlkSizeMinLog2);
+  }
+  p_class = &p_slab->ClassTbl[class_ix];
+
+  for (;;) {
+    CORE_ENTER_ATOMIC();
+    p_blk = p_class->BlkFreePtr;
+    if (p_blk != DEF_NULL) {                                    // Pop first free blk of class.
+      p_class->BlkFreePtr = *((void **)p_blk);
+      p_class->BlkAllocCnt++;
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+      if (p_class->BlkAllocPeak < p_class->BlkAllocCnt) {
+        p_class->BlkAllocPeak = p_class->BlkAllocCnt;
+      }
+      waste = (CPU_INT32U)(p_class->BlkSize - size);
+      if ((p_class->AllocCtr < DEF_INT_32U_MAX_VAL)             // Stop sampling before overflow (see Note #2).
+          && (p_class->AllocWasteTot <= (DEF_INT_32U_MAX_VAL - waste))) {
+        p_class->AllocCtr++;
+        p_class->AllocWasteTot += waste;
+      }
+#endif
+      CORE_EXIT_ATOMIC();
+
+      RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+      return (p_blk);
+    }
+    CORE_EXIT_ATOMIC();
+
+    Mem_SlabGrow(p_slab, p_class, p_err);                       // Free list empty, carve a new slab.
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      return (DEF_NULL);
+    }
+  }
+}
+
+/****************************************************************************************************//**
+ *                                               Mem_SlabFree()
+ *
+ * @brief    Frees a block obtained from a slab allocator.
+ *
+ * @param    p_slab  Pointer to the slab allocator data.
+ *
+ * @param    p_blk   Pointer to first byte of memory block. MUST have been obtained from Mem_SlabAlloc()
+ *                   with the same slab allocator.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *                       - RTOS_ERR_POOL_FULL
+ *
+ * @note     (1) The size class of the block is read from the header of its slab, found by rounding the
+ *               block address down to a multiple of the slab size (see 'SLAB ALLOCATOR DATA TYPES
+ *               Note #2' in lib_mem.h).
+ *******************************************************************************************************/
+void Mem_SlabFree(MEM_SLAB *p_slab,
+                  void     *p_blk,
+                  RTOS_ERR *p_err)
+{
+  MEM_SLAB_CLASS *p_class;
+  CORE_DECLARE_IRQ_STATE;
+
+  RTOS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  //                                                               Chk for NULL slab allocator data and blk ptrs.
+  RTOS_ASSERT_DBG_ERR_SET((p_slab != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+  RTOS_ASSERT_DBG_ERR_SET((p_blk != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  //                                                               Get blk's class from slab hdr (see Note #1).
+  p_class = *((MEM_SLAB_CLASS **)((CPU_ADDR)p_blk & ~((CPU_ADDR)p_slab->SlabSize - 1u)));
+
+  //                                                               Chk that blk belongs to slab allocator.
+  RTOS_ASSERT_DBG_ERR_SET(((p_class >= &p_slab->ClassTbl[0u])
+                           && (p_class < &p_slab->ClassTbl[p_slab->ClassQty])), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+  CORE_ENTER_ATOMIC();
+  if (p_class->BlkAllocCnt == 0u) {
+    CORE_EXIT_ATOMIC();
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+    RTOS_ERR_SET_AND_LOG_DBG(*p_err, RTOS_ERR_POOL_FULL, ("Mem_SlabFree: size class of slab allocator ", (s)p_slab->NamePtr, " has no block in use."));
+#else
+    RTOS_ERR_SET_AND_LOG_DBG(*p_err, RTOS_ERR_POOL_FULL, ("Mem_SlabFree: size class has no block in use."));
+#endif
+    return;
+  }
+
+  p_class->BlkAllocCnt--;
+  *((void **)p_blk) = p_class->BlkFreePtr;
+  p_class->BlkFreePtr = p_blk;
+  CORE_EXIT_ATOMIC();
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+#endif
+
 /****************************************************************************************************//**
  *                                               Mem_SegTotalUsageGet()
  *
@@ -1576,6 +2208,112 @@ void Mem_OutputUsage(void (*out_fnct)(CPU_CHAR *p_str),
   }
   CORE_EXIT_ATOMIC();
 
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+  {
+    MEM_DYN_POOL_MAG *p_mag;
+
+    out_fnct((CPU_CHAR *)"---------------- Magazine cache info --------------------------------\r\n");
+    out_fnct((CPU_CHAR *)"| Hits       | Refills    | Drains     | Peak blks  | Name\r\n");
+    out_fnct((CPU_CHAR *)"|------------|------------|------------|------------|-----------------\r\n");
+
+    CORE_ENTER_ATOMIC();
+    p_mag = Mem_DynPoolMagHeadPtr;
+    while (p_mag != DEF_NULL) {
+      out_fnct((CPU_CHAR *)"| ");
+      (void)Str_FmtNbr_Int32U(p_mag->HitCtr, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)" | ");
+      (void)Str_FmtNbr_Int32U(p_mag->RefillCtr, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)" | ");
+      (void)Str_FmtNbr_Int32U(p_mag->DrainCtr, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)" | ");
+      (void)Str_FmtNbr_Int32U(p_mag->BlkNbrPeak, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)" | ");
+      out_fnct((p_mag->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_mag->NamePtr : (CPU_CHAR *)"Unknown");
+      out_fnct((CPU_CHAR *)"\r\n");
+
+      p_mag = p_mag->NextPtr;
+    }
+    CORE_EXIT_ATOMIC();
+  }
+#endif
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+  {
+    MEM_SLAB       *p_slab;
+    MEM_SLAB_CLASS *p_class;
+    CPU_INT08U     class_ix;
+    CPU_SIZE_T     blk_qty;
+    CPU_SIZE_T     slab_octets;
+    CPU_SIZE_T     free_octets;
+
+    out_fnct((CPU_CHAR *)"---------------- Slab allocator info -------------------------------------------------------------\r\n");
+    out_fnct((CPU_CHAR *)"| Blk size   | Slabs      | Used blks  | Free blks  | Peak used  | Avg waste  | Name\r\n");
+    out_fnct((CPU_CHAR *)"|------------|------------|------------|------------|------------|------------|-------------------\r\n");
+
+    CORE_ENTER_ATOMIC();
+    p_slab = Mem_SlabHeadPtr;
+    while (p_slab != DEF_NULL) {
+      slab_octets = 0u;
+      free_octets = 0u;
+
+      for (class_ix = 0u; class_ix < p_slab->ClassQty; class_ix++) {
+        p_class = &p_slab->ClassTbl[class_ix];
+        if (p_class->SlabCnt == 0u) {                           // Skip classes that were never used.
+          continue;
+        }
+
+        blk_qty = p_class->SlabCnt * ((p_slab->SlabSize - MEM_SLAB_HDR_SIZE) / p_class->BlkSize);
+        slab_octets += p_class->SlabCnt * p_slab->SlabSize;
+        free_octets += (blk_qty - p_class->BlkAllocCnt) * p_class->BlkSize;
+
+        out_fnct((CPU_CHAR *)"| ");
+        (void)Str_FmtNbr_Int32U(p_class->BlkSize, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(p_class->SlabCnt, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(p_class->BlkAllocCnt, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(blk_qty - p_class->BlkAllocCnt, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U(p_class->BlkAllocPeak, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        (void)Str_FmtNbr_Int32U((p_class->AllocCtr != 0u) ? (p_class->AllocWasteTot / p_class->AllocCtr) : 0u,
+                                10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+        out_fnct(str);
+        out_fnct((CPU_CHAR *)" | ");
+        out_fnct((p_slab->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_slab->NamePtr : (CPU_CHAR *)"Unknown");
+        out_fnct((CPU_CHAR *)"\r\n");
+      }
+      //                                                           Report octets held in free blks as fragmentation.
+      out_fnct((CPU_CHAR *)"| -- Free   | ");
+      (void)Str_FmtNbr_Int32U(free_octets, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)" of ");
+      (void)Str_FmtNbr_Int32U(slab_octets, 10u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)" octets (");
+      (void)Str_FmtNbr_Int32U((slab_octets != 0u) ? ((free_octets * 100u) / slab_octets) : 0u,
+                              3u, DEF_NBR_BASE_DEC, ' ', DEF_NO, DEF_YES, &str[0u]);
+      out_fnct(str);
+      out_fnct((CPU_CHAR *)"%) | ");
+      out_fnct((p_slab->NamePtr != DEF_NULL) ? (CPU_CHAR *)p_slab->NamePtr : (CPU_CHAR *)"Unknown");
+      out_fnct((CPU_CHAR *)"\r\n");
+
+      p_slab = p_slab->NextPtr;
+    }
+    CORE_EXIT_ATOMIC();
+  }
+#endif
+
   RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
 }
 #endif
@@ -2051,3 +2789,154 @@ static void Mem_DynPoolCreateInternal(const CPU_CHAR *p_name,
   }
 #endif
 }
+
+#if (LIB_MEM_CFG_DYN_POOL_MAG_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagRefill()
+ *
+ * @brief    Refills an empty magazine with up to half of its capacity from the free blocks of its pool.
+ *
+ * @param    p_mag   Pointer to the magazine data.
+ *
+ * @return   Number of blocks placed in the magazine.
+ *
+ * @note     (1) The pool's block limit, if any, is respected: blocks in the magazine are counted as
+ *               allocated.
+ *******************************************************************************************************/
+static CPU_SIZE_T Mem_DynPoolMagRefill(MEM_DYN_POOL_MAG *p_mag)
+{
+  MEM_DYN_POOL *p_pool;
+  void         *p_blk;
+  CPU_SIZE_T   blk_nbr;
+  CPU_SIZE_T   blk_nbr_max;
+  CORE_DECLARE_IRQ_STATE;
+
+  p_pool = p_mag->PoolPtr;
+  blk_nbr_max = (p_mag->BlkNbrMax + 1u) / 2u;
+  blk_nbr = 0u;
+
+  CORE_ENTER_ATOMIC();
+  if (p_pool->BlkQtyMax != LIB_MEM_BLK_QTY_UNLIMITED) {         // See Note #1.
+    blk_nbr_max = DEF_MIN(blk_nbr_max, p_pool->BlkQtyMax - p_pool->BlkAllocCnt);
+  }
+
+  while ((blk_nbr < blk_nbr_max)
+         && (p_pool->BlkFreePtr != DEF_NULL)) {
+    p_blk = p_pool->BlkFreePtr;
+    p_pool->BlkFreePtr = (DEF_BIT_IS_CLR(p_pool->Opt, MEM_DYN_POOL_OPT_PERSISTENT) == DEF_YES) ? *((void **)p_blk)
+                         : *((void **)((CPU_INT08U *)p_blk + p_pool->BlkSize - sizeof(void *)));
+    p_mag->BlkTbl[blk_nbr] = p_blk;
+    blk_nbr++;
+  }
+  p_pool->BlkAllocCnt += blk_nbr;
+  CORE_EXIT_ATOMIC();
+
+  p_mag->BlkNbr = blk_nbr;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  if (p_mag->BlkNbrPeak < blk_nbr) {
+    p_mag->BlkNbrPeak = blk_nbr;
+  }
+#endif
+
+  return (blk_nbr);
+}
+
+/****************************************************************************************************//**
+ *                                           Mem_DynPoolMagDrain()
+ *
+ * @brief    Returns blocks from the top of a magazine to the free list of its pool.
+ *
+ * @param    p_mag       Pointer to the magazine data.
+ *
+ * @param    blk_nbr     Number of blocks to return. MUST be less than or equal to the number of blocks
+ *                       in the magazine.
+ *******************************************************************************************************/
+static void Mem_DynPoolMagDrain(MEM_DYN_POOL_MAG *p_mag,
+                                CPU_SIZE_T       blk_nbr)
+{
+  MEM_DYN_POOL *p_pool;
+  void         *p_blk;
+  void         *p_blk_next_addr;
+  CORE_DECLARE_IRQ_STATE;
+
+  p_pool = p_mag->PoolPtr;
+
+  CORE_ENTER_ATOMIC();
+  p_pool->BlkAllocCnt -= blk_nbr;
+  while (blk_nbr > 0u) {
+    p_mag->BlkNbr--;
+    p_blk = p_mag->BlkTbl[p_mag->BlkNbr];
+    p_blk_next_addr = (DEF_BIT_IS_CLR(p_pool->Opt, MEM_DYN_POOL_OPT_PERSISTENT) == DEF_YES) ? p_blk
+                      : ((CPU_INT08U *)p_blk) + p_pool->BlkSize - sizeof(void *);
+
+    *((void **)p_blk_next_addr) = p_pool->BlkFreePtr;
+    p_pool->BlkFreePtr = p_blk;
+    blk_nbr--;
+  }
+  CORE_EXIT_ATOMIC();
+}
+#endif
+
+#if (LIB_MEM_CFG_SLAB_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                               Mem_SlabGrow()
+ *
+ * @brief    Allocates a new slab for a size class and adds its blocks to the free list of the class.
+ *
+ * @param    p_slab  Pointer to the slab allocator data.
+ *
+ * @param    p_class Pointer to the size class.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *                       - RTOS_ERR_SEG_OVF
+ *
+ * @note     (1) The blocks are chained outside of any critical section, then spliced in front of the
+ *               free list. Another task may grow the same class concurrently; both slabs are kept.
+ *******************************************************************************************************/
+static void Mem_SlabGrow(MEM_SLAB       *p_slab,
+                         MEM_SLAB_CLASS *p_class,
+                         RTOS_ERR       *p_err)
+{
+  CPU_INT08U     *p_slab_base;
+  CPU_INT08U     *p_blk;
+  CPU_INT08U     *p_blk_last;
+  const CPU_CHAR *p_name;
+  CPU_SIZE_T     blk_size;
+  CORE_DECLARE_IRQ_STATE;
+
+#if (LIB_MEM_CFG_DBG_INFO_EN == DEF_ENABLED)
+  p_name = p_slab->NamePtr;
+#else
+  p_name = DEF_NULL;
+#endif
+  p_slab_base = (CPU_INT08U *)Mem_SegAllocExt(p_name,
+                                              p_slab->SegPtr,
+                                              p_slab->SlabSize,
+                                              p_slab->SlabSize,
+                                              DEF_NULL,
+                                              p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+
+  *((MEM_SLAB_CLASS **)p_slab_base) = p_class;                  // Set slab hdr.
+
+  blk_size = p_class->BlkSize;
+  p_blk = p_slab_base + MEM_SLAB_HDR_SIZE;
+  p_blk_last = p_slab_base + MEM_SLAB_HDR_SIZE
+               + ((((p_slab->SlabSize - MEM_SLAB_HDR_SIZE) / blk_size) - 1u) * blk_size);
+  while (p_blk < p_blk_last) {                                  // Chain slab's blks (see Note #1).
+    *((void **)p_blk) = p_blk + blk_size;
+    p_blk += blk_size;
+  }
+
+  CORE_ENTER_ATOMIC();
+  *((void **)p_blk_last) = p_class->BlkFreePtr;
+  p_class->BlkFreePtr = p_slab_base + MEM_SLAB_HDR_SIZE;
+  p_class->SlabCnt++;
+  CORE_EXIT_ATOMIC();
+}
+#endif
@@ -32,7 +32,11 @@
 #include  <common/include/rtos_err.h>
 #include  <common/include/rtos_path.h>
 
+#include  <common/include/lib_str.h>
+
 #include  <common/source/lib/lib_mem_cmd_priv.h>
+#include  <common/source/lib/lib_str_priv.h>
+#include  <common/source/collections/map_priv.h>
 #include  <common/source/rtos/rtos_utils_priv.h>
 
 /********************************************************************************************************
@@ -61,6 +65,40 @@
                                                               "    --short    print memory usage summary (default)\r\n" \
                                                               "    --full     print full memory allocation table\r\n")
 
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+#define  MEM_CMD_BENCH_ITER                                  ("-n")
+
+#define  MEM_CMD_BENCH_ITER_DFLT                             100u
+#define  MEM_CMD_BENCH_SIZE_MAX                              1024u
+#define  MEM_CMD_BENCH_OFFSET_NBR                            4u
+
+#define  MEM_CMD_HELP_BENCH                                  ("usage: mem_bench [-n ITER]\r\n"                                         \
+                                                              "\r\n"                                                                   \
+                                                              " -h,--help     this help message\r\n"                                   \
+                                                              " -n ITER       number of calls per measure (default 100)\r\n"           \
+                                                              "\r\n"                                                                   \
+                                                              "Results are printed as CSV: fnct,size,dest_off,src_off,ts_per_call,kb_per_sec\r\n")
+
+#define  MEM_CMD_MAP_BENCH_ITEM_QTY_MAX                      256u
+#define  MEM_CMD_MAP_BENCH_KEY_LEN                           8u
+
+#define  MEM_CMD_HELP_MAP_BENCH                              ("usage: map_bench [-n ITER]\r\n"                                         \
+                                                              "\r\n"                                                                   \
+                                                              " -h,--help     this help message\r\n"                                   \
+                                                              " -n ITER       number of lookups of each key per measure (default 100)\r\n" \
+                                                              "\r\n"                                                                   \
+                                                              "Results are printed as CSV: map,item_qty,ts_per_add,ts_per_get\r\n")
+
+#define  MEM_CMD_STR_BENCH_CHUNK_LEN                         64u
+
+#define  MEM_CMD_HELP_STR_BENCH                              ("usage: str_bench [-n ITER]\r\n"                                         \
+                                                              "\r\n"                                                                   \
+                                                              " -h,--help     this help message\r\n"                                   \
+                                                              " -n ITER       number of calls per measure (default 100)\r\n"           \
+                                                              "\r\n"                                                                   \
+                                                              "Results are printed as CSV: fnct,char_cnt,ts_per_call\r\n")
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                       LOCAL FUNCTION PROTOTYPES
@@ -72,6 +110,36 @@ static CPU_INT16S MemCmd_Info(CPU_INT16U      argc,
                               SHELL_OUT_FNCT  out_fnct,
                               SHELL_CMD_PARAM *p_cmd_param);
 
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+static CPU_INT16S MemCmd_Bench(CPU_INT16U      argc,
+                               CPU_CHAR        *p_argv[],
+                               SHELL_OUT_FNCT  out_fnct,
+                               SHELL_CMD_PARAM *p_cmd_param);
+
+static CPU_TS32 MemCmd_BenchRun(CPU_INT08U  fnct_ix,
+                                CPU_INT08U  *p_dest,
+                                CPU_INT08U  *p_src,
+                                CPU_SIZE_T  size,
+                                CPU_INT32U  iter);
+
+static CPU_INT16S MemCmd_MapBench(CPU_INT16U      argc,
+                                  CPU_CHAR        *p_argv[],
+                                  SHELL_OUT_FNCT  out_fnct,
+                                  SHELL_CMD_PARAM *p_cmd_param);
+
+static CPU_INT16S MemCmd_StrBench(CPU_INT16U      argc,
+                                  CPU_CHAR        *p_argv[],
+                                  SHELL_OUT_FNCT  out_fnct,
+                                  SHELL_CMD_PARAM *p_cmd_param);
+
+static int MemCmd_StrBenchOutCb(int  c,
+                                void *p_arg);
+
+static void MemCmd_StrBenchFlushCb(const CPU_CHAR *p_data,
+                                   CPU_SIZE_T     len,
+                                   void           *p_arg);
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               LOCAL TABLES
@@ -81,9 +149,37 @@ static CPU_INT16S MemCmd_Info(CPU_INT16U      argc,
 static SHELL_CMD MemCmdTbl[] =
 {
   { "mem_info", MemCmd_Info },
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+  { "mem_bench", MemCmd_Bench },
+  { "map_bench", MemCmd_MapBench },
+  { "str_bench", MemCmd_StrBench },
+#endif
   { 0, 0 }
 };
 
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+static const CPU_CHAR *MemCmd_BenchFnctNameTbl[] = {
+  "Mem_Copy",
+  "Mem_Move",
+  "Mem_Set",
+  "Mem_Cmp"
+};
+
+static const CPU_SIZE_T MemCmd_BenchSizeTbl[] = {
+  8u, 16u, 64u, 256u, MEM_CMD_BENCH_SIZE_MAX
+};
+
+static const CPU_SIZE_T MemCmd_MapBenchItemQtyTbl[] = {
+  8u, 32u, 128u, MEM_CMD_MAP_BENCH_ITEM_QTY_MAX
+};
+
+static const CPU_CHAR *MemCmd_StrBenchFnctNameTbl[] = {
+  "Str_Snprintf",
+  "Str_Printf",
+  "Str_PrintfBuf"
+};
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                          GLOBAL VARIABLES
@@ -104,6 +200,19 @@ static CPU_INT32U OSDbg_DataSize = 0;
 
 static SHELL_OUT_FNCT out_function;
 
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)                            // Bench bufs, 'CPU_ALIGN'd to ctrl offsets.
+static CPU_ALIGN MemCmd_BenchBufDest[(MEM_CMD_BENCH_SIZE_MAX + 2u * MEM_CMD_BENCH_OFFSET_NBR) / sizeof(CPU_ALIGN) + 1u];
+static CPU_ALIGN MemCmd_BenchBufSrc[(MEM_CMD_BENCH_SIZE_MAX + 2u * MEM_CMD_BENCH_OFFSET_NBR) / sizeof(CPU_ALIGN) + 1u];
+
+static MAP_ITEM    MemCmd_MapBenchItemTbl[MEM_CMD_MAP_BENCH_ITEM_QTY_MAX];
+static CPU_CHAR    MemCmd_MapBenchKeyTbl[MEM_CMD_MAP_BENCH_ITEM_QTY_MAX][MEM_CMD_MAP_BENCH_KEY_LEN];
+static MAP_HASH    MemCmd_MapBenchHash;                         // Created on first map_bench (see MemCmd_MapBench() Note #1).
+static CPU_BOOLEAN MemCmd_MapBenchHashIsInit = DEF_NO;
+
+static CPU_CHAR   MemCmd_StrBenchLine[128u];                    // Sink of the per-char callback.
+static CPU_SIZE_T MemCmd_StrBenchLineIx;
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           GLOBAL FUNCTIONS
@@ -217,5 +326,474 @@ static CPU_INT16S MemCmd_Info(CPU_INT16U      argc,
   return RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE ? SHELL_EXEC_ERR_NONE : SHELL_EXEC_ERR;
 }
 
+/****************************************************************************************************//**
+ *                                               MemCmd_Bench()
+ *
+ * @brief    Measures the throughput of Mem_Copy(), Mem_Move(), Mem_Set() and Mem_Cmp() across buffer
+ *           sizes and destination/source alignments.
+ *
+ * @param    argc            Count of the arguments supplied.
+ *
+ * @param    p_argv          Array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        Callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     Pointer to additional information to pass to the command.
+ *
+ * @return   SHELL_EXEC_ERR_NONE, if NO error(s).
+ *               - SHELL_EXEC_ERR otherwise.
+ *
+ * @note     (1) Offsets are in octets from a 'CPU_ALIGN' address. Mem_Move() moves the source buffer
+ *               onto itself, 'MEM_CMD_BENCH_OFFSET_NBR' octets plus the destination offset higher, which
+ *               exercises its backward copy. Mem_Set() only uses the destination offset. Mem_Cmp()
+ *               compares identical buffers, so every octet is compared.
+ *
+ * @note     (2) Measures include the call overhead. Interrupts are NOT disabled while measuring.
+ *******************************************************************************************************/
+#if (CPU_CFG_TS_32_EN == DEF_ENABLED)
+static CPU_INT16S MemCmd_Bench(CPU_INT16U      argc,
+                               CPU_CHAR        *p_argv[],
+                               SHELL_OUT_FNCT  out_fnct,
+                               SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_CHAR        line[96];
+  CPU_INT16S      len;
+  CPU_INT32U      iter;
+  CPU_INT08U      fnct_ix;
+  CPU_INT08U      size_ix;
+  CPU_INT08U      dest_off;
+  CPU_INT08U      src_off;
+  CPU_INT08U      src_off_nbr;
+  CPU_INT08U      *p_dest;
+  CPU_TS32        ts_delta;
+  CPU_TS_TMR_FREQ ts_freq;
+  CPU_INT32U      kb_per_sec;
+  RTOS_ERR        err;
+
+  (void)p_cmd_param;
+
+  iter = MEM_CMD_BENCH_ITER_DFLT;
+  for (int i = 1; i < argc; i++) {
+    if (!Str_Cmp(p_argv[i], MEM_CMD_HELP) || !Str_Cmp(p_argv[i], MEM_CMD_HELP_SHORT)) {
+      out_fnct(MEM_CMD_HELP_BENCH, Str_Len(MEM_CMD_HELP_BENCH), 0);
+      return SHELL_EXEC_ERR_NONE;
+    } else if (!Str_Cmp(p_argv[i], MEM_CMD_BENCH_ITER) && (i + 1 < argc)) {
+      i++;
+      iter = Str_ParseNbr_Int32U(p_argv[i], DEF_NULL, 10u);
+    } else {
+      out_fnct("Invalid argument\r\n", Str_Len("Invalid argument\r\n"), 0);
+      return SHELL_EXEC_ERR;
+    }
+  }
+
+  if (iter == 0u) {
+    out_fnct("Invalid argument\r\n", Str_Len("Invalid argument\r\n"), 0);
+    return SHELL_EXEC_ERR;
+  }
+
+  ts_freq = CPU_TS_TmrFreqGet(&err);
+  if (RTOS_ERR_CODE_GET(err) != RTOS_ERR_NONE) {
+    ts_freq = 0u;
+  }
+
+  Mem_Set(MemCmd_BenchBufSrc, 0xA5u, sizeof(MemCmd_BenchBufSrc));
+
+  len = Str_Sprintf(line, "fnct,size,dest_off,src_off,ts_per_call,kb_per_sec\r\n");
+  out_fnct(line, len, 0);
+
+  for (fnct_ix = 0u; fnct_ix < (sizeof(MemCmd_BenchFnctNameTbl) / sizeof(MemCmd_BenchFnctNameTbl[0])); fnct_ix++) {
+    src_off_nbr = (fnct_ix == 2u) ? 1u : MEM_CMD_BENCH_OFFSET_NBR;   // Mem_Set() has no src (see Note #1).
+    for (size_ix = 0u; size_ix < (sizeof(MemCmd_BenchSizeTbl) / sizeof(MemCmd_BenchSizeTbl[0])); size_ix++) {
+      for (dest_off = 0u; dest_off < MEM_CMD_BENCH_OFFSET_NBR; dest_off++) {
+        for (src_off = 0u; src_off < src_off_nbr; src_off++) {
+          if (fnct_ix == 3u) {                                  // Cmp identical bufs (see Note #1).
+            Mem_Copy((CPU_INT08U *)MemCmd_BenchBufDest + dest_off,
+                     (CPU_INT08U *)MemCmd_BenchBufSrc + src_off,
+                     MemCmd_BenchSizeTbl[size_ix]);
+          }
+
+          if (fnct_ix == 1u) {                                  // Move src buf onto itself (see Note #1).
+            p_dest = (CPU_INT08U *)MemCmd_BenchBufSrc + MEM_CMD_BENCH_OFFSET_NBR + dest_off;
+          } else {
+            p_dest = (CPU_INT08U *)MemCmd_BenchBufDest + dest_off;
+          }
+
+          ts_delta = MemCmd_BenchRun(fnct_ix,
+                                     p_dest,
+                                     (CPU_INT08U *)MemCmd_BenchBufSrc + src_off,
+                                     MemCmd_BenchSizeTbl[size_ix],
+                                     iter);
+
+          kb_per_sec = 0u;
+          if ((ts_freq != 0u)
+              && (ts_delta != 0u)) {
+            kb_per_sec = (CPU_INT32U)(((CPU_INT64U)MemCmd_BenchSizeTbl[size_ix] * iter * ts_freq) / ((CPU_INT64U)ts_delta * 1024u));
+          }
+          len = Str_Sprintf(line,
+                            "%s,%u,%u,%u,%u,%u\r\n",
+                            MemCmd_BenchFnctNameTbl[fnct_ix],
+                            (CPU_INT32U)MemCmd_BenchSizeTbl[size_ix],
+                            dest_off,
+                            src_off,
+                            ts_delta / iter,
+                            kb_per_sec);
+          out_fnct(line, len, 0);
+        }
+      }
+    }
+  }
+
+  return SHELL_EXEC_ERR_NONE;
+}
+
+/****************************************************************************************************//**
+ *                                               MemCmd_BenchRun()
+ *
+ * @brief    Calls a memory function repeatedly and measures the time it took.
+ *
+ * @param    fnct_ix     Index of the function in MemCmd_BenchFnctNameTbl.
+ *
+ * @param    p_dest      Pointer to the destination buffer.
+ *
+ * @param    p_src       Pointer to the source buffer.
+ *
+ * @param    size        Number of octets to process per call.
+ *
+ * @param    iter        Number of calls.
+ *
+ * @return   Number of timestamp counts taken by the 'iter' calls.
+ *******************************************************************************************************/
+static CPU_TS32 MemCmd_BenchRun(CPU_INT08U  fnct_ix,
+                                CPU_INT08U  *p_dest,
+                                CPU_INT08U  *p_src,
+                                CPU_SIZE_T  size,
+                                CPU_INT32U  iter)
+{
+  CPU_TS32   ts_start;
+  CPU_INT32U i;
+
+  ts_start = CPU_TS_Get32();
+  switch (fnct_ix) {
+    case 0u:
+      for (i = 0u; i < iter; i++) {
+        Mem_Copy(p_dest, p_src, size);
+      }
+      break;
+
+    case 1u:
+      for (i = 0u; i < iter; i++) {
+        Mem_Move(p_dest, p_src, size);
+      }
+      break;
+
+    case 2u:
+      for (i = 0u; i < iter; i++) {
+        Mem_Set(p_dest, (CPU_INT08U)i, size);
+      }
+      break;
+
+    case 3u:
+    default:
+      for (i = 0u; i < iter; i++) {
+        (void)Mem_Cmp(p_dest, p_src, size);
+      }
+      break;
+  }
+
+  return (CPU_TS_Get32() - ts_start);
+}
+
+/****************************************************************************************************//**
+ *                                               MemCmd_MapBench()
+ *
+ * @brief    Measures the insert and lookup times of the linear map and of the hash map for increasing
+ *           numbers of items.
+ *
+ * @param    argc            Count of the arguments supplied.
+ *
+ * @param    p_argv          Array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        Callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     Pointer to additional information to pass to the command.
+ *
+ * @return   SHELL_EXEC_ERR_NONE, if NO error(s).
+ *               - SHELL_EXEC_ERR otherwise.
+ *
+ * @note     (1) Hash map tables cannot be freed, so a single hash map is allocated from the heap on
+ *               the first run and emptied after each measure. It has 4 slots per item so that it is
+ *               never resized: re-adding the same keys in the same order reuses the same slots.
+ *
+ * @note     (2) Measures include the call overhead. Interrupts are NOT disabled while measuring.
+ *******************************************************************************************************/
+static CPU_INT16S MemCmd_MapBench(CPU_INT16U      argc,
+                                  CPU_CHAR        *p_argv[],
+                                  SHELL_OUT_FNCT  out_fnct,
+                                  SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_CHAR     line[64];
+  CPU_INT16S   len;
+  CPU_INT32U   iter;
+  CPU_INT32U   i;
+  CPU_SIZE_T   qty_ix;
+  CPU_SIZE_T   item_qty;
+  CPU_SIZE_T   item_ix;
+  CPU_TS32     ts_start;
+  CPU_TS32     ts_add;
+  CPU_TS32     ts_get;
+  MAP_INSTANCE map_list;
+  MAP_HASH_CFG map_hash_cfg;
+  RTOS_ERR     err;
+
+  (void)p_cmd_param;
+
+  iter = MEM_CMD_BENCH_ITER_DFLT;
+  for (int j = 1; j < argc; j++) {
+    if (!Str_Cmp(p_argv[j], MEM_CMD_HELP) || !Str_Cmp(p_argv[j], MEM_CMD_HELP_SHORT)) {
+      out_fnct(MEM_CMD_HELP_MAP_BENCH, Str_Len(MEM_CMD_HELP_MAP_BENCH), 0);
+      return SHELL_EXEC_ERR_NONE;
+    } else if (!Str_Cmp(p_argv[j], MEM_CMD_BENCH_ITER) && (j + 1 < argc)) {
+      j++;
+      iter = Str_ParseNbr_Int32U(p_argv[j], DEF_NULL, 10u);
+    } else {
+      out_fnct("Invalid argument\r\n", Str_Len("Invalid argument\r\n"), 0);
+      return SHELL_EXEC_ERR;
+    }
+  }
+
+  if (iter == 0u) {
+    out_fnct("Invalid argument\r\n", Str_Len("Invalid argument\r\n"), 0);
+    return SHELL_EXEC_ERR;
+  }
+
+  if (MemCmd_MapBenchHashIsInit == DEF_NO) {                    // See Note #1.
+    map_hash_cfg.HashFnct = DEF_NULL;
+    map_hash_cfg.MemSegPtr = DEF_NULL;
+    map_hash_cfg.SlotQtyInit = 4u * MEM_CMD_MAP_BENCH_ITEM_QTY_MAX;
+    map_hash_cfg.IsOrdered = DEF_NO;
+    MapHashInit(&MemCmd_MapBenchHash, &map_hash_cfg, &err);
+    if (RTOS_ERR_CODE_GET(err) != RTOS_ERR_NONE) {
+      out_fnct("Hash map allocation failed\r\n", Str_Len("Hash map allocation failed\r\n"), 0);
+      return SHELL_EXEC_ERR;
+    }
+
+    for (item_ix = 0u; item_ix < MEM_CMD_MAP_BENCH_ITEM_QTY_MAX; item_ix++) {
+      (void)Str_Sprintf(MemCmd_MapBenchKeyTbl[item_ix], "key%u", (CPU_INT32U)item_ix);
+      MemCmd_MapBenchItemTbl[item_ix].Key = MemCmd_MapBenchKeyTbl[item_ix];
+      MemCmd_MapBenchItemTbl[item_ix].Value = &MemCmd_MapBenchItemTbl[item_ix];
+    }
+    MemCmd_MapBenchHashIsInit = DEF_YES;
+  }
+
+  len = Str_Sprintf(line, "map,item_qty,ts_per_add,ts_per_get\r\n");
+  out_fnct(line, len, 0);
+
+  for (qty_ix = 0u; qty_ix < (sizeof(MemCmd_MapBenchItemQtyTbl) / sizeof(MemCmd_MapBenchItemQtyTbl[0])); qty_ix++) {
+    item_qty = MemCmd_MapBenchItemQtyTbl[qty_ix];
+
+    //                                                             ------------------- LINEAR MAP ---------------------
+    MapInit(&map_list);
+    ts_start = CPU_TS_Get32();
+    for (item_ix = 0u; item_ix < item_qty; item_ix++) {
+      MapItemAdd(&map_list, &MemCmd_MapBenchItemTbl[item_ix], &err);
+    }
+    ts_add = CPU_TS_Get32() - ts_start;
+
+    ts_start = CPU_TS_Get32();
+    for (i = 0u; i < iter; i++) {
+      for (item_ix = 0u; item_ix < item_qty; item_ix++) {
+        (void)MapKeyValueGet(&map_list, MemCmd_MapBenchKeyTbl[item_ix], &err);
+      }
+    }
+    ts_get = CPU_TS_Get32() - ts_start;
+
+    len = Str_Sprintf(line,
+                      "list,%u,%u,%u\r\n",
+                      (CPU_INT32U)item_qty,
+                      ts_add / item_qty,
+                      ts_get / (iter * item_qty));
+    out_fnct(line, len, 0);
+
+    //                                                             -------------------- HASH MAP ----------------------
+    ts_start = CPU_TS_Get32();
+    for (item_ix = 0u; item_ix < item_qty; item_ix++) {
+      MapHashItemAdd(&MemCmd_MapBenchHash, &MemCmd_MapBenchItemTbl[item_ix], &err);
+    }
+    ts_add = CPU_TS_Get32() - ts_start;
+
+    ts_start = CPU_TS_Get32();
+    for (i = 0u; i < iter; i++) {
+      for (item_ix = 0u; item_ix < item_qty; item_ix++) {
+        (void)MapHashKeyValueGet(&MemCmd_MapBenchHash, MemCmd_MapBenchKeyTbl[item_ix], &err);
+      }
+    }
+    ts_get = CPU_TS_Get32() - ts_start;
+
+    for (item_ix = 0u; item_ix < item_qty; item_ix++) {
+      MapHashItemRemove(&MemCmd_MapBenchHash, &MemCmd_MapBenchItemTbl[item_ix], &err);
+    }
+
+    len = Str_Sprintf(line,
+                      "hash,%u,%u,%u\r\n",
+                      (CPU_INT32U)item_qty,
+                      ts_add / item_qty,
+                      ts_get / (iter * item_qty));
+    out_fnct(line, len, 0);
+  }
+
+  return SHELL_EXEC_ERR_NONE;
+}
+
+/****************************************************************************************************//**
+ *                                               MemCmd_StrBench()
+ *
+ * @brief    Measures the time taken to format a typical shell output line with Str_Snprintf(), with
+ *           Str_Printf() and a per-character callback, and with Str_PrintfBuf() and a chunk.
+ *
+ * @param    argc            Count of the arguments supplied.
+ *
+ * @param    p_argv          Array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        Callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     Pointer to additional information to pass to the command.
+ *
+ * @return   SHELL_EXEC_ERR_NONE, if NO error(s).
+ *               - SHELL_EXEC_ERR otherwise.
+ *
+ * @note     (1) The per-character callback copies each character to a line buffer, as shell and log
+ *               output callbacks do. The chunk is flushed to a callback that discards it, so that both
+ *               measures only include the formatting and the copy.
+ *
+ * @note     (2) Measures include the call overhead. Interrupts are NOT disabled while measuring.
+ *******************************************************************************************************/
+static CPU_INT16S MemCmd_StrBench(CPU_INT16U      argc,
+                                  CPU_CHAR        *p_argv[],
+                                  SHELL_OUT_FNCT  out_fnct,
+                                  SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_CHAR       line[64];
+  CPU_CHAR       chunk[MEM_CMD_STR_BENCH_CHUNK_LEN];
+  CPU_INT16S     len;
+  CPU_INT16U     char_cnt;
+  CPU_INT32U     iter;
+  CPU_INT32U     i;
+  CPU_INT08U     fnct_ix;
+  CPU_TS32       ts_start;
+  CPU_TS32       ts_delta;
+  STR_PRINTF_BUF buf;
+
+  (void)p_cmd_param;
+
+  iter = MEM_CMD_BENCH_ITER_DFLT;
+  for (int j = 1; j < argc; j++) {
+    if (!Str_Cmp(p_argv[j], MEM_CMD_HELP) || !Str_Cmp(p_argv[j], MEM_CMD_HELP_SHORT)) {
+      out_fnct(MEM_CMD_HELP_STR_BENCH, Str_Len(MEM_CMD_HELP_STR_BENCH), 0);
+      return SHELL_EXEC_ERR_NONE;
+    } else if (!Str_Cmp(p_argv[j], MEM_CMD_BENCH_ITER) && (j + 1 < argc)) {
+      j++;
+      iter = Str_ParseNbr_Int32U(p_argv[j], DEF_NULL, 10u);
+    } else {
+      out_fnct("Invalid argument\r\n", Str_Len("Invalid argument\r\n"), 0);
+      return SHELL_EXEC_ERR;
+    }
+  }
+
+  if (iter == 0u) {
+    out_fnct("Invalid argument\r\n", Str_Len("Invalid argument\r\n"), 0);
+    return SHELL_EXEC_ERR;
+  }
+
+  len = Str_Sprintf(line, "fnct,char_cnt,ts_per_call\r\n");
+  out_fnct(line, len, 0);
+
+  for (fnct_ix = 0u; fnct_ix < (sizeof(MemCmd_StrBenchFnctNameTbl) / sizeof(MemCmd_StrBenchFnctNameTbl[0])); fnct_ix++) {
+    char_cnt = 0u;
+    Str_PrintfBufInit(&buf, chunk, sizeof(chunk), MemCmd_StrBenchFlushCb, DEF_NULL);
+
+    ts_start = CPU_TS_Get32();
+    for (i = 0u; i < iter; i++) {
+      switch (fnct_ix) {
+        case 0u:
+          char_cnt = Str_Snprintf(MemCmd_StrBenchLine,
+                                  sizeof(MemCmd_StrBenchLine),
+                                  "Task %s: prio %u, stk %d/%u, ctx sw %u (%x)\r\n",
+                                  "Net Task", 10u, 1234, 4096u, 3141592653u, 0xDEADBEEFu);
+          break;
+
+        case 1u:
+          MemCmd_StrBenchLineIx = 0u;
+          char_cnt = Str_Printf(MemCmd_StrBenchOutCb,
+                                DEF_NULL,
+                                "Task %s: prio %u, stk %d/%u, ctx sw %u (%x)\r\n",
+                                "Net Task", 10u, 1234, 4096u, 3141592653u, 0xDEADBEEFu);
+          break;
+
+        case 2u:
+        default:
+          char_cnt = Str_PrintfBuf(&buf,
+                                   "Task %s: prio %u, stk %d/%u, ctx sw %u (%x)\r\n",
+                                   "Net Task", 10u, 1234, 4096u, 3141592653u, 0xDEADBEEFu);
+          break;
+      }
+    }
+    Str_PrintfBufFlush(&buf);
+    ts_delta = CPU_TS_Get32() - ts_start;
+
+    len = Str_Sprintf(line,
+                      "%s,%u,%u\r\n",
+                      MemCmd_StrBenchFnctNameTbl[fnct_ix],
+                      char_cnt,
+                      ts_delta / iter);
+    out_fnct(line, len, 0);
+  }
+
+  return SHELL_EXEC_ERR_NONE;
+}
+
+/****************************************************************************************************//**
+ *                                           MemCmd_StrBenchOutCb()
+ *
+ * @brief    Str_Printf() output callback of the str_bench command.
+ *
+ * @param    c       Character to output.
+ *
+ * @param    p_arg   Unused.
+ *
+ * @return   The output character.
+ *******************************************************************************************************/
+static int MemCmd_StrBenchOutCb(int  c,
+                                void *p_arg)
+{
+  (void)p_arg;
+
+  if (MemCmd_StrBenchLineIx < sizeof(MemCmd_StrBenchLine)) {
+    MemCmd_StrBenchLine[MemCmd_StrBenchLineIx++] = (CPU_CHAR)c;
+  }
+
+  return (c);
+}
+
+/****************************************************************************************************//**
+ *                                           MemCmd_StrBenchFlushCb()
+ *
+ * @brief    Str_PrintfBuf() flush callback of the str_bench command. Discards the chunk.
+ *
+ * @param    p_data  Pointer to the flushed characters.
+ *
+ * @param    len     Number of flushed characters.
+ *
+ * @param    p_arg   Unused.
+ *******************************************************************************************************/
+static void MemCmd_StrBenchFlushCb(const CPU_CHAR *p_data,
+                                   CPU_SIZE_T     len,
+                                   void           *p_arg)
+{
+  (void)p_data;
+  (void)len;
+  (void)p_arg;
+}
+#endif
+
 #endif
 #endif
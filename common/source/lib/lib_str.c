@@ -49,10 +49,13 @@
  ********************************************************************************************************
  *******************************************************************************************************/
 
-typedef struct str_sprintf_cb_arg {
-  CPU_CHAR   *BufPtr;
-  CPU_SIZE_T CurIx;
-} STR_SPRINTF_CB_ARG;
+typedef struct str_printf_out {
+  STR_PRINTF_OUT_CB OutCb;                                      // Per-char output callback, if no buffered output.
+  void              *OutCbArg;                                  // Per-char output callback argument.
+  STR_PRINTF_BUF    *BufPtr;                                    // Ptr to buffered output, if any.
+  CPU_SIZE_T        CharCnt;                                    // Nbr of chars formatted so far.
+  CPU_SIZE_T        MaxCharCnt;                                 // Nbr of chars past which output is dropped.
+} STR_PRINTF_OUT;
 
 /********************************************************************************************************
  ********************************************************************************************************
@@ -100,6 +103,21 @@ static const CPU_INT32U Str_MultOvfThTbl_Int32U[] = {
   (CPU_INT32U)(DEF_INT_32U_MAX_VAL / 36u)                       // 32-bit mult ovf th for base 36.
 };
 
+static const CPU_CHAR Str_HexDigTbl[] = "0123456789ABCDEF";
+
+static const CPU_CHAR Str_DecDigPairTbl[] = {                  // Two-digit decimal strings, from "00" to "99".
+  '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0', '9',
+  '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8', '1', '9',
+  '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2', '8', '2', '9',
+  '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7', '3', '8', '3', '9',
+  '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4', '7', '4', '8', '4', '9',
+  '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6', '5', '7', '5', '8', '5', '9',
+  '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6', '6', '6', '7', '6', '8', '6', '9',
+  '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5', '7', '6', '7', '7', '7', '8', '7', '9',
+  '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8', '5', '8', '6', '8', '7', '8', '8', '8', '9',
+  '9', '0', '9', '1', '9', '2', '9', '3', '9', '4', '9', '5', '9', '6', '9', '7', '9', '8', '9', '9'
+};
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                       LOCAL FUNCTION PROTOTYPES
@@ -121,39 +139,43 @@ static CPU_INT32U Str_ParseNbr_Int32(const CPU_CHAR *p_str,
                                      CPU_BOOLEAN    nbr_signed,
                                      CPU_BOOLEAN    *p_nbr_neg);
 
-static CPU_SIZE_T Str_FmtOutput(CPU_CHAR          *p_str,
-                                CPU_SIZE_T        min_char_cnt,
-                                CPU_SIZE_T        max_char_cnt,
-                                CPU_BOOLEAN       left_justify,
-                                STR_PRINTF_OUT_CB out_cb,
-                                void              *p_out_cb_arg,
-                                CPU_INT32S        rem_size);
-
-static CPU_SIZE_T Str_UnsgnIntFmtOutput(CPU_INT64U        nbr,
-                                        CPU_INT08U        base,
-                                        CPU_SIZE_T        min_digit_cnt,
-                                        CPU_BOOLEAN       left_justify,
-                                        CPU_CHAR          pad_char,
-                                        STR_PRINTF_OUT_CB out_cb,
-                                        void              *p_out_cb_arg,
-                                        CPU_INT32S        rem_size);
-
-static CPU_SIZE_T Str_SngIntFmtOutput(CPU_INT64S        nbr,
-                                      CPU_SIZE_T        min_digit_cnt,
-                                      CPU_BOOLEAN       left_justify,
-                                      CPU_CHAR          pad_char,
-                                      STR_PRINTF_OUT_CB out_cb,
-                                      void              *p_out_cb_arg,
-                                      CPU_INT32S        rem_size);
-
-static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
-                                 void              *p_out_cb_arg,
-                                 CPU_INT16U        max_char_cnt,
-                                 const CPU_CHAR    *format,
-                                 va_list           argp);
-
-static int Str_SprintfCb(int  c,
-                         void *p_arg);
+static void Str_FmtOutput(CPU_CHAR       *p_str,
+                          CPU_SIZE_T     min_char_cnt,
+                          CPU_SIZE_T     max_char_cnt,
+                          CPU_BOOLEAN    left_justify,
+                          STR_PRINTF_OUT *p_out);
+
+static void Str_UnsgnIntFmtOutput(CPU_INT64U     nbr,
+                                  CPU_INT08U     base,
+                                  CPU_SIZE_T     min_digit_cnt,
+                                  CPU_BOOLEAN    left_justify,
+                                  CPU_CHAR       pad_char,
+                                  STR_PRINTF_OUT *p_out);
+
+static void Str_SngIntFmtOutput(CPU_INT64S     nbr,
+                                CPU_SIZE_T     min_digit_cnt,
+                                CPU_BOOLEAN    left_justify,
+                                CPU_CHAR       pad_char,
+                                STR_PRINTF_OUT *p_out);
+
+static CPU_CHAR *Str_FmtDig(CPU_INT64U nbr,
+                            CPU_INT08U base,
+                            CPU_CHAR   *p_buf_end);
+
+static CPU_CHAR *Str_FmtDig_Dec32(CPU_INT32U nbr,
+                                  CPU_CHAR   *p_buf_end);
+
+static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT *p_out,
+                                 const CPU_CHAR *format,
+                                 va_list        argp);
+
+static void Str_PrintfOutWr(STR_PRINTF_OUT *p_out,
+                            const CPU_CHAR *p_data,
+                            CPU_SIZE_T     len);
+
+static void Str_PrintfOutPad(STR_PRINTF_OUT *p_out,
+                             CPU_CHAR       pad_char,
+                             CPU_SIZE_T     pad_cnt);
 
 /********************************************************************************************************
  ********************************************************************************************************
@@ -2062,19 +2084,27 @@ CPU_INT32S Str_ParseNbr_Int32S(const CPU_CHAR *p_str,
  * @return   See Str_PrintfImpl() return value description.
  *
  * @note     (1) See Str_PrintfImpl() notes.
+ *
+ * @note     (2) The callback is called once per output character. Str_PrintfBuf() should be preferred
+ *               when the characters end up being copied to a buffer or sent by blocks anyway.
  *******************************************************************************************************/
 CPU_INT16U Str_Printf(STR_PRINTF_OUT_CB out_cb,
                       void              *p_out_cb_arg,
                       const CPU_CHAR    *format,
                       ...)
 {
-  CPU_INT16U char_cnt;
-  va_list    args;
+  CPU_INT16U     char_cnt;
+  STR_PRINTF_OUT out;
+  va_list        args;
+
+  out.OutCb = out_cb;
+  out.OutCbArg = p_out_cb_arg;
+  out.BufPtr = DEF_NULL;
+  out.CharCnt = 0u;
+  out.MaxCharCnt = (CPU_INT16U)-1;
 
   va_start(args, format);
-  char_cnt = Str_PrintfImpl(out_cb,
-                            p_out_cb_arg,
-                            (CPU_INT16U)-1,
+  char_cnt = Str_PrintfImpl(&out,
                             format,
                             args);
   va_end(args);
@@ -2104,19 +2134,24 @@ CPU_INT16U Str_Sprintf(CPU_CHAR       *p_str,
                        const CPU_CHAR *format,
                        ...)
 {
-  CPU_INT16U         char_cnt;
-  STR_SPRINTF_CB_ARG cb_arg;
-  va_list            args;
+  CPU_INT16U     char_cnt;
+  STR_PRINTF_BUF buf;
+  STR_PRINTF_OUT out;
+  va_list        args;
+
+  //                                                               Format directly in given buffer, never flushed.
+  Str_PrintfBufInit(&buf, p_str, (CPU_SIZE_T)-1, DEF_NULL, DEF_NULL);
 
-  cb_arg.BufPtr = p_str;
-  cb_arg.CurIx = 0u;
+  out.OutCb = DEF_NULL;
+  out.OutCbArg = DEF_NULL;
+  out.BufPtr = &buf;
+  out.CharCnt = 0u;
+  out.MaxCharCnt = (CPU_INT16U)-1;
 
   va_start(args, format);
   //                                                               Format string according to format specifiers and...
   //                                                               ...store formatted in given buffer.
-  char_cnt = Str_PrintfImpl(Str_SprintfCb,
-                            &cb_arg,
-                            (CPU_INT16U)-1,
+  char_cnt = Str_PrintfImpl(&out,
                             format,
                             args);
   va_end(args);
@@ -2153,19 +2188,24 @@ CPU_INT16U Str_Snprintf(CPU_CHAR       *p_str,
                         const CPU_CHAR *format,
                         ...)
 {
-  CPU_INT16U         char_cnt;
-  STR_SPRINTF_CB_ARG cb_arg;
-  va_list            args;
+  CPU_INT16U     char_cnt;
+  STR_PRINTF_BUF buf;
+  STR_PRINTF_OUT out;
+  va_list        args;
 
-  cb_arg.BufPtr = p_str;
-  cb_arg.CurIx = 0u;
+  //                                                               Format directly in given buffer, never flushed.
+  Str_PrintfBufInit(&buf, p_str, (CPU_SIZE_T)-1, DEF_NULL, DEF_NULL);
+
+  out.OutCb = DEF_NULL;
+  out.OutCbArg = DEF_NULL;
+  out.BufPtr = &buf;
+  out.CharCnt = 0u;
+  out.MaxCharCnt = (CPU_INT16U)(size - 1u);
 
   va_start(args, format);
   //                                                               Format string according to format specifiers and...
   //                                                               ...store formatted up to N char in given buffer.
-  char_cnt = Str_PrintfImpl(Str_SprintfCb,
-                            &cb_arg,
-                            size - 1u,
+  char_cnt = Str_PrintfImpl(&out,
                             format,
                             args);
   va_end(args);
@@ -2177,6 +2217,100 @@ CPU_INT16U Str_Snprintf(CPU_CHAR       *p_str,
   return (char_cnt);                                            // See Note #2.
 }
 
+/****************************************************************************************************//**
+ *                                           Str_PrintfBufInit()
+ *
+ * @brief    Initializes a buffered printf() output.
+ *
+ * @param    p_buf           Pointer to the buffered output to initialize.
+ *
+ * @param    p_chunk         Pointer to the caller-provided chunk in which characters are accumulated.
+ *
+ * @param    chunk_len       Length of the chunk, in characters.
+ *
+ * @param    flush_cb        Callback called with the content of the chunk each time it is full and
+ *                           from Str_PrintfBufFlush().
+ *
+ * @param    p_flush_cb_arg  Flush callback argument.
+ *
+ * @note     (1) The chunk is NOT null-terminated by the formatting functions.
+ *******************************************************************************************************/
+void Str_PrintfBufInit(STR_PRINTF_BUF      *p_buf,
+                       CPU_CHAR            *p_chunk,
+                       CPU_SIZE_T          chunk_len,
+                       STR_PRINTF_FLUSH_CB flush_cb,
+                       void                *p_flush_cb_arg)
+{
+  p_buf->ChunkPtr = p_chunk;
+  p_buf->ChunkLen = chunk_len;
+  p_buf->ChunkIx = 0u;
+  p_buf->FlushCb = flush_cb;
+  p_buf->FlushCbArg = p_flush_cb_arg;
+}
+
+/****************************************************************************************************//**
+ *                                               Str_PrintfBuf()
+ *
+ * @brief    printf()-like function that outputs to a buffered output.
+ *
+ * @param    p_buf   Pointer to a buffered output initialized with Str_PrintfBufInit().
+ *
+ * @param    format  Format string.
+ *
+ * @param    ...     Variable number of arguments that will be formatted according to the
+ *                   format specifiers in the format string.
+ *
+ * @return   See Str_PrintfImpl() return value description.
+ *
+ * @note     (1) See Str_PrintfImpl() notes.
+ *
+ * @note     (2) Characters are copied to the chunk by runs and the flush callback is only called
+ *               when the chunk is full. Output from several calls is accumulated in the chunk:
+ *               Str_PrintfBufFlush() MUST be called to output what is left in it.
+ *******************************************************************************************************/
+CPU_INT16U Str_PrintfBuf(STR_PRINTF_BUF *p_buf,
+                         const CPU_CHAR *format,
+                         ...)
+{
+  CPU_INT16U     char_cnt;
+  STR_PRINTF_OUT out;
+  va_list        args;
+
+  out.OutCb = DEF_NULL;
+  out.OutCbArg = DEF_NULL;
+  out.BufPtr = p_buf;
+  out.CharCnt = 0u;
+  out.MaxCharCnt = (CPU_INT16U)-1;
+
+  va_start(args, format);
+  char_cnt = Str_PrintfImpl(&out,
+                            format,
+                            args);
+  va_end(args);
+
+  return (char_cnt);
+}
+
+/****************************************************************************************************//**
+ *                                           Str_PrintfBufFlush()
+ *
+ * @brief    Outputs the characters accumulated in the chunk of a buffered output, if any.
+ *
+ * @param    p_buf   Pointer to a buffered output initialized with Str_PrintfBufInit().
+ *******************************************************************************************************/
+void Str_PrintfBufFlush(STR_PRINTF_BUF *p_buf)
+{
+  if ((p_buf->ChunkIx == 0u)
+      || (p_buf->FlushCb == DEF_NULL)) {
+    return;
+  }
+
+  p_buf->FlushCb(p_buf->ChunkPtr,
+                 p_buf->ChunkIx,
+                 p_buf->FlushCbArg);
+  p_buf->ChunkIx = 0u;
+}
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           LOCAL FUNCTIONS
@@ -2188,10 +2322,7 @@ CPU_INT16U Str_Snprintf(CPU_CHAR       *p_str,
  *
  * @brief    Generic printf()-like function implementation.
  *
- * @param    out_cb          Character output callback (putchar()-like with an extra callback-specific
- *                           argument).
- *
- * @param    p_out_cb_arg    Character output callback argument.
+ * @param    p_out           Pointer to the output to format to.
  *
  * @param    format          Format string.
  *
@@ -2203,20 +2334,23 @@ CPU_INT16U Str_Snprintf(CPU_CHAR       *p_str,
  *                     big enough when truncation occurs.
  *
  * @note     (1) A truncation has occurred whenever the returned value is equal or greater than the
- *               'max_char_cnt' parameter.
+ *               output's 'MaxCharCnt'.
  *
  * @note     (2) A ending null character is not appended automatically by this function. If the null
  *               character is needed, this is the responsibility of the caller function.
+ *
+ * @note     (3) Runs of literal characters are output at once. Specifiers without flags, width or
+ *               length modifier, which are the vast majority, skip the flag parsing loop.
  *******************************************************************************************************/
-static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
-                                 void              *p_out_cb_arg,
-                                 CPU_INT16U        max_char_cnt,
-                                 const CPU_CHAR    *format,
-                                 va_list           argp)
+static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT *p_out,
+                                 const CPU_CHAR *format,
+                                 va_list        argp)
 {
   CPU_CHAR    *p_cur_char;
+  CPU_CHAR    *p_run_start;
+  CPU_CHAR    *p_str;
   CPU_CHAR    pad_char;
-  CPU_SIZE_T  output_char_cnt;
+  CPU_CHAR    c;
   CPU_SIZE_T  min_field_width;
   CPU_SIZE_T  max_field_width;
   CPU_BOOLEAN left_justify;
@@ -2226,18 +2360,17 @@ static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
   CPU_BOOLEAN arg_parsed;
 
   p_cur_char = (CPU_CHAR *)format;
-  output_char_cnt = 0u;
 
   while (*p_cur_char != '\0') {
     //                                                             move format string chars to buffer until a
     //                                                             format control is found.
+    p_run_start = p_cur_char;
     while ((*p_cur_char != '%') && (*p_cur_char != '\0')) {
-      if (output_char_cnt < max_char_cnt) {
-        out_cb((int)(*p_cur_char), p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
       p_cur_char += 1u;
     }
+    if (p_cur_char != p_run_start) {
+      Str_PrintfOutWr(p_out, p_run_start, (CPU_SIZE_T)(p_cur_char - p_run_start));
+    }
 
     if (*p_cur_char == '\0') {
       break;
@@ -2245,6 +2378,33 @@ static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
 
     p_cur_char += 1u;
 
+    switch (*p_cur_char) {                                      // Fast path for bare specifiers (see Note #3).
+      case 'd':
+        Str_SngIntFmtOutput(va_arg(argp, int), 0u, DEF_NO, ' ', p_out);
+        p_cur_char += 1u;
+        continue;
+
+      case 'u':
+        Str_UnsgnIntFmtOutput(va_arg(argp, unsigned int), 10u, 0u, DEF_NO, ' ', p_out);
+        p_cur_char += 1u;
+        continue;
+
+      case 'x':
+        Str_PrintfOutWr(p_out, "0x", 2u);
+        Str_UnsgnIntFmtOutput(va_arg(argp, unsigned int), 16u, 0u, DEF_NO, ' ', p_out);
+        p_cur_char += 1u;
+        continue;
+
+      case 's':
+        p_str = va_arg(argp, CPU_CHAR *);
+        Str_PrintfOutWr(p_out, p_str, Str_Len(p_str));
+        p_cur_char += 1u;
+        continue;
+
+      default:
+        break;
+    }
+
     //                                                             initialize all the flags for this format.
     dot_flag = DEF_NO;
     long_flag = DEF_NO;
@@ -2274,10 +2434,7 @@ static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
       } else {
         switch (ASCII_ToLower(*p_cur_char)) {
           case '%':
-            if (output_char_cnt < max_char_cnt) {
-              out_cb((int)'%', p_out_cb_arg);
-            }
-            output_char_cnt += 1u;
+            Str_PrintfOutWr(p_out, "%", 1u);
             break;
 
           case '-':
@@ -2305,161 +2462,128 @@ static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
             break;
           case 'd':
             if (long_long_flag) {
-              output_char_cnt += Str_SngIntFmtOutput(va_arg(argp, long long),
-                                                     min_field_width,
-                                                     left_justify,
-                                                     pad_char,
-                                                     out_cb,
-                                                     p_out_cb_arg,
-                                                     max_char_cnt - output_char_cnt);
+              Str_SngIntFmtOutput(va_arg(argp, long long),
+                                  min_field_width,
+                                  left_justify,
+                                  pad_char,
+                                  p_out);
             } else if (long_flag) {
-              output_char_cnt += Str_SngIntFmtOutput(va_arg(argp, long),
-                                                     min_field_width,
-                                                     left_justify,
-                                                     pad_char,
-                                                     out_cb,
-                                                     p_out_cb_arg,
-                                                     max_char_cnt - output_char_cnt);
+              Str_SngIntFmtOutput(va_arg(argp, long),
+                                  min_field_width,
+                                  left_justify,
+                                  pad_char,
+                                  p_out);
             } else {
-              output_char_cnt += Str_SngIntFmtOutput(va_arg(argp, int),
-                                                     min_field_width,
-                                                     left_justify,
-                                                     pad_char,
-                                                     out_cb,
-                                                     p_out_cb_arg,
-                                                     max_char_cnt - output_char_cnt);
+              Str_SngIntFmtOutput(va_arg(argp, int),
+                                  min_field_width,
+                                  left_justify,
+                                  pad_char,
+                                  p_out);
             }
             arg_parsed = DEF_YES;
             break;
 
           case 'u':
             if (long_long_flag) {
-              output_char_cnt += Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long long),
-                                                       10u,
-                                                       min_field_width,
-                                                       left_justify,
-                                                       pad_char,
-                                                       out_cb,
-                                                       p_out_cb_arg,
-                                                       max_char_cnt - output_char_cnt);
+              Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long long),
+                                    10u,
+                                    min_field_width,
+                                    left_justify,
+                                    pad_char,
+                                    p_out);
             } else if (long_flag) {
-              output_char_cnt += Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long),
-                                                       10u,
-                                                       min_field_width,
-                                                       left_justify,
-                                                       pad_char,
-                                                       out_cb,
-                                                       p_out_cb_arg,
-                                                       max_char_cnt - output_char_cnt);
+              Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long),
+                                    10u,
+                                    min_field_width,
+                                    left_justify,
+                                    pad_char,
+                                    p_out);
             } else {
-              output_char_cnt += Str_UnsgnIntFmtOutput(va_arg(argp, unsigned int),
-                                                       10u,
-                                                       min_field_width,
-                                                       left_justify,
-                                                       pad_char,
-                                                       out_cb,
-                                                       p_out_cb_arg,
-                                                       max_char_cnt - output_char_cnt);
+              Str_UnsgnIntFmtOutput(va_arg(argp, unsigned int),
+                                    10u,
+                                    min_field_width,
+                                    left_justify,
+                                    pad_char,
+                                    p_out);
             }
             arg_parsed = DEF_YES;
             break;
 
           case 'p':
           case 'x':
-            if (output_char_cnt < max_char_cnt) {
-              out_cb((int)'0', p_out_cb_arg);
-            }
-            output_char_cnt += 1u;
-            if (output_char_cnt < max_char_cnt) {
-              if (*p_cur_char == 'X') {
-                out_cb((int)'X', p_out_cb_arg);
-              } else {
-                out_cb((int)'x', p_out_cb_arg);
-              }
+            if (*p_cur_char == 'X') {
+              Str_PrintfOutWr(p_out, "0X", 2u);
+            } else {
+              Str_PrintfOutWr(p_out, "0x", 2u);
             }
-            output_char_cnt += 1u;
             if (long_flag) {
-              output_char_cnt += Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long),
-                                                       16u,
-                                                       min_field_width,
-                                                       left_justify,
-                                                       pad_char,
-                                                       out_cb,
-                                                       p_out_cb_arg,
-                                                       max_char_cnt - output_char_cnt);
+              Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long),
+                                    16u,
+                                    min_field_width,
+                                    left_justify,
+                                    pad_char,
+                                    p_out);
             } else if (long_long_flag) {
-              output_char_cnt += Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long long),
-                                                       16u,
-                                                       min_field_width,
-                                                       left_justify,
-                                                       pad_char,
-                                                       out_cb,
-                                                       p_out_cb_arg,
-                                                       max_char_cnt - output_char_cnt);
+              Str_UnsgnIntFmtOutput(va_arg(argp, unsigned long long),
+                                    16u,
+                                    min_field_width,
+                                    left_justify,
+                                    pad_char,
+                                    p_out);
             } else {
               if (*p_cur_char == 'p') {
-                output_char_cnt += Str_UnsgnIntFmtOutput((CPU_ADDR)va_arg(argp, void *),
-                                                         16u,
-                                                         min_field_width,
-                                                         left_justify,
-                                                         pad_char,
-                                                         out_cb,
-                                                         p_out_cb_arg,
-                                                         max_char_cnt - output_char_cnt);
+                Str_UnsgnIntFmtOutput((CPU_ADDR)va_arg(argp, void *),
+                                      16u,
+                                      min_field_width,
+                                      left_justify,
+                                      pad_char,
+                                      p_out);
               } else {
-                output_char_cnt += Str_UnsgnIntFmtOutput(va_arg(argp, unsigned int),
-                                                         16u,
-                                                         min_field_width,
-                                                         left_justify,
-                                                         pad_char,
-                                                         out_cb,
-                                                         p_out_cb_arg,
-                                                         max_char_cnt - output_char_cnt);
+                Str_UnsgnIntFmtOutput(va_arg(argp, unsigned int),
+                                      16u,
+                                      min_field_width,
+                                      left_justify,
+                                      pad_char,
+                                      p_out);
               }
             }
             arg_parsed = DEF_YES;
             break;
 
           case 's':
-            output_char_cnt += Str_FmtOutput(va_arg(argp, CPU_CHAR *),
-                                             min_field_width,
-                                             max_field_width,
-                                             left_justify,
-                                             out_cb,
-                                             p_out_cb_arg,
-                                             max_char_cnt - output_char_cnt);
+            Str_FmtOutput(va_arg(argp, CPU_CHAR *),
+                          min_field_width,
+                          max_field_width,
+                          left_justify,
+                          p_out);
             arg_parsed = DEF_YES;
             break;
 
           case 'c':
-            if (output_char_cnt < max_char_cnt) {
-              out_cb(va_arg(argp, int), p_out_cb_arg);
-            }
-            output_char_cnt += 1u;
+            c = (CPU_CHAR)va_arg(argp, int);
+            Str_PrintfOutWr(p_out, &c, 1u);
             arg_parsed = DEF_YES;
             break;
 
           case '\\':
-            if (output_char_cnt < max_char_cnt) {
-              switch (*p_cur_char) {
-                case 'a':
-                  out_cb(0x07, p_out_cb_arg);
-                  break;
-                case 'h':
-                  out_cb(0x08, p_out_cb_arg);
-                  break;
-                case 'r':
-                  out_cb(0x0D, p_out_cb_arg);
-                  break;
-                case 'n':
-                  out_cb(0x0A, p_out_cb_arg);
-                  break;
-                default:
-                  out_cb((int)(*p_cur_char), p_out_cb_arg);
-                  break;
-              }
+            switch (*p_cur_char) {
+              case 'a':
+                c = 0x07;
+                break;
+              case 'h':
+                c = 0x08;
+                break;
+              case 'r':
+                c = 0x0D;
+                break;
+              case 'n':
+                c = 0x0A;
+                break;
+              default:
+                c = *p_cur_char;
+                break;
             }
-            output_char_cnt += 1u;
+            Str_PrintfOutWr(p_out, &c, 1u);
             break;
 
           default:
@@ -2470,29 +2594,193 @@ static CPU_INT16U Str_PrintfImpl(STR_PRINTF_OUT_CB out_cb,
     }
   }
 
-  return (output_char_cnt);
+  return ((CPU_INT16U)p_out->CharCnt);
 }
 
 /****************************************************************************************************//**
- *                                               Str_SprintfCb()
+ *                                               Str_PrintfOutWr()
+ *
+ * @brief    Writes a run of characters to a printf() output.
+ *
+ * @param    p_out   Pointer to the output.
  *
- * @brief    Str_Sprintf() and Str_Snprintf() output callback.
+ * @param    p_data  Pointer to the characters to write.
  *
- * @param    c       Character to be written.
+ * @param    len     Number of characters to write.
  *
- * @param    p_arg   Pointer to an STR_SPRINTF_CB_ARG structure.
+ * @note     (1) All characters are counted, but the ones past the output's 'MaxCharCnt' are dropped.
  *
- * @return   The written character.
+ * @note     (2) Runs are short, so a byte loop is used rather than Mem_Copy().
  *******************************************************************************************************/
-static int Str_SprintfCb(int  c,
-                         void *p_arg)
+static void Str_PrintfOutWr(STR_PRINTF_OUT *p_out,
+                            const CPU_CHAR *p_data,
+                            CPU_SIZE_T     len)
 {
-  STR_SPRINTF_CB_ARG *p_sprintf_cb_arg;
+  STR_PRINTF_BUF *p_buf;
+  CPU_CHAR       *p_chunk;
+  CPU_SIZE_T     wr_len;
+  CPU_SIZE_T     chunk_len;
+  CPU_SIZE_T     i;
+
+  //                                                               Drop what does not fit (see Note #1).
+  if (p_out->CharCnt >= p_out->MaxCharCnt) {
+    wr_len = 0u;
+  } else {
+    wr_len = DEF_MIN(len, p_out->MaxCharCnt - p_out->CharCnt);
+  }
+  p_out->CharCnt += len;
 
-  p_sprintf_cb_arg = (STR_SPRINTF_CB_ARG *)p_arg;
-  p_sprintf_cb_arg->BufPtr[p_sprintf_cb_arg->CurIx++] = (CPU_CHAR)c;
+  p_buf = p_out->BufPtr;
+  if (p_buf == DEF_NULL) {                                      // Per-char callback output.
+    for (i = 0u; i < wr_len; i++) {
+      p_out->OutCb((int)p_data[i], p_out->OutCbArg);
+    }
+    return;
+  }
+
+  while (wr_len > 0u) {                                         // Chunk output, flushed when full.
+    chunk_len = DEF_MIN(wr_len, p_buf->ChunkLen - p_buf->ChunkIx);
+    p_chunk = &p_buf->ChunkPtr[p_buf->ChunkIx];
+    for (i = 0u; i < chunk_len; i++) {                          // See Note #2.
+      p_chunk[i] = p_data[i];
+    }
+    p_buf->ChunkIx += chunk_len;
+    p_data += chunk_len;
+    wr_len -= chunk_len;
 
-  return (c);
+    if (p_buf->ChunkIx == p_buf->ChunkLen) {
+      Str_PrintfBufFlush(p_buf);
+    }
+  }
+}
+
+/****************************************************************************************************//**
+ *                                               Str_PrintfOutPad()
+ *
+ * @brief    Writes padding characters to a printf() output.
+ *
+ * @param    p_out       Pointer to the output.
+ *
+ * @param    pad_char    Character used for padding.
+ *
+ * @param    pad_cnt     Number of padding characters to write.
+ *******************************************************************************************************/
+static void Str_PrintfOutPad(STR_PRINTF_OUT *p_out,
+                             CPU_CHAR       pad_char,
+                             CPU_SIZE_T     pad_cnt)
+{
+  CPU_CHAR   pad_buf[8u];
+  CPU_SIZE_T wr_len;
+  CPU_SIZE_T i;
+
+  wr_len = DEF_MIN(pad_cnt, sizeof(pad_buf));
+  for (i = 0u; i < wr_len; i++) {
+    pad_buf[i] = pad_char;
+  }
+
+  while (pad_cnt > 0u) {
+    wr_len = DEF_MIN(pad_cnt, sizeof(pad_buf));
+    Str_PrintfOutWr(p_out, pad_buf, wr_len);
+    pad_cnt -= wr_len;
+  }
+}
+
+/****************************************************************************************************//**
+ *                                               Str_FmtDig()
+ *
+ * @brief    Converts an unsigned integer to digits, from the least significant one.
+ *
+ * @param    nbr         Number to convert.
+ *
+ * @param    base        Base used for the conversion: 10 or 16.
+ *
+ * @param    p_buf_end   Pointer to the character following the buffer receiving the digits.
+ *
+ * @return   Pointer to the most significant digit.
+ *
+ * @note     (1) Hexadecimal digits are extracted with shifts and masks.
+ *
+ * @note     (2) Decimal digits are produced two at a time from Str_DecDigPairTbl. Divisions by constants
+ *               are turned into multiplications by the compiler, except the ones on 64-bit numbers, so
+ *               a 64-bit number is only divided until it fits on 32 bits, by blocks of 9 digits.
+ *******************************************************************************************************/
+static CPU_CHAR *Str_FmtDig(CPU_INT64U nbr,
+                            CPU_INT08U base,
+                            CPU_CHAR   *p_buf_end)
+{
+  CPU_CHAR   *p_cur_char;
+  CPU_CHAR   *p_blk_end;
+  CPU_INT64U nbr_hi;
+  CPU_INT32U nbr_lo;
+
+  p_cur_char = p_buf_end;
+
+  if (base == 16u) {                                            // See Note #1.
+    do {
+      p_cur_char -= 1u;
+      *p_cur_char = Str_HexDigTbl[nbr & 0xFu];
+      nbr >>= 4u;
+    } while (nbr > 0u);
+
+    return (p_cur_char);
+  }
+
+  while (nbr > DEF_INT_32U_MAX_VAL) {                           // See Note #2.
+    nbr_hi = nbr / 1000000000u;
+    nbr_lo = (CPU_INT32U)(nbr - (nbr_hi * 1000000000u));
+    p_blk_end = p_cur_char;
+    p_cur_char = Str_FmtDig_Dec32(nbr_lo, p_cur_char);
+    while (p_cur_char > (p_blk_end - 9)) {                      // Keep the block's leading zeros.
+      p_cur_char -= 1u;
+      *p_cur_char = '0';
+    }
+    nbr = nbr_hi;
+  }
+
+  p_cur_char = Str_FmtDig_Dec32((CPU_INT32U)nbr, p_cur_char);
+
+  return (p_cur_char);
+}
+
+/****************************************************************************************************//**
+ *                                           Str_FmtDig_Dec32()
+ *
+ * @brief    Converts a 32-bit unsigned integer to decimal digits, from the least significant one.
+ *
+ * @param    nbr         Number to convert.
+ *
+ * @param    p_buf_end   Pointer to the character following the buffer receiving the digits.
+ *
+ * @return   Pointer to the most significant digit.
+ *******************************************************************************************************/
+static CPU_CHAR *Str_FmtDig_Dec32(CPU_INT32U nbr,
+                                  CPU_CHAR   *p_buf_end)
+{
+  CPU_CHAR   *p_cur_char;
+  CPU_INT32U nbr_div;
+  CPU_INT32U pair_ix;
+
+  p_cur_char = p_buf_end;
+  while (nbr >= 100u) {
+    nbr_div = nbr / 100u;
+    pair_ix = (nbr - (nbr_div * 100u)) * 2u;
+    p_cur_char -= 2u;
+    p_cur_char[0] = Str_DecDigPairTbl[pair_ix];
+    p_cur_char[1] = Str_DecDigPairTbl[pair_ix + 1u];
+    nbr = nbr_div;
+  }
+
+  if (nbr >= 10u) {
+    pair_ix = nbr * 2u;
+    p_cur_char -= 2u;
+    p_cur_char[0] = Str_DecDigPairTbl[pair_ix];
+    p_cur_char[1] = Str_DecDigPairTbl[pair_ix + 1u];
+  } else {
+    p_cur_char -= 1u;
+    *p_cur_char = (CPU_CHAR)('0' + nbr);
+  }
+
+  return (p_cur_char);
 }
 
 /****************************************************************************************************//**
@@ -2508,71 +2796,39 @@ static int Str_SprintfCb(int  c,
  *
  * @param    left_justify    Indicates whether to left or right justify.
  *
- * @param    out_cb          Character output callback.
- *
- * @param    p_out_cb_arg    Character output callback argument.
- *
- * @param    rem_size        Remaining character count to process.
+ * @param    p_out           Pointer to the output.
  *******************************************************************************************************/
-static CPU_SIZE_T Str_FmtOutput(CPU_CHAR          *p_str,
-                                CPU_SIZE_T        min_char_cnt,
-                                CPU_SIZE_T        max_char_cnt,
-                                CPU_BOOLEAN       left_justify,
-                                STR_PRINTF_OUT_CB out_cb,
-                                void              *p_out_cb_arg,
-                                CPU_INT32S        rem_size)
+static void Str_FmtOutput(CPU_CHAR       *p_str,
+                          CPU_SIZE_T     min_char_cnt,
+                          CPU_SIZE_T     max_char_cnt,
+                          CPU_BOOLEAN    left_justify,
+                          STR_PRINTF_OUT *p_out)
 {
-  CPU_CHAR   *p_cur_char;
   CPU_CHAR   prev_char;
-  CPU_SIZE_T rem_char_cnt;
+  CPU_SIZE_T str_char_cnt;
   CPU_SIZE_T pad_char_cnt;
-  CPU_SIZE_T output_char_cnt;
   CPU_SIZE_T len;
 
   //                                                               Chk if padding needed.
   len = Str_Len(p_str);
   pad_char_cnt = (len < min_char_cnt) ? min_char_cnt - len : 0u;
-  output_char_cnt = 0u;
 
   //                                                               Pad left if needed.
   if (!left_justify && (pad_char_cnt > 0u)) {
-    while (pad_char_cnt > 0u) {
-      if (rem_size > 0) {
-        out_cb((int)' ', p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
-      pad_char_cnt -= 1u;
-      rem_size -= 1u;
-    }
+    Str_PrintfOutPad(p_out, ' ', pad_char_cnt);
   }
 
   //                                                               Move string to the buffer
-  rem_char_cnt = DEF_MIN(DEF_MAX(min_char_cnt, len), max_char_cnt);
-  p_cur_char = p_str;
+  str_char_cnt = DEF_MIN(DEF_MIN(DEF_MAX(min_char_cnt, len), max_char_cnt), len);
   prev_char = '\0';
-  while ((*p_cur_char != 0u) && (rem_char_cnt > 0u)) {
-    if (rem_size > 0) {
-      out_cb((int)(*p_cur_char), p_out_cb_arg);
-    }
-    prev_char = *p_cur_char;
-    output_char_cnt += 1u;
-    p_cur_char += 1u;
-    rem_char_cnt -= 1u;
-    rem_size -= 1u;
+  if (str_char_cnt > 0u) {
+    Str_PrintfOutWr(p_out, p_str, str_char_cnt);
+    prev_char = p_str[str_char_cnt - 1u];
   }
   //                                                               Pad right if needed.
   if (left_justify && (pad_char_cnt > 0u) && (prev_char != '\n') && (prev_char != '\r')) {
-    while (pad_char_cnt > 0u) {
-      if (rem_size > 0) {
-        out_cb((int)' ', p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
-      pad_char_cnt -= 1u;
-      rem_size -= 1u;
-    }
+    Str_PrintfOutPad(p_out, ' ', pad_char_cnt);
   }
-
-  return (output_char_cnt);
 }
 
 /****************************************************************************************************//**
@@ -2582,7 +2838,7 @@ static CPU_SIZE_T Str_FmtOutput(CPU_CHAR          *p_str,
  *
  * @param    nbr             Number to output as a string.
  *
- * @param    base            Base used for the string conversion.
+ * @param    base            Base used for the string conversion: 10 or 16.
  *
  * @param    min_digit_cnt   Minimum number of digits to output (pad if less digits).
  *
@@ -2590,75 +2846,38 @@ static CPU_SIZE_T Str_FmtOutput(CPU_CHAR          *p_str,
  *
  * @param    pad_char        Character used for padding (normally either ' ' or '0').
  *
- * @param    out_cb          Character output callback.
- *
- * @param    p_out_cb_arg    Character output callback argument.
- *
- * @param    rem_size        Remaining character count to process.
+ * @param    p_out           Pointer to the output.
  *******************************************************************************************************/
-static CPU_SIZE_T Str_UnsgnIntFmtOutput(CPU_INT64U        nbr,
-                                        CPU_INT08U        base,
-                                        CPU_SIZE_T        min_digit_cnt,
-                                        CPU_BOOLEAN       left_justify,
-                                        CPU_CHAR          pad_char,
-                                        STR_PRINTF_OUT_CB out_cb,
-                                        void              *p_out_cb_arg,
-                                        CPU_INT32S        rem_size)
+static void Str_UnsgnIntFmtOutput(CPU_INT64U     nbr,
+                                  CPU_INT08U     base,
+                                  CPU_SIZE_T     min_digit_cnt,
+                                  CPU_BOOLEAN    left_justify,
+                                  CPU_CHAR       pad_char,
+                                  STR_PRINTF_OUT *p_out)
 {
-  CPU_CHAR              *p_cur_char;
-  CPU_CHAR              outbuf[32];
-  CPU_SIZE_T            len;
-  CPU_SIZE_T            pad_char_cnt;
-  CPU_SIZE_T            output_char_cnt;
-  static const CPU_CHAR digits[] = "0123456789ABCDEF";
+  CPU_CHAR   *p_cur_char;
+  CPU_CHAR   outbuf[32];
+  CPU_SIZE_T len;
+  CPU_SIZE_T pad_char_cnt;
 
   //                                                               Build number.
-  p_cur_char = outbuf;
-  do {
-    *p_cur_char = digits[nbr % base];
-    p_cur_char += 1u;
-  } while ((nbr /= base) > 0);
+  p_cur_char = Str_FmtDig(nbr, base, &outbuf[sizeof(outbuf)]);
 
-  len = p_cur_char - outbuf;
+  len = &outbuf[sizeof(outbuf)] - p_cur_char;
   pad_char_cnt = (len < min_digit_cnt) ? min_digit_cnt - len : 0u;
-  output_char_cnt = 0u;
 
   //                                                               Pad left if needed.
   if (!left_justify && (pad_char_cnt > 0u)) {
-    while (pad_char_cnt > 0u) {
-      if (rem_size > 0) {
-        out_cb((int)pad_char, p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
-      pad_char_cnt -= 1u;
-      rem_size -= 1u;
-    }
+    Str_PrintfOutPad(p_out, pad_char, pad_char_cnt);
   }
 
   //                                                               Output number.
-  p_cur_char -= 1u;
-  while (p_cur_char >= outbuf) {
-    if (rem_size > 0) {
-      out_cb((int)(*p_cur_char), p_out_cb_arg);
-    }
-    output_char_cnt += 1u;
-    p_cur_char -= 1u;
-    rem_size -= 1u;
-  }
+  Str_PrintfOutWr(p_out, p_cur_char, len);
 
   //                                                               Pad right if needed.
   if (left_justify && (pad_char_cnt > 0u)) {
-    while (pad_char_cnt > 0u) {
-      if (rem_size > 0) {
-        out_cb((int)pad_char, p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
-      pad_char_cnt -= 1u;
-      rem_size -= 1u;
-    }
+    Str_PrintfOutPad(p_out, pad_char, pad_char_cnt);
   }
-
-  return (output_char_cnt);
 }
 
 /****************************************************************************************************//**
@@ -2674,83 +2893,45 @@ static CPU_SIZE_T Str_UnsgnIntFmtOutput(CPU_INT64U        nbr,
  *
  * @param    pad_char        Character used for padding (normally either ' ' or '0').
  *
- * @param    out_cb          putchar-like callback.
- *
- * @param    p_out_cb_arg    Argument passed to callback.
- *
- * @param    rem_size        Remaining character count to process.
+ * @param    p_out           Pointer to the output.
  *******************************************************************************************************/
-static CPU_SIZE_T Str_SngIntFmtOutput(CPU_INT64S        nbr,
-                                      CPU_SIZE_T        min_digit_cnt,
-                                      CPU_BOOLEAN       left_justify,
-                                      CPU_CHAR          pad_char,
-                                      STR_PRINTF_OUT_CB out_cb,
-                                      void              *p_out_cb_arg,
-                                      CPU_INT32S        rem_size)
+static void Str_SngIntFmtOutput(CPU_INT64S     nbr,
+                                CPU_SIZE_T     min_digit_cnt,
+                                CPU_BOOLEAN    left_justify,
+                                CPU_CHAR       pad_char,
+                                STR_PRINTF_OUT *p_out)
 {
-  CPU_CHAR              *p_cur_char;
-  CPU_CHAR              outbuf[32];
-  CPU_INT64U            abs_val;
-  CPU_SIZE_T            len;
-  CPU_SIZE_T            pad_char_cnt;
-  CPU_SIZE_T            output_char_cnt;
-  static const CPU_CHAR digits[] = "0123456789ABCDEF";
+  CPU_CHAR   *p_cur_char;
+  CPU_CHAR   outbuf[32];
+  CPU_INT64U abs_val;
+  CPU_SIZE_T len;
+  CPU_SIZE_T pad_char_cnt;
 
   //                                                               Build number (absolute value).
-  abs_val = (nbr < 0u) ? -nbr : nbr;
-  p_cur_char = outbuf;
-  do {
-    *p_cur_char = digits[abs_val % 10];
-    abs_val /= 10;
-    p_cur_char += 1u;
-  } while (abs_val > 0);
+  abs_val = (nbr < 0) ? (0u - (CPU_INT64U)nbr) : (CPU_INT64U)nbr;
+  p_cur_char = Str_FmtDig(abs_val, 10u, &outbuf[sizeof(outbuf)]);
 
   //                                                               Add minus sign if needed.
   if (nbr < 0) {
+    p_cur_char -= 1u;
     *p_cur_char = '-';
-    p_cur_char += 1u;
   }
 
-  len = p_cur_char - outbuf;
+  len = &outbuf[sizeof(outbuf)] - p_cur_char;
   pad_char_cnt = (len < min_digit_cnt) ? min_digit_cnt - len : 0u;
-  output_char_cnt = 0u;
 
   //                                                               Pad left if needed.
   if (!left_justify && (pad_char_cnt > 0u)) {
-    while (pad_char_cnt > 0u) {
-      if (rem_size > 0) {
-        out_cb((int)pad_char, p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
-      pad_char_cnt -= 1u;
-      rem_size -= 1u;
-    }
+    Str_PrintfOutPad(p_out, pad_char, pad_char_cnt);
   }
 
   //                                                               Output number.
-  p_cur_char -= 1u;
-  while (p_cur_char >= outbuf) {
-    if (rem_size > 0) {
-      out_cb((int)(*p_cur_char), p_out_cb_arg);
-    }
-    output_char_cnt += 1u;
-    p_cur_char -= 1u;
-    rem_size -= 1u;
-  }
+  Str_PrintfOutWr(p_out, p_cur_char, len);
 
   //                                                               Pad right if needed.
   if (left_justify && (pad_char_cnt > 0u)) {
-    while (pad_char_cnt > 0u) {
-      if (rem_size > 0) {
-        out_cb((int)pad_char, p_out_cb_arg);
-      }
-      output_char_cnt += 1u;
-      pad_char_cnt -= 1u;
-      rem_size -= 1u;
-    }
+    Str_PrintfOutPad(p_out, pad_char, pad_char_cnt);
   }
-
-  return (output_char_cnt);
 }
 
 /****************************************************************************************************//**
@@ -2948,6 +3129,7 @@ static CPU_CHAR *Str_FmtNbr_Int32(CPU_INT32U  nbr,
   CPU_CHAR    *p_str_fmt;
   CPU_DATA    i;
   CPU_INT32U  nbr_fmt = 0;
+  CPU_INT32U  nbr_quo;
   CPU_INT32U  nbr_log;
   CPU_INT08U  nbr_dig_max;
   CPU_INT08U  nbr_dig_min;
@@ -3052,7 +3234,8 @@ static CPU_CHAR *Str_FmtNbr_Int32(CPU_INT32U  nbr,
       if ((nbr_fmt > 0)                                         // If fmt nbr > 0 ...
           || (i == 0u)) {                                       // ... OR on one's  dig to fmt (see Note #2d), ...
                                                                 // ... calc & fmt dig val;
-        dig_val = (CPU_INT08U)(nbr_fmt % nbr_base);
+        nbr_quo = nbr_fmt / nbr_base;                           // One div per dig, rem from mult.
+        dig_val = (CPU_INT08U)(nbr_fmt - (nbr_quo * nbr_base));
         if (dig_val < 10u) {
           *p_str_fmt-- = (CPU_CHAR)(dig_val + '0');
         } else {
@@ -3063,7 +3246,7 @@ static CPU_CHAR *Str_FmtNbr_Int32(CPU_INT32U  nbr,
           }
         }
 
-        nbr_fmt /= nbr_base;                                    // Shift to next more-sig dig.
+        nbr_fmt = nbr_quo;                                      // Shift to next more-sig dig.
       } else if ((nbr_neg == DEF_YES)                           // ... else if nbr neg AND ...
                  && (((lead_char_0 == DEF_NO)                   // ... lead char NOT a '0' dig ...
                       && (nbr_neg_fmtd == DEF_NO))              // ... but neg sign NOT yet fmt'd OR ...
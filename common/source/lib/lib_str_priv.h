@@ -40,6 +40,26 @@
 
 typedef int (*STR_PRINTF_OUT_CB)(int, void *);
 
+typedef void (*STR_PRINTF_FLUSH_CB)(const CPU_CHAR *p_data,
+                                    CPU_SIZE_T     len,
+                                    void           *p_arg);
+
+/*
+ ********************************************************************************************************
+ *                                       BUFFERED PRINTF OUTPUT DATA TYPE
+ *
+ * Note(s) : (1) Characters formatted by Str_PrintfBuf() are accumulated in a caller-provided chunk, which is
+ *               handed to the flush callback when full or on Str_PrintfBufFlush().
+ *******************************************************************************************************/
+
+typedef struct str_printf_buf {
+  CPU_CHAR            *ChunkPtr;                                // Ptr to chunk (see Note #1).
+  CPU_SIZE_T          ChunkLen;                                 // Len of chunk, in chars.
+  CPU_SIZE_T          ChunkIx;                                  // Nbr of chars in chunk.
+  STR_PRINTF_FLUSH_CB FlushCb;                                  // Flush callback.
+  void                *FlushCbArg;                              // Flush callback argument.
+} STR_PRINTF_BUF;
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           FUNCTION PROTOTYPES
@@ -60,6 +80,18 @@ CPU_INT16U Str_Snprintf(CPU_CHAR       *p_str,
                         const CPU_CHAR *format,
                         ...);
 
+void Str_PrintfBufInit(STR_PRINTF_BUF      *p_buf,
+                       CPU_CHAR            *p_chunk,
+                       CPU_SIZE_T          chunk_len,
+                       STR_PRINTF_FLUSH_CB flush_cb,
+                       void                *p_flush_cb_arg);
+
+CPU_INT16U Str_PrintfBuf(STR_PRINTF_BUF *p_buf,
+                         const CPU_CHAR *format,
+                         ...);
+
+void Str_PrintfBufFlush(STR_PRINTF_BUF *p_buf);
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               MODULE
@@ -0,0 +1,203 @@
+#! /usr/bin/env python
+"""
+/***************************************************************************//**
+ * @file
+ * @brief Common - Binary log decoder
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.
+ * The software is governed by the sections of the MSLA applicable to Micrium
+ * Software.
+ *
+ ******************************************************************************/
+
+Formats the frames output by Log_Output() for log channels in BIN output mode.
+
+Each frame holds the address of a LOG_ASYNC_FMT_DATA structure and the
+arguments of the message. The address, the arguments length, each argument and
+each string length are little-endian, whatever the target's byte order. The
+format string and argument lengths it points to are read from the application's
+ELF file.
+
+usage: LogBinDecode.py app.elf [capture.bin]
+
+The capture is read from stdin if no file is given.
+"""
+
+#    General imports
+import sys
+import struct
+import logging
+import argparse
+
+FORMAT = '%(message)s'
+logging.basicConfig(format=FORMAT, level=logging.ERROR)
+
+#    Must match LOG_BIN_FRAME_SYNC in logging.c.
+FRAME_SYNC = 0xA5
+
+#    ELF constants.
+ELF_MAGIC      = b'\x7fELF'
+ELF_CLASS_64   = 2
+ELF_DATA_MSB   = 2
+SHT_NOBITS     = 8
+SHF_ALLOC      = 0x2
+
+
+class ElfImage(object):
+    """Read-only view of the allocated sections of an ELF file, by address."""
+
+    def __init__(self, path):
+        with open(path, 'rb') as f:
+            self.data = f.read()
+
+        if self.data[0:4] != ELF_MAGIC:
+            raise ValueError("%s is not an ELF file" % path)
+
+        self.is64 = (bytearray(self.data)[4] == ELF_CLASS_64)
+        self.endian = '>' if (bytearray(self.data)[5] == ELF_DATA_MSB) else '<'
+        self.addr_size = 8 if self.is64 else 4
+        self.sections = []
+
+        if self.is64:
+            shoff, = struct.unpack_from(self.endian + 'Q', self.data, 0x28)
+            shentsize, shnum = struct.unpack_from(self.endian + 'HH', self.data, 0x3A)
+            sh_fmt = 'IIQQQQ'
+        else:
+            shoff, = struct.unpack_from(self.endian + 'I', self.data, 0x20)
+            shentsize, shnum = struct.unpack_from(self.endian + 'HH', self.data, 0x2E)
+            sh_fmt = 'IIIIII'
+
+        for ix in range(shnum):
+            _, sh_type, sh_flags, sh_addr, sh_offset, sh_size = struct.unpack_from(self.endian + sh_fmt,
+                                                                                   self.data,
+                                                                                   shoff + ix * shentsize)
+            if (sh_flags & SHF_ALLOC) and (sh_type != SHT_NOBITS) and (sh_size != 0):
+                self.sections.append((sh_addr, sh_offset, sh_size))
+
+    def read(self, addr, size):
+        for sh_addr, sh_offset, sh_size in self.sections:
+            if sh_addr <= addr and (addr + size) <= (sh_addr + sh_size):
+                start = sh_offset + (addr - sh_addr)
+                return self.data[start:start + size]
+        raise KeyError("address 0x%x not found in ELF file" % addr)
+
+    def read_addr(self, addr):
+        return struct.unpack(self.endian + ('Q' if self.is64 else 'I'), self.read(addr, self.addr_size))[0]
+
+    def read_str(self, addr):
+        out = bytearray()
+        while True:
+            c = bytearray(self.read(addr + len(out), 1))[0]
+            if c == 0:
+                return out.decode('latin-1')
+            out.append(c)
+
+
+class Decoder(object):
+    """Formats binary log frames, caching the format data read from the ELF file."""
+
+    def __init__(self, elf):
+        self.elf = elf
+        self.fmt_cache = {}
+
+    def fmt_data_get(self, fmt_data_addr):
+        if fmt_data_addr not in self.fmt_cache:
+            #    FmtStr and ArgLenTbl are the first members of LOG_ASYNC_FMT_DATA.
+            fmt_str = self.elf.read_str(self.elf.read_addr(fmt_data_addr))
+            arg_len_tbl_addr = self.elf.read_addr(fmt_data_addr + self.elf.addr_size)
+            arg_len_tbl = bytearray(self.elf.read(arg_len_tbl_addr, fmt_str.count('%')))
+            self.fmt_cache[fmt_data_addr] = (fmt_str, arg_len_tbl)
+        return self.fmt_cache[fmt_data_addr]
+
+    def format(self, fmt_data_addr, args):
+        fmt_str, arg_len_tbl = self.fmt_data_get(fmt_data_addr)
+        out = []
+        pos = 0
+        arg_ix = 0
+        ix = 0
+        while ix < len(fmt_str):
+            c = fmt_str[ix]
+            ix += 1
+            if c != '%':
+                out.append(c)
+                continue
+
+            spec = fmt_str[ix]
+            ix += 1
+            if spec == 's':
+                str_len, = struct.unpack_from('<H', args, pos)
+                pos += 2
+                out.append(args[pos:pos + str_len].rstrip(b'\x00').decode('latin-1'))
+                pos += str_len
+            else:
+                arg_len = arg_len_tbl[arg_ix]
+                val = 0
+                for k in range(arg_len):
+                    val |= bytearray(args)[pos + k] << (8 * k)
+                pos += arg_len
+                if spec == 'd' and (val >> (8 * arg_len - 1)):
+                    val -= (1 << (8 * arg_len))
+                if spec in ('u', 'd'):
+                    out.append(str(val))
+                elif spec == 'x':
+                    out.append('0x%x' % val)
+                elif spec in ('X', 'p'):
+                    out.append('0x%X' % val)
+                elif spec == 'c':
+                    out.append(chr(val))
+                else:
+                    out.append('<?%s>' % spec)
+            arg_ix += 1
+
+        return ''.join(out)
+
+
+def frames(stream, addr_size):
+    """Yields (fmt_data_addr, args) for each frame of a capture, resyncing on FRAME_SYNC."""
+    while True:
+        c = stream.read(1)
+        if not c:
+            return
+        if bytearray(c)[0] != FRAME_SYNC:
+            logging.warning("Skipping octet 0x%02X outside of a frame." % bytearray(c)[0])
+            continue
+
+        hdr = stream.read(addr_size + 2)
+        if len(hdr) < addr_size + 2:
+            return
+        fmt_data_addr = 0
+        for k in range(addr_size):
+            fmt_data_addr |= bytearray(hdr)[k] << (8 * k)
+        args_len, = struct.unpack_from('<H', hdr, addr_size)
+        args = stream.read(args_len)
+        if len(args) < args_len:
+            return
+        yield fmt_data_addr, args
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decode binary log frames output by Log_Output().")
+    parser.add_argument('elf', help="application ELF file the frames were produced by")
+    parser.add_argument('capture', nargs='?', help="binary capture of the log output (default: stdin)")
+    args = parser.parse_args()
+
+    decoder = Decoder(ElfImage(args.elf))
+    stream = open(args.capture, 'rb') if args.capture else getattr(sys.stdin, 'buffer', sys.stdin)
+
+    for fmt_data_addr, frame_args in frames(stream, decoder.elf.addr_size):
+        try:
+            sys.stdout.write(decoder.format(fmt_data_addr, frame_args))
+        except (KeyError, IndexError, struct.error) as err:
+            logging.error("Bad frame at fmt data 0x%x: %s" % (fmt_data_addr, err))
+        sys.stdout.flush()
+
+
+if __name__ == '__main__':
+    main()
@@ -53,6 +53,8 @@
 
 #define  RTOS_MODULE_CUR          RTOS_CFG_MODULE_COMMON
 
+#define  LOG_BIN_FRAME_SYNC       0xA5u                         // First octet of a binary log frame.
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           GLOBAL VARIABLES
@@ -73,6 +75,13 @@ RING_BUF Log_RingBuf = RING_BUF_INIT_NULL();
 static void Log_PrintfTypeSpecGen(CPU_CHAR   *p_type_spec,
                                   CPU_CHAR   spec,
                                   CPU_INT08U len);
+
+static void Log_OutputBin(const LOG_ASYNC_FMT_DATA *p_fmt_data,
+                          CPU_INT08U               *p_fmt_data_addr);
+
+static void Log_OutputBinVal(const LOG_ASYNC_FMT_DATA *p_fmt_data,
+                             const CPU_INT08U         *p_val,
+                             CPU_INT16U               len);
 #endif
 
 /********************************************************************************************************
@@ -105,6 +114,17 @@ CPU_BOOLEAN Log_DataIsAvail(void)
  *                                               Log_Output()
  *
  * @brief    Outputs data accumulated in the ring buffer.
+ *
+ * @note     (1) Messages logged to a channel in BIN output mode are not formatted. Each one is output
+ *               as a frame made of:
+ *                   - LOG_BIN_FRAME_SYNC (1 octet);
+ *                   - the address of the message's LOG_ASYNC_FMT_DATA (CPU_CFG_ADDR_SIZE octets);
+ *                   - the length of the arguments (2 octets);
+ *                   - the arguments, as stored in the ring buffer.
+ *               Multi-octet values, including each argument & string length, are output little-endian
+ *               whatever the CPU's endianness. The format string and argument lengths are
+ *               resolved from the application's ELF file by 'LogBinDecode.py', which formats the
+ *               messages on the host.
  *******************************************************************************************************/
 
 #if (RTOS_CFG_LOG_EN == DEF_ENABLED)
@@ -128,6 +148,13 @@ void Log_Output(void)
     p_fmt_data_addr = RingBufRd(&Log_RingBuf, CPU_CFG_ADDR_SIZE);
     fmt_data_addr = MEM_ADDR_GET((CPU_ADDR)p_fmt_data_addr);
     p_fmt_data = (LOG_ASYNC_FMT_DATA *)fmt_data_addr;
+
+    if (p_fmt_data->IsBin == DEF_YES) {                         // See Note #1.
+      Log_OutputBin(p_fmt_data, (CPU_INT08U *)p_fmt_data_addr);
+      RingBufRdEnd(&Log_RingBuf);
+      continue;
+    }
+
     p_out_func_data = (LOGGING_OUTPUT_FUNC_CB_DATA *)p_fmt_data->OutputFuncArgPtr;
     p_fmt_str = p_fmt_data->FmtStr;
     p_cur_arg_len = p_fmt_data->ArgLenTbl;
@@ -362,3 +389,122 @@ static void Log_PrintfTypeSpecGen(CPU_CHAR   *p_type_spec,
   *p_type_spec = '\0';
 }
 #endif
+
+/****************************************************************************************************//**
+ *                                               Log_OutputBin()
+ *
+ * @brief    Outputs a buffered message as a binary frame (see Log_Output() Note #1).
+ *
+ * @param    p_fmt_data          Pointer to the message's format data.
+ *
+ * @param    p_fmt_data_addr     Pointer to the format data address, at the start of the message in
+ *                               the ring buffer.
+ *
+ * @note     (1) A message is always stored contiguously in the ring buffer, so the arguments follow
+ *               the format data address.
+ *
+ * @note     (2) Arguments are stored in the CPU's byte order. Each one is output little-endian, while
+ *               string characters are output as stored.
+ *******************************************************************************************************/
+
+#if (RTOS_CFG_LOG_EN == DEF_ENABLED)
+static void Log_OutputBin(const LOG_ASYNC_FMT_DATA *p_fmt_data,
+                          CPU_INT08U               *p_fmt_data_addr)
+{
+  LOGGING_OUTPUT_FUNC_CB_DATA *p_out_func_data;
+  const CPU_CHAR              *p_cur_char;
+  const CPU_INT08U            *p_cur_arg_len;
+  CPU_INT08U                  *p_args;
+  CPU_ADDR                    fmt_data_addr;
+  CPU_INT16U                  args_len;
+  CPU_INT16U                  str_len;
+  CPU_INT16U                  pos;
+  CPU_INT16U                  ix;
+
+  p_out_func_data = (LOGGING_OUTPUT_FUNC_CB_DATA *)p_fmt_data->OutputFuncArgPtr;
+  p_args = p_fmt_data_addr + CPU_CFG_ADDR_SIZE;                 // See Note #1.
+
+  args_len = 0u;                                                // Compute len of args from their specs.
+  p_cur_char = p_fmt_data->FmtStr;
+  p_cur_arg_len = p_fmt_data->ArgLenTbl;
+  while (*p_cur_char != '\0') {
+    if (*p_cur_char == '%') {
+      p_cur_char++;
+      if (*p_cur_char == 's') {
+        args_len += sizeof(_LOG_STR_LEN) + MEM_VAL_GET_INT16U(&p_args[args_len]);
+      } else {
+        args_len += *p_cur_arg_len;
+      }
+      p_cur_arg_len++;
+    }
+    p_cur_char++;
+  }
+
+  if (args_len != 0u) {
+    p_args = (CPU_INT08U *)RingBufRd(&Log_RingBuf, args_len);
+  }
+
+  p_fmt_data->OutputFunc(LOG_BIN_FRAME_SYNC, p_out_func_data);
+  fmt_data_addr = (CPU_ADDR)p_fmt_data;
+  for (ix = 0u; ix < CPU_CFG_ADDR_SIZE; ix++) {
+    p_fmt_data->OutputFunc((CPU_INT08U)(fmt_data_addr & DEF_OCTET_MASK), p_out_func_data);
+    fmt_data_addr >>= DEF_OCTET_NBR_BITS;
+  }
+  p_fmt_data->OutputFunc((args_len & DEF_OCTET_MASK), p_out_func_data);
+  p_fmt_data->OutputFunc((args_len >> DEF_OCTET_NBR_BITS), p_out_func_data);
+
+  pos = 0u;                                                     // Output args little-endian (see Note #2).
+  p_cur_char = p_fmt_data->FmtStr;
+  p_cur_arg_len = p_fmt_data->ArgLenTbl;
+  while (*p_cur_char != '\0') {
+    if (*p_cur_char == '%') {
+      p_cur_char++;
+      if (*p_cur_char == 's') {
+        str_len = MEM_VAL_GET_INT16U(&p_args[pos]);
+        Log_OutputBinVal(p_fmt_data, &p_args[pos], sizeof(_LOG_STR_LEN));
+        pos += sizeof(_LOG_STR_LEN);
+        for (ix = 0u; ix < str_len; ix++) {
+          p_fmt_data->OutputFunc(p_args[pos + ix], p_out_func_data);
+        }
+        pos += str_len;
+      } else {
+        Log_OutputBinVal(p_fmt_data, &p_args[pos], *p_cur_arg_len);
+        pos += *p_cur_arg_len;
+      }
+      p_cur_arg_len++;
+    }
+    p_cur_char++;
+  }
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                               Log_OutputBinVal()
+ *
+ * @brief    Outputs a value stored in the CPU's byte order, little-endian.
+ *
+ * @param    p_fmt_data  Pointer to the message's format data.
+ *
+ * @param    p_val       Pointer to the value.
+ *
+ * @param    len         Length of the value, in octets.
+ *******************************************************************************************************/
+
+#if (RTOS_CFG_LOG_EN == DEF_ENABLED)
+static void Log_OutputBinVal(const LOG_ASYNC_FMT_DATA *p_fmt_data,
+                             const CPU_INT08U         *p_val,
+                             CPU_INT16U               len)
+{
+  LOGGING_OUTPUT_FUNC_CB_DATA *p_out_func_data;
+  CPU_INT16U                  ix;
+
+  p_out_func_data = (LOGGING_OUTPUT_FUNC_CB_DATA *)p_fmt_data->OutputFuncArgPtr;
+  for (ix = 0u; ix < len; ix++) {
+#if (CPU_CFG_ENDIAN_TYPE == CPU_ENDIAN_TYPE_BIG)
+    p_fmt_data->OutputFunc(p_val[len - 1u - ix], p_out_func_data);
+#else
+    p_fmt_data->OutputFunc(p_val[ix], p_out_func_data);
+#endif
+  }
+}
+#endif
@@ -56,6 +56,7 @@
 #define  _LOG_CH_CFG_PARAM_IS_VALID_LVL_OFF                       ~, ~
 #define  _LOG_CH_CFG_PARAM_IS_VALID_OUTPUT_MODE_SYNC              ~, ~
 #define  _LOG_CH_CFG_PARAM_IS_VALID_OUTPUT_MODE_ASYNC             ~, ~
+#define  _LOG_CH_CFG_PARAM_IS_VALID_OUTPUT_MODE_BIN               ~, ~
 #define  _LOG_CH_CFG_PARAM_IS_VALID_OUTPUT_MODE_DFLT              ~, ~
 #define  _LOG_CH_CFG_PARAM_IS_VALID_FUNC_NAME_FUNC_EN             ~, ~
 #define  _LOG_CH_CFG_PARAM_IS_VALID_FUNC_NAME_FUNC_DIS            ~, ~
@@ -90,7 +91,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID((ALL), 1, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT."
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT."
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID((ALL), 1, FUNC_NAME) == DEF_NO)
@@ -113,7 +114,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 1, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT"
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT"
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 1, FUNC_NAME) == DEF_NO)
@@ -135,7 +136,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 2, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT"
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT"
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 2, FUNC_NAME) == DEF_NO)
@@ -157,7 +158,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 3, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT"
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT"
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 3, FUNC_NAME) == DEF_NO)
@@ -179,7 +180,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 4, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT"
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT"
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 4, FUNC_NAME) == DEF_NO)
@@ -201,7 +202,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 5, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT"
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT"
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 5, FUNC_NAME) == DEF_NO)
@@ -223,7 +224,7 @@
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 6, OUTPUT_MODE) == DEF_NO)
-#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC or DFLT"
+#error "Log output mode (2nd parameter of log channel cfg) must either be SYNC, ASYNC, BIN or DFLT"
 #endif
 
 #if (_LOG_CH_CFG_PARAM_IS_VALID(LOG_DFLT_CH, 6, FUNC_NAME) == DEF_NO)
@@ -124,8 +124,10 @@ int Logging_OutputFunc(int  c,
  *
  *                                       LOG_ERR("Volume ", (s)p_vol_name, ":", (u)vol_id, " has been closed.\r\n");
  *
- * Note(s)     : (1) The output mode (sync or async) may be selected on a per channel basis using the dedicated
- *                   configuration syntax in rtos_cfg.h
+ * Note(s)     : (1) The output mode (sync, async or bin) may be selected on a per channel basis using the
+ *                   dedicated configuration syntax in rtos_cfg.h. Messages of a bin channel are buffered like
+ *                   async ones but are output by Log_Output() as binary frames, to be formatted on the host
+ *                   (see Log_Output()).
  *
  *               (2) Each print variable argument must be preceded by a compatible specifier inside parentheses,
  *                   except for the string literals. If no specifier is given, string literal type is assumed.
@@ -201,7 +203,9 @@ int Logging_OutputFunc(int  c,
     PP_IF_ELSE(PP_ARE_EQUAL(_LOG_CH_CFG_EFFECTIVE_OUTPUT_MODE_GET ch, RTOS_CFG_LOG_OUTPUT_MODE_SYNC)) ( \
       LOG_SYNC(_LOG_CH_CFG_EFFECTIVE_OUTPUT_FUNC_GET(PP_SCAN ch), LOG_ARG_FMT(ch, args))                \
       )(                                                                                                \
-      LOG_ASYNC(_LOG_CH_CFG_EFFECTIVE_OUTPUT_FUNC_GET(PP_SCAN ch), LOG_ARG_FMT(ch, args))               \
+      LOG_ASYNC(_LOG_CH_CFG_EFFECTIVE_OUTPUT_FUNC_GET(PP_SCAN ch),                                      \
+                PP_ARE_EQUAL(_LOG_CH_CFG_EFFECTIVE_OUTPUT_MODE_GET ch, RTOS_CFG_LOG_OUTPUT_MODE_BIN),   \
+                LOG_ARG_FMT(ch, args))                                                                  \
       )                                                                                                 \
     )
 
@@ -235,7 +239,11 @@ int Logging_OutputFunc(int  c,
  * Description : Synchronously/asynchronously write message through an associated output function. Expands
  *               to an output function call preceded by a compile time argument checking.
  *
- * Argument(s) : __VA_ARGS__       List of print variables (see LOG_ERR()/LOG_DBG()/LOG_VRB()).
+ * Argument(s) : output_func       Output function of the channel.
+ *
+ *               is_bin            '1' if the message is to be output as a binary frame (LOG_ASYNC() only).
+ *
+ *               __VA_ARGS__       List of print variables (see LOG_ERR()/LOG_DBG()/LOG_VRB()).
  *
  * Note(s)     : See LOG_ERR()/LOG_DBG()/LOG_VRB().
  *******************************************************************************************************/
@@ -245,12 +253,12 @@ int Logging_OutputFunc(int  c,
 #define  LOG_SYNC(output_func, arg)                PP_FOR_EACH(_ARG_SPEC_CHK, PP_SCAN arg) \
   _LOG_SYNC_IMPL(output_func, PP_SCAN arg)
 
-#define  LOG_ASYNC(output_func, arg)               PP_FOR_EACH(_ARG_SPEC_CHK, PP_SCAN arg) \
-  _LOG_ASYNC_IMPL(output_func, PP_SCAN arg)
+#define  LOG_ASYNC(output_func, is_bin, arg)       PP_FOR_EACH(_ARG_SPEC_CHK, PP_SCAN arg) \
+  _LOG_ASYNC_IMPL(output_func, is_bin, PP_SCAN arg)
 #else
 #define  LOG_SYNC(output_func, arg)
 
-#define  LOG_ASYNC(output_func, arg)
+#define  LOG_ASYNC(output_func, is_bin, arg)
 #endif
 
 #if (RTOS_CFG_LOG_EN == DEF_ENABLED \
@@ -260,11 +268,12 @@ int Logging_OutputFunc(int  c,
  *                                       LOGGING ARGUMENTS DEFINES
  *******************************************************************************************************/
 
-typedef struct printf_async_fmt_data {
-  const CPU_CHAR     *FmtStr;
+typedef struct printf_async_fmt_data {                          // FmtStr & ArgLenTbl MUST stay first, read by the host ...
+  const CPU_CHAR     *FmtStr;                                   // ... tool decoding binary log frames (see Log_Output()).
   const CPU_INT08U   *ArgLenTbl;
   int (*OutputFunc)(int c, void *p_arg);
   const void * const OutputFuncArgPtr;
+  const CPU_BOOLEAN  IsBin;                                     // Output msg as a binary frame.
 } LOG_ASYNC_FMT_DATA;
 
 #define _LOG_ARG_SPEC_ID_p      0
@@ -557,7 +566,7 @@ typedef CPU_INT16U _LOG_STR_LEN;
 
 #define _LOG_ARGS_TOTAL_SIZE_GET(...)                               0 PP_FOR_EACH(_LOG_ARG_SIZE_ADD, _LOG_ASYNC_FMT_STR_BUILD(__VA_ARGS__), _LOG_ASYNC_ARG_LIST_BUILD(__VA_ARGS__), /* Empty arg. */)
 
-#define _LOG_ASYNC_IMPL(output_func, ...)                           do {                                                                 \
+#define _LOG_ASYNC_IMPL(output_func, is_bin, ...)                   do {                                                                 \
   CPU_INT08U                               *p_buf;                                                                                       \
   static const LOGGING_OUTPUT_FUNC_CB_DATA log_out_func_data = { (int (*)(int))output_func };                                            \
   static const CPU_INT08U                  _printf_arg_len_tbl[] = { PP_IF_ELSE(PP_HAS_ARGS(_LOG_ASYNC_ARG_LEN_TBL_BUILD(__VA_ARGS__)))( \
@@ -569,7 +578,8 @@ typedef CPU_INT16U _LOG_STR_LEN;
   static const LOG_ASYNC_FMT_DATA          _printf_fmt_data = { .FmtStr = _LOG_ASYNC_FMT_STR_BUILD(__VA_ARGS__),                         \
                                                                 .ArgLenTbl = &_printf_arg_len_tbl[0],                                    \
                                                                 .OutputFunc = Logging_OutputFunc,                                        \
-                                                                .OutputFuncArgPtr = &log_out_func_data                                   \
+                                                                .OutputFuncArgPtr = &log_out_func_data,                                  \
+                                                                .IsBin = (is_bin) ? DEF_YES : DEF_NO                                     \
   };                                                                                                                                     \
   CORE_DECLARE_IRQ_STATE;                                                                                                                \
   CORE_ENTER_ATOMIC();                                                                                                                   \
@@ -621,6 +631,7 @@ typedef CPU_INT16U _LOG_STR_LEN;
 #define  RTOS_CFG_LOG_OUTPUT_MODE_DFLT    0
 #define  RTOS_CFG_LOG_OUTPUT_MODE_SYNC    1
 #define  RTOS_CFG_LOG_OUTPUT_MODE_ASYNC   2
+#define  RTOS_CFG_LOG_OUTPUT_MODE_BIN     3
 
 //                                                                 Configuration parameter index.
 #define _LOG_CH_CFG_PARAM_IX_LVL                              1
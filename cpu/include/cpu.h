@@ -474,6 +474,14 @@ CPU_CORE_EXT CPU_TS_TMR_FREQ CPU_TS_TmrFreq_Hz;                 ///< CPU ts tmr
  *
  *                   (2) 'cpu_core.c', if CPU_CFG_TRAIL_ZEROS_ASM_PRESENT  NOT #define'd in '[arch]_cpu_port.h'
  *                                           to enable C-source-optimized function(s)
+ *
+ *               (c) CPU_CmpSwap()       defined in :
+ *
+ *                   (1) 'cpu_a.asm',  if CPU_CFG_CMP_SWAP_ASM_PRESENT         #define'd in '[arch]_cpu_port.h'
+ *                                           to enable exclusive load/store function
+ *
+ *                   (2) 'cpu_core.c', if CPU_CFG_CMP_SWAP_ASM_PRESENT     NOT #define'd in '[arch]_cpu_port.h'
+ *                                           to enable critical section function
  ********************************************************************************************************
  *******************************************************************************************************/
 
@@ -551,6 +559,11 @@ CPU_INT08U CPU_PopCnt32(CPU_INT32U value);
 
 CPU_DATA CPU_RevBits(CPU_DATA val);                             // C-code replacement for asm function
 
+//                                                                 ----------------- CPU ATOMIC FNCTS -----------------
+CPU_BOOLEAN CPU_CmpSwap(CPU_ADDR *p_dest,
+                        CPU_ADDR cmp_val,
+                        CPU_ADDR new_val);
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                   BSP SPECIFIC FUNCTION PROTOTYPES
@@ -1581,3 +1581,46 @@ CPU_DATA CPU_RevBits(CPU_DATA val)
   return (reverse_val);
 }
 #endif
+
+/****************************************************************************************************//**
+ *                                             CPU_CmpSwap()
+ *
+ * @brief    Atomically replaces a CPU address-sized word if it holds an expected value.
+ *
+ * @param    p_dest      Pointer to the word to update.
+ *
+ * @param    cmp_val     Value expected in '*p_dest'.
+ *
+ * @param    new_val     Value to store in '*p_dest' if it equals 'cmp_val'.
+ *
+ * @return   DEF_YES, if '*p_dest' was equal to 'cmp_val' and was replaced by 'new_val',
+ *           DEF_NO,  otherwise.
+ *
+ *               This function is an INTERNAL CPU module function but MAY be called by application function(s).
+ *
+ * @note     (1) This version makes the comparison and the store atomic with a critical section. Ports
+ *               whose architecture provides an exclusive load/store or compare-and-swap instruction
+ *               SHOULD #define CPU_CFG_CMP_SWAP_ASM_PRESENT and implement this function in
+ *               'cpu_a.asm' (see 'cpu.h  FUNCTION PROTOTYPES  Note #2c').
+ *******************************************************************************************************/
+
+#ifndef  CPU_CFG_CMP_SWAP_ASM_PRESENT
+CPU_BOOLEAN CPU_CmpSwap(CPU_ADDR *p_dest,
+                        CPU_ADDR cmp_val,
+                        CPU_ADDR new_val)
+{
+  CPU_BOOLEAN swapped;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();
+  if (*p_dest == cmp_val) {
+    *p_dest = new_val;
+    swapped = DEF_YES;
+  } else {
+    swapped = DEF_NO;
+  }
+  CORE_EXIT_ATOMIC();
+
+  return (swapped);
+}
+#endif
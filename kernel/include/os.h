@@ -136,6 +136,117 @@
 #define  OS_CFG_TASK_SUSPEND_EN             DEF_ENABLED
 #endif
 
+#ifndef OS_CFG_TASK_PROFILE_HIST_EN
+#define  OS_CFG_TASK_PROFILE_HIST_EN        DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TASK_PROFILE_HIST_SIZE
+#define  OS_CFG_TASK_PROFILE_HIST_SIZE      16u
+#endif
+
+#ifndef OS_CFG_TASK_PROFILE_HIST_SHIFT
+#define  OS_CFG_TASK_PROFILE_HIST_SHIFT     6u
+#endif
+
+#ifndef OS_CFG_TASK_STK_CHK_INCR_EN
+#define  OS_CFG_TASK_STK_CHK_INCR_EN        DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TASK_STK_CHK_INCR_WIN
+#define  OS_CFG_TASK_STK_CHK_INCR_WIN       32u
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                           PEND LIST DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_PEND_LIST_PRIO_TBL_EN
+#define  OS_CFG_PEND_LIST_PRIO_TBL_EN       DEF_DISABLED
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                           MUTEX DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_MUTEX_FAST_EN
+#define  OS_CFG_MUTEX_FAST_EN               DEF_DISABLED
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                           QUEUE DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_Q_RING_EN
+#define  OS_CFG_Q_RING_EN                   DEF_DISABLED
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                           BENCHMARK DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_BENCH_EN
+#define  OS_CFG_BENCH_EN                    DEF_DISABLED
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                               TICK DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_TICK_SLACK_EN
+#define  OS_CFG_TICK_SLACK_EN               DEF_DISABLED
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                               ISR DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_ISR_POST_DEFERRED_EN
+#define  OS_CFG_ISR_POST_DEFERRED_EN        DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_ISR_POST_DEFERRED_Q_SIZE
+#define  OS_CFG_ISR_POST_DEFERRED_Q_SIZE    32u
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                               TIMER DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_TMR_WHEEL_EN
+#define  OS_CFG_TMR_WHEEL_EN                DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TMR_WHEEL_SIZE
+#define  OS_CFG_TMR_WHEEL_SIZE              64u
+#endif
+
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                               TRACE DEFAULT CONFIGURATION
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef OS_CFG_TRACE_RING_EN
+#define  OS_CFG_TRACE_RING_EN               DEF_DISABLED
+#endif
+
+#ifndef OS_CFG_TRACE_RING_SIZE
+#define  OS_CFG_TRACE_RING_SIZE             512u
+#endif
 
 /********************************************************************************************************
  ********************************************************************************************************
@@ -168,6 +279,9 @@
  *******************************************************************************************************/
 
 #define  OS_PRIO_TBL_SIZE          (((OS_CFG_PRIO_MAX - 1u) / DEF_INT_CPU_NBR_BITS) + 1u)
+//                                                                 Summarize OSPrioTbl when it spans more than 2 words
+#define  OS_PRIO_TBL_SUMMARY_EN    (((OS_CFG_PRIO_MAX > (2u * DEF_INT_CPU_NBR_BITS)) && (OS_PRIO_TBL_SIZE <= DEF_INT_CPU_NBR_BITS)) \
+                                    ? DEF_ENABLED : DEF_DISABLED)
 
 #define  OS_MSG_EN                 (((OS_CFG_TASK_Q_EN == DEF_ENABLED) || (OS_CFG_Q_EN == DEF_ENABLED)) ? DEF_ENABLED : DEF_DISABLED)
 
@@ -223,6 +337,8 @@
 #define  OS_TASK_PEND_ON_TASK_SEM             (OS_STATE)(7u)    // Pending on signal  to be sent to task
 #define  OS_TASK_PEND_ON_COND_VAR             (OS_STATE)(8u)    // Pending on condition variable
 
+#define  OS_TASK_PEND_ON_NBR                  (OS_TASK_PEND_ON_COND_VAR + 1u)
+
 /********************************************************************************************************
  *                                           TASK PEND STATUS
  *                               (Status codes for OS_TCBs field .PendStatus)
@@ -395,6 +511,41 @@
 #define  OS_STACK_CHECK_VAL                 0x5432DCBAABCD2345UL
 #define  OS_STACK_CHECK_DEPTH               8u
 
+/********************************************************************************************************
+ *                                           TRACE RING EVENTS
+ *******************************************************************************************************/
+
+#define  OS_TRACE_RING_EVT_NONE                      (CPU_INT16U)(0u)
+#define  OS_TRACE_RING_EVT_TASK_SWITCHED_IN          (CPU_INT16U)(1u)   // Val: priority of the task switched in
+#define  OS_TRACE_RING_EVT_TASK_READY                (CPU_INT16U)(2u)
+#define  OS_TRACE_RING_EVT_TASK_DLY                  (CPU_INT16U)(3u)   // Val: delay, in ticks
+#define  OS_TRACE_RING_EVT_TASK_SUSPEND              (CPU_INT16U)(4u)
+#define  OS_TRACE_RING_EVT_TASK_RESUME               (CPU_INT16U)(5u)
+#define  OS_TRACE_RING_EVT_TASK_PRIO_CHANGE          (CPU_INT16U)(6u)   // Val: new priority
+#define  OS_TRACE_RING_EVT_ISR_ENTER                 (CPU_INT16U)(7u)
+#define  OS_TRACE_RING_EVT_ISR_EXIT                  (CPU_INT16U)(8u)
+#define  OS_TRACE_RING_EVT_IDLE_ENTER                (CPU_INT16U)(9u)
+#define  OS_TRACE_RING_EVT_TICK                      (CPU_INT16U)(10u)  // Val: tick counter
+#define  OS_TRACE_RING_EVT_SEM_POST                  (CPU_INT16U)(11u)
+#define  OS_TRACE_RING_EVT_SEM_PEND                  (CPU_INT16U)(12u)
+#define  OS_TRACE_RING_EVT_SEM_PEND_BLOCK            (CPU_INT16U)(13u)
+#define  OS_TRACE_RING_EVT_MUTEX_POST                (CPU_INT16U)(14u)
+#define  OS_TRACE_RING_EVT_MUTEX_PEND                (CPU_INT16U)(15u)
+#define  OS_TRACE_RING_EVT_MUTEX_PEND_BLOCK          (CPU_INT16U)(16u)
+#define  OS_TRACE_RING_EVT_Q_POST                    (CPU_INT16U)(17u)
+#define  OS_TRACE_RING_EVT_Q_PEND                    (CPU_INT16U)(18u)
+#define  OS_TRACE_RING_EVT_Q_PEND_BLOCK              (CPU_INT16U)(19u)
+#define  OS_TRACE_RING_EVT_FLAG_POST                 (CPU_INT16U)(20u)
+#define  OS_TRACE_RING_EVT_FLAG_PEND                 (CPU_INT16U)(21u)
+#define  OS_TRACE_RING_EVT_FLAG_PEND_BLOCK           (CPU_INT16U)(22u)
+#define  OS_TRACE_RING_EVT_TASK_SEM_POST             (CPU_INT16U)(23u)
+#define  OS_TRACE_RING_EVT_TASK_SEM_PEND             (CPU_INT16U)(24u)
+#define  OS_TRACE_RING_EVT_TASK_SEM_PEND_BLOCK       (CPU_INT16U)(25u)
+#define  OS_TRACE_RING_EVT_TASK_MSG_Q_POST           (CPU_INT16U)(26u)
+#define  OS_TRACE_RING_EVT_TASK_MSG_Q_PEND           (CPU_INT16U)(27u)
+#define  OS_TRACE_RING_EVT_TASK_MSG_Q_PEND_BLOCK     (CPU_INT16U)(28u)
+#define  OS_TRACE_RING_EVT_TMR_EXPIRED               (CPU_INT16U)(29u)
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               DATA TYPES
@@ -402,6 +553,7 @@
  *******************************************************************************************************/
 
 typedef struct os_init_cfg OS_INIT_CFG;
+typedef struct os_int_q_rec OS_INT_Q_REC;
 typedef struct os_task_cfg OS_TASK_CFG;
 typedef struct os_stack_cfg OS_STACK_CFG;
 
@@ -410,6 +562,7 @@ typedef struct os_flag_grp OS_FLAG_GRP;
 typedef struct os_msg OS_MSG;
 typedef struct os_msg_pool OS_MSG_POOL;
 typedef struct os_msg_q OS_MSG_Q;
+typedef struct os_msg_slot OS_MSG_SLOT;
 
 typedef struct os_mutex OS_MUTEX;
 
@@ -426,6 +579,7 @@ typedef OS_MON_RES (*OS_MON_ON_ENTER_PTR)(OS_MON *p_mon, void *p_data);
 typedef OS_MON_RES (*OS_MON_ON_EVAL_PTR)(OS_MON *p_mon, void *p_eval_data, void *p_scan_data);
 
 typedef struct os_tcb OS_TCB;
+typedef struct os_prof_hist OS_PROF_HIST;
 
 #if defined(OS_CFG_TLS_TBL_SIZE) && (OS_CFG_TLS_TBL_SIZE > 0u)
 typedef void *OS_TLS;
@@ -442,7 +596,10 @@ typedef struct os_rdy_list OS_RDY_LIST;
 typedef struct os_tick_list OS_TICK_LIST;
 
 typedef void (*OS_TMR_CALLBACK_PTR)(void *p_tmr, void *p_arg);
+
+typedef struct os_trace_rec OS_TRACE_REC;
 typedef struct os_tmr OS_TMR;
+typedef struct os_tmr_spoke OS_TMR_SPOKE;
 
 typedef struct os_pend_list OS_PEND_LIST;
 typedef struct os_pend_obj OS_PEND_OBJ;
@@ -508,6 +665,9 @@ struct os_init_cfg {                                            // Runtime Confi
   CPU_STK_SIZE TaskStkLimit;
   OS_TASK_CFG  StatTaskCfg;
   OS_TASK_CFG  TmrTaskCfg;
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  OS_TASK_CFG  IntQTaskCfg;
+#endif
   MEM_SEG      *MemSeg;
   OS_RATE_HZ           TickRate;
 };
@@ -534,6 +694,10 @@ struct os_pend_list {
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
   OS_OBJ_QTY NbrEntries;
 #endif
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+  CPU_DATA   PrioTbl[OS_PRIO_TBL_SIZE];                         ///< Bitmap of the priorities waiting in the list
+  OS_TCB     *PrioTailTbl[OS_CFG_PRIO_MAX];                     ///< Last waiting task of each priority
+#endif
 };
 
 /********************************************************************************************************
@@ -616,9 +780,22 @@ struct os_msg_pool {                                            // MESSAGE POOL
 #endif
 };
 
+struct os_msg_slot {                                            // MESSAGE RING SLOT
+  void        *MsgPtr;                                          ///< Actual message
+  OS_MSG_SIZE MsgSize;                                          ///< Size of the message (in # bytes)
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  CPU_TS      MsgTS;                                            ///< Time stamp of when message was sent
+#endif
+};
+
 struct os_msg_q {                                               // MESSAGE QUEUE
   OS_MSG     *InPtr;                                            ///< Pointer to next OS_MSG to be inserted  in   the queue
   OS_MSG     *OutPtr;                                           ///< Pointer to next OS_MSG to be extracted from the queue
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  OS_MSG_SLOT *RingPtr;                                         ///< Ring of message slots, DEF_NULL if using OS_MSGs
+  OS_MSG_QTY  RingInIx;                                         ///< Free running index of the next slot to fill
+  OS_MSG_QTY  RingOutIx;                                        ///< Free running index of the next slot to extract
+#endif
   OS_MSG_QTY NbrEntriesSize;                                    ///< Maximum allowable number of entries in the queue
   OS_MSG_QTY NbrEntries;                                        ///< Current number of entries in the queue
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -653,6 +830,9 @@ struct os_mutex {
   OS_MUTEX       *MutexGrpNextPtr;
   OS_TCB         *OwnerTCBPtr;
   OS_NESTING_CTR OwnerNestingCtr;                               ///< Mutex is available when the counter is 0
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  CPU_ADDR       FastOwner;                                     ///< Fast path owner TCB, 0 if free (see os_mutex.c).
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
   CPU_TS         TS;
 #endif
@@ -744,6 +924,24 @@ struct os_mon_data {                                            // MONITOR EVALU
   OS_MON_ON_EVAL_PTR p_on_eval;
 };
 
+/********************************************************************************************************
+ *                                       TASK PROFILING HISTOGRAM
+ *
+ * Note(s) : (1) Bin 0 counts the durations lower than 2^OS_CFG_TASK_PROFILE_HIST_SHIFT timestamp counts.
+ *               Bin n counts the durations from 2^(OS_CFG_TASK_PROFILE_HIST_SHIFT + n - 1) to
+ *               2^(OS_CFG_TASK_PROFILE_HIST_SHIFT + n) - 1 counts. The last bin also counts the longer
+ *               durations.
+ *
+ *           (2) Bins saturate at DEF_INT_16U_MAX_VAL. They are cleared by OSStatReset().
+ *******************************************************************************************************/
+
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+struct os_prof_hist {
+  CPU_INT16U BinTbl[OS_CFG_TASK_PROFILE_HIST_SIZE];             ///< Number of durations per log2 bin (see Note #1)
+  CPU_TS     Max;                                               ///< Longest duration
+};
+#endif
+
 /********************************************************************************************************
  *                                           TASK CONTROL BLOCK
  * Note(s) : (1) The position in the os_tcb structure of the three following pointers should not be
@@ -778,6 +976,9 @@ struct os_tcb {
   OS_TCB      *PendNextPtr;                                     ///< Pointer to next     TCB in pend list.
   OS_TCB      *PendPrevPtr;                                     ///< Pointer to previous TCB in pend list.
   OS_PEND_OBJ *PendObjPtr;                                      ///< Pointer to object pended on.
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+  OS_PRIO     PendPrio;                                         ///< Priority used to insert the task in the pend list.
+#endif
   OS_STATE    PendOn;                                           ///< Indicates what task is pending on
   OS_STATUS   PendStatus;                                       ///< Pend status
 
@@ -809,6 +1010,12 @@ struct os_tcb {
   CPU_BOOLEAN                  IsTickCtrPrevValid;              ///< Flag that indicates if TickCtrPrev is valid
   OS_TICK                      TickCtrPrev;                     ///< Used by OSTimeDlyXX() in PERIODIC mode
   sl_sleeptimer_timer_handle_t TimerHandle;                     ///< Handle to timer
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  OS_TICK                      TickSlack;                       ///< Tolerance accepted on delays and timeouts
+  uint32_t                     TickSlackMatch;                  ///< Timer tick count at which the delay elapses
+  OS_TCB                       *TickSlackNextPtr;               ///< Pointer to next task of the slack list
+  OS_TCB                       *TickSlackPrevPtr;               ///< Pointer to previous task of the slack list
+#endif
 #endif
 
 
@@ -861,11 +1068,26 @@ struct os_tcb {
   CPU_TS        SemPendTimeMax;                                 ///< Max amount of time it took for signal to be received
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+  CPU_TS       ProfRdyTS;                                       ///< Timestamp of when the task was made ready
+  CPU_TS       ProfPendTS;                                      ///< Timestamp of when the task blocked
+  OS_STATE     ProfPendOn;                                      ///< Object type the task blocked on (OS_TASK_PEND_ON_xxx)
+  CPU_BOOLEAN  ProfRdyValid;                                    ///< ProfRdyTS is valid until the task runs
+  OS_PROF_HIST ProfRunHist;                                     ///< Length of the run slices
+  OS_PROF_HIST ProfRdyHist;                                     ///< Latency from ready to running
+  OS_PROF_HIST ProfPendHistTbl[OS_TASK_PEND_ON_NBR];            ///< Time blocked, per object type (OS_TASK_PEND_ON_xxx)
+#endif
+
 #if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
   CPU_STK_SIZE StkUsed;                                         ///< Number of stack elements used from the stack
   CPU_STK_SIZE StkFree;                                         ///< Number of stack elements free on   the stack
 #endif
 
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+  CPU_STK_SIZE StkChkFree;                                      ///< Free entries below the stack watermark
+  CPU_STK_SIZE StkChkSweepIx;                                   ///< Next free entry to sweep, from the stack end
+#endif
+
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_ENABLED)
   CPU_TS SchedLockTimeMax;                                      ///< Maximum scheduler lock time
 #endif
@@ -910,6 +1132,9 @@ struct os_tmr {
   OS_TMR              *NextPtr;                                 ///< Double link list pointers
   OS_TMR              *PrevPtr;
   OS_TICK             Remain;                                   ///< Amount of time remaining before timer expires
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  OS_TICK             Match;                                    ///< Value of OSTmrTickCtr at which the timer expires
+#endif
   OS_TICK             Dly;                                      ///< Delay before start of repeat
   OS_TICK             Period;                                   ///< Period to repeat timer
   OS_OPT              Opt;                                      ///< Options (see OS_OPT_TMR_xxx)
@@ -919,6 +1144,59 @@ struct os_tmr {
   OS_TMR              *DbgNextPtr;
 #endif
 };
+
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+struct os_tmr_spoke {
+  OS_TMR     *FirstPtr;                                         ///< Pointer to list of timers in this spoke
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  OS_OBJ_QTY NbrEntries;                                        ///< Current number of timers in this spoke
+  OS_OBJ_QTY NbrEntriesMax;                                     ///< Peak number of timers in this spoke
+#endif
+};
+#endif
+#endif
+
+/********************************************************************************************************
+ *                                       DEFERRED ISR POST RECORD
+ *
+ * Note(s) : (1) 'Type' is set last by the ISR recording the post, and reset by the ISR handler task once
+ *               the post is performed. A record whose 'Type' is OS_OBJ_TYPE_NONE is thus free or still
+ *               being filled.
+ *******************************************************************************************************/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+struct os_int_q_rec {
+  OS_OBJ_TYPE Type;                                             ///< Type of object posted to, see Note #1
+  void        *ObjPtr;                                          ///< Pointer to the object posted to
+  void        *MsgPtr;                                          ///< Pointer to the message posted (queues only)
+  OS_MSG_SIZE MsgSize;                                          ///< Size of the message posted    (queues only)
+  OS_FLAGS    Flags;                                            ///< Flags posted                  (event flags only)
+  OS_OPT      Opt;                                              ///< Options of the post
+  CPU_TS      TS;                                               ///< Timestamp of the post in the ISR
+};
+#endif
+
+/********************************************************************************************************
+ *                                           TRACE RING RECORD
+ *
+ * Note(s) : (1) Records have a fixed size and are written as-is in the trace ring. A dump of
+ *               OSTraceRingTbl[] or of the records read with OSTraceRingRd() can thus be decoded on the
+ *               host with the OS_TRACE_RING_EVT_xxx values, using 'OSTraceRingDecode.py'.
+ *
+ *           (2) 'Seq' is cleared before the other members of a record are written & set to the record's
+ *               free running write index + 1 once they are. A record whose 'Seq' is 0 or does not match
+ *               its slot is being written or was overwritten, & MUST be ignored.
+ *******************************************************************************************************/
+
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+struct os_trace_rec {
+  CPU_INT32U Seq;                                               ///< Sequence nbr of the record, 0 while written (see Note #2)
+  CPU_TS     Ts;                                                ///< Timestamp of the event (see OS_TS_GET())
+  CPU_INT16U Evt;                                               ///< Event type (see OS_TRACE_RING_EVT_xxx)
+  CPU_INT16U Val;                                               ///< Event specific value
+  void       *ObjPtr;                                           ///< Pointer to the kernel object or task of the event
+  OS_TCB     *TCBPtr;                                           ///< Pointer to the task running when event occurred
+};
 #endif
 
 /********************************************************************************************************
@@ -1000,6 +1278,9 @@ OS_EXT OS_OBJ_QTY OSMutexQty;                                   ///< Number of m
 OS_EXT OS_PRIO  OSPrioCur;                                      ///< Priority of current task
 OS_EXT OS_PRIO  OSPrioHighRdy;                                  ///< Priority of highest priority task
 extern CPU_DATA OSPrioTbl[OS_PRIO_TBL_SIZE];
+#if (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)
+extern CPU_DATA OSPrioTblSummary;                               ///< One bit per non-empty entry of OSPrioTbl
+#endif
 
 //                                                                 QUEUES -------------------------------------
 #if (OS_CFG_Q_EN == DEF_ENABLED)
@@ -1076,7 +1357,11 @@ OS_EXT OS_REG_ID OSTaskRegNextAvailID;                          // Next availabl
 OS_EXT OS_TMR     *OSTmrDbgListPtr;
 OS_EXT OS_OBJ_QTY OSTmrListEntries;                             // Doubly-linked list of timers
 #endif
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+OS_EXT OS_TMR_SPOKE OSTmrWheelTbl[OS_CFG_TMR_WHEEL_SIZE];       // Hashed timer wheel, indexed by expiration tick
+#else
 OS_EXT OS_TMR *OSTmrListPtr;
+#endif
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)                            // Use a Mutex (if available) to protect tmrs
 OS_EXT OS_MUTEX OSTmrMutex;
 #endif
@@ -1090,11 +1375,35 @@ OS_EXT CPU_TS OSTmrTaskTimeMax;
 OS_EXT OS_TICK OSTmrTickCtr;                                    // Current time for the timers
 OS_EXT OS_CTR  OSTmrUpdateCnt;                                  // Counter for updating timers
 OS_EXT OS_CTR  OSTmrUpdateCtr;
+#endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)                // DEFERRED ISR POSTS -------------------------
+OS_EXT OS_INT_Q_REC OSIntQTbl[OS_CFG_ISR_POST_DEFERRED_Q_SIZE]; // Ring of the posts recorded by ISRs
+OS_EXT CPU_INT32U   OSIntQWrIx;                                 // Free running index of the next record to write
+OS_EXT CPU_INT32U   OSIntQRdIx;                                 // Free running index of the next record to post
+OS_EXT OS_OBJ_QTY   OSIntQNbrEntriesMax;                        // Peak number of records waiting to be posted
+OS_EXT CPU_INT32U   OSIntQOvfCtr;                               // Number of ISR posts rejected, ring full
+OS_EXT OS_TCB       OSIntQTaskTCB;                              // TCB of the ISR handler task
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+OS_EXT CPU_TS OSIntQTaskTimeMax;                                // Peak delay between an ISR post and its handling
+#endif
+#endif
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)                       // TICK SLACK ---------------------------------
+OS_EXT OS_TCB     *OSTickSlackListPtr;                          // List of the delayed tasks that accept a slack
+OS_EXT CPU_INT32U OSTickSlackWakeupCtr;                         // Number of task timers that expired
+OS_EXT CPU_INT32U OSTickSlackCoalescedCtr;                      // Number of tasks woken by another task's timer
 #endif
                                                                 // TCBs ---------------------------------------
 OS_EXT OS_TCB *OSTCBCurPtr;                                     // Pointer to currently running TCB
 OS_EXT OS_TCB *OSTCBHighRdyPtr;                                 // Pointer to highest priority  TCB
 
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)                       // TRACE RING ---------------------------------
+OS_EXT OS_TRACE_REC OSTraceRingTbl[OS_CFG_TRACE_RING_SIZE];     // Ring of the last recorded events
+OS_EXT CPU_INT32U   OSTraceRingWrIx;                            // Free running index of the next record to write
+OS_EXT CPU_INT32U   OSTraceRingRdIx;                            // Free running index of the next record to read
+OS_EXT CPU_INT32U   OSTraceRingLostCtr;                         // Number of records overwritten before being read
+OS_EXT CPU_BOOLEAN  OSTraceRingEn;                              // Records are only written when DEF_TRUE
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                      DEPRECATED GLOBAL VARIABLES
@@ -1149,6 +1458,14 @@ extern CPU_STK_SIZE OS_CONST OSCfg_TmrTaskStkLimit;
 extern CPU_STK_SIZE OS_CONST OSCfg_TmrTaskStkSize;
 extern CPU_INT32U OS_CONST   OSCfg_TmrTaskStkSizeRAM;
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+extern OS_PRIO OS_CONST      OSCfg_IntQTaskPrio;
+extern CPU_STK * OS_CONST    OSCfg_IntQTaskStkBasePtr;
+extern CPU_STK_SIZE OS_CONST OSCfg_IntQTaskStkLimit;
+extern CPU_STK_SIZE OS_CONST OSCfg_IntQTaskStkSize;
+extern CPU_INT32U OS_CONST   OSCfg_IntQTaskStkSizeRAM;
+#endif
+
 extern CPU_INT32U OS_CONST OSCfg_DataSizeRAM;
 
 #ifdef  OS_CFG_COMPAT_INIT
@@ -1181,6 +1498,14 @@ extern CPU_STK *OSCfg_TmrTaskStk;
 #endif
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+#ifdef  OS_CFG_COMPAT_INIT
+extern CPU_STK OSCfg_IntQTaskStk[];
+#else
+extern CPU_STK *OSCfg_IntQTaskStk;
+#endif
+#endif
+
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
 extern OS_RATE_HZ OS_CONST   OSCfg_TickRate_Hz;
 #endif
@@ -1301,6 +1626,14 @@ void OSQCreate(OS_Q       *p_q,
                OS_MSG_QTY max_qty,
                RTOS_ERR   *p_err);
 
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+void OSQCreateRing(OS_Q        *p_q,
+                   CPU_CHAR    *p_name,
+                   OS_MSG_SLOT *p_slot_tbl,
+                   OS_MSG_QTY  slot_qty,
+                   RTOS_ERR    *p_err);
+#endif
+
 OS_OBJ_QTY OSQDel(OS_Q     *p_q,
                   OS_OPT   opt,
                   RTOS_ERR *p_err);
@@ -1315,6 +1648,14 @@ void *OSQPend(OS_Q        *p_q,
               CPU_TS      *p_ts,
               RTOS_ERR    *p_err);
 
+OS_MSG_QTY OSQPendMulti(OS_Q        *p_q,
+                        void        *p_void_tbl[],
+                        OS_MSG_SIZE msg_size_tbl[],
+                        OS_MSG_QTY  nbr_max,
+                        OS_TICK     timeout,
+                        OS_OPT      opt,
+                        RTOS_ERR    *p_err);
+
 OS_OBJ_QTY OSQPendAbort(OS_Q     *p_q,
                         OS_OPT   opt,
                         RTOS_ERR *p_err);
@@ -1324,6 +1665,13 @@ void OSQPost(OS_Q        *p_q,
              OS_MSG_SIZE msg_size,
              OS_OPT      opt,
              RTOS_ERR    *p_err);
+
+OS_MSG_QTY OSQPostMulti(OS_Q        *p_q,
+                        void        *p_void_tbl[],
+                        OS_MSG_SIZE msg_size_tbl[],
+                        OS_MSG_QTY  nbr,
+                        OS_OPT      opt,
+                        RTOS_ERR    *p_err);
 #endif
 ///< @}
 
@@ -1352,6 +1700,10 @@ void OS_ConfigureStatTask(OS_TASK_CFG *p_stat_task_cfg);
 void OS_ConfigureTmrTask(OS_TASK_CFG *p_tmr_task_cfg);
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+void OS_ConfigureIntQTask(OS_TASK_CFG *p_int_q_task_cfg);
+#endif
+
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
 void OS_ConfigureTickRate(OS_RATE_HZ tick_rate);
 #endif
@@ -1435,6 +1787,13 @@ void *OSTaskQPend(OS_TICK     timeout,
                   CPU_TS      *p_ts,
                   RTOS_ERR    *p_err);
 
+OS_MSG_QTY OSTaskQPendMulti(void        *p_void_tbl[],
+                            OS_MSG_SIZE msg_size_tbl[],
+                            OS_MSG_QTY  nbr_max,
+                            OS_TICK     timeout,
+                            OS_OPT      opt,
+                            RTOS_ERR    *p_err);
+
 CPU_BOOLEAN OSTaskQPendAbort(OS_TCB   *p_tcb,
                              OS_OPT   opt,
                              RTOS_ERR *p_err);
@@ -1444,6 +1803,13 @@ void OSTaskQPost(OS_TCB      *p_tcb,
                  OS_MSG_SIZE msg_size,
                  OS_OPT      opt,
                  RTOS_ERR    *p_err);
+
+OS_MSG_QTY OSTaskQPostMulti(OS_TCB      *p_tcb,
+                            void        *p_void_tbl[],
+                            OS_MSG_SIZE msg_size_tbl[],
+                            OS_MSG_QTY  nbr,
+                            OS_OPT      opt,
+                            RTOS_ERR    *p_err);
 #endif
 
 #if (OS_CFG_TASK_REG_TBL_SIZE > 0u)
@@ -1501,6 +1867,12 @@ void OSTaskTimeQuantaSet(OS_TCB   *p_tcb,
                          RTOS_ERR *p_err);
 #endif
 
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+void OSTaskTickSlackSet(OS_TCB   *p_tcb,
+                        OS_TICK  slack,
+                        RTOS_ERR *p_err);
+#endif
+
 void OS_TaskReturn(void);
 
 ///< @}
@@ -1651,6 +2023,36 @@ void OSStatReset(RTOS_ERR *p_err);
 
 ///< @}
 
+/****************************************************************************************************//**
+ *                                           TRACE RING RECORDER
+ * @addtogroup KERNEL_TRACE
+ * @{
+ *******************************************************************************************************/
+
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+void OSTraceRingStart(void);
+
+void OSTraceRingStop(void);
+
+CPU_INT32U OSTraceRingRd(OS_TRACE_REC *p_rec_tbl,
+                         CPU_INT32U   rec_nbr_max,
+                         RTOS_ERR     *p_err);
+#endif
+
+///< @}
+
+/****************************************************************************************************//**
+ *                                               SHELL COMMANDS
+ * @addtogroup KERNEL_CORE
+ * @{
+ *******************************************************************************************************/
+
+#ifdef  RTOS_MODULE_COMMON_SHELL_AVAIL
+void OSCmdInit(RTOS_ERR *p_err);
+#endif
+
+///< @}
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                   PORT SPECIFIC FUNCTION PROTOTYPES
@@ -1740,6 +2142,17 @@ void OSTaskSwHook(void);
 #error  "OS_CFG.H, Missing OS_CFG_TICK_EN: Determines whether to use the ticking feature"
 #endif
 
+#if   ((OS_CFG_TICK_SLACK_EN == DEF_ENABLED) \
+  && (OS_CFG_TICK_EN == DEF_DISABLED))
+#error  "OS_CFG.H, OS_CFG_TICK_EN must be enabled to use wakeup coalescing."
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+#if (!MATH_IS_PWR2(OS_CFG_ISR_POST_DEFERRED_Q_SIZE))
+#error  "OS_CFG.H, OS_CFG_ISR_POST_DEFERRED_Q_SIZE must be a power of 2 (8, 16, 32, 64, etc)."
+#endif
+#endif
+
 /********************************************************************************************************
  *                                               EVENT FLAGS
  *******************************************************************************************************/
@@ -1760,6 +2173,12 @@ void OSTaskSwHook(void);
 #error  "OS_CFG.H, Missing OS_CFG_MUTEX_EN: Enable (1) or Disable (0) code generation for MUTEX"
 #endif
 
+#if  ((OS_CFG_MUTEX_FAST_EN == DEF_ENABLED) \
+  && ((OS_CFG_MUTEX_EN == DEF_DISABLED)     \
+  || (OS_CFG_DBG_EN == DEF_DISABLED)))
+#error  "OS_CFG.H, OS_CFG_MUTEX_EN and OS_CFG_DBG_EN must be enabled to use the mutex fast path."
+#endif
+
 /********************************************************************************************************
  *                                               MESSAGE QUEUES
  *******************************************************************************************************/
@@ -1768,6 +2187,11 @@ void OSTaskSwHook(void);
 #error  "OS_CFG.H, Missing OS_CFG_Q_EN: Enable (1) or Disable (0) code generation for QUEUES"
 #endif
 
+#if  ((OS_CFG_Q_RING_EN == DEF_ENABLED) \
+  && (OS_CFG_Q_EN == DEF_DISABLED))
+#error  "OS_CFG.H, OS_CFG_Q_EN must be enabled to use message queue rings."
+#endif
+
 /********************************************************************************************************
  *                                               SEMAPHORES
  *******************************************************************************************************/
@@ -1806,6 +2230,25 @@ void OSTaskSwHook(void);
 #endif
 #endif
 
+#if   ((OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED) \
+  && (OS_CFG_TASK_PROFILE_EN == DEF_DISABLED))
+#error  "OS_CFG.H, OS_CFG_TASK_PROFILE_EN must be enabled to use the task profiling histograms."
+#endif
+
+#if   ((OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED) \
+  && ((OS_CFG_TASK_PROFILE_HIST_SIZE < 2u) || ((OS_CFG_TASK_PROFILE_HIST_SHIFT + OS_CFG_TASK_PROFILE_HIST_SIZE) > 33u)))
+#error  "OS_CFG.H, OS_CFG_TASK_PROFILE_HIST_SIZE must be >= 2 and OS_CFG_TASK_PROFILE_HIST_SHIFT + OS_CFG_TASK_PROFILE_HIST_SIZE - 2 <= 31."
+#endif
+
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+#if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_DISABLED)
+#error  "OS_CFG.H, OS_CFG_STAT_TASK_STK_CHK_EN must be enabled to use incremental stack checking."
+#endif
+#if (OS_CFG_TASK_STK_CHK_INCR_WIN < 1u)
+#error  "OS_CFG.H, OS_CFG_TASK_STK_CHK_INCR_WIN must be >= 1."
+#endif
+#endif
+
 #ifndef OS_CFG_TASK_REG_TBL_SIZE
 #error  "OS_CFG.H, Missing OS_CFG_TASK_REG_TBL_SIZE: Include support for task specific registers"
 #endif
@@ -1821,6 +2264,39 @@ void OSTaskSwHook(void);
   && (OS_CFG_TICK_EN == DEF_DISABLED))
 #error  "OS_CFG.H, OS_CFG_TICK_EN must be enabled to use Timers."
 #endif
+#if   ((OS_CFG_TMR_WHEEL_EN == DEF_ENABLED) \
+  && (!MATH_IS_PWR2(OS_CFG_TMR_WHEEL_SIZE)))
+#error  "OS_CFG.H, OS_CFG_TMR_WHEEL_SIZE must be a power of 2 (8, 16, 32, 64, etc)."
+#endif
+#endif
+
+/********************************************************************************************************
+ *                                           TRACE RECORDERS
+ *******************************************************************************************************/
+
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+#if (OS_CFG_TRACE_EN == DEF_DISABLED)
+#error  "OS_CFG.H, OS_CFG_TRACE_EN must be enabled to use the trace ring recorder."
+#endif
+#if (!MATH_IS_PWR2(OS_CFG_TRACE_RING_SIZE))
+#error  "OS_CFG.H, OS_CFG_TRACE_RING_SIZE must be a power of 2 (8, 16, 32, 64, etc)."
+#endif
+#endif
+
+/********************************************************************************************************
+ *                                               BENCHMARKS
+ *******************************************************************************************************/
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+#if (OS_CFG_TS_EN == DEF_DISABLED)
+#error  "OS_CFG.H, OS_CFG_TS_EN must be enabled to use the kernel benchmarks."
+#endif
+#if (OS_CFG_SEM_EN == DEF_DISABLED)
+#error  "OS_CFG.H, OS_CFG_SEM_EN must be enabled to use the kernel benchmarks."
+#endif
+#if (OS_CFG_TASK_DEL_EN == DEF_DISABLED)
+#error  "OS_CFG.H, OS_CFG_TASK_DEL_EN must be enabled to use the kernel benchmarks."
+#endif
 #endif
 
 /********************************************************************************************************
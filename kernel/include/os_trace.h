@@ -30,14 +30,62 @@
  *
  * Note(s) : (1) The header file os_trace_events.h is the interface between Micrium OS Kernel
  *               and your trace recorder of choice.
+ *
+ *           (2) When the built-in trace ring recorder is enabled, os_trace_events.h is not needed: the
+ *               events are recorded by OS_TraceRingPut() (see os_trace.c).
  ********************************************************************************************************
  *******************************************************************************************************/
 
 #include  <os_cfg.h>
 
 #if (OS_CFG_TRACE_EN == DEF_ENABLED)
+#if (defined(OS_CFG_TRACE_RING_EN) && (OS_CFG_TRACE_RING_EN == DEF_ENABLED))
+
+/********************************************************************************************************
+ *                                   TRACE RING EVENT MACROS (See Note #2)
+ *******************************************************************************************************/
+
+#define  OS_TRACE_INIT()
+#define  OS_TRACE_START()                                       OSTraceRingStart()
+#define  OS_TRACE_STOP()                                        OSTraceRingStop()
+
+#define  OS_TRACE_ISR_ENTER()                                   OS_TraceRingPut(OS_TRACE_RING_EVT_ISR_ENTER, DEF_NULL, 0u)
+#define  OS_TRACE_ISR_EXIT()                                    OS_TraceRingPut(OS_TRACE_RING_EVT_ISR_EXIT, DEF_NULL, 0u)
+#define  OS_TRACE_ON_IDLE_ENTER()                               OS_TraceRingPut(OS_TRACE_RING_EVT_IDLE_ENTER, DEF_NULL, 0u)
+#define  OS_TRACE_TICK_INCREMENT(OSTickCtr)                     OS_TraceRingPut(OS_TRACE_RING_EVT_TICK, DEF_NULL, (OSTickCtr))
+
+#define  OS_TRACE_TASK_SWITCHED_IN(p_tcb)                       OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_SWITCHED_IN, (p_tcb), (p_tcb)->Prio)
+#define  OS_TRACE_TASK_READY(p_tcb)                             OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_READY, (p_tcb), 0u)
+#define  OS_TRACE_TASK_DLY(dly_ticks)                           OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_DLY, DEF_NULL, (dly_ticks))
+#define  OS_TRACE_TASK_SUSPEND(p_tcb)                           OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_SUSPEND, (p_tcb), 0u)
+#define  OS_TRACE_TASK_RESUME(p_tcb)                            OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_RESUME, (p_tcb), 0u)
+#define  OS_TRACE_TASK_PRIO_CHANGE(p_tcb, prio)                 OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_PRIO_CHANGE, (p_tcb), (prio))
+
+#define  OS_TRACE_SEM_POST(p_sem)                               OS_TraceRingPut(OS_TRACE_RING_EVT_SEM_POST, (p_sem), 0u)
+#define  OS_TRACE_SEM_PEND(p_sem)                               OS_TraceRingPut(OS_TRACE_RING_EVT_SEM_PEND, (p_sem), 0u)
+#define  OS_TRACE_SEM_PEND_BLOCK(p_sem)                         OS_TraceRingPut(OS_TRACE_RING_EVT_SEM_PEND_BLOCK, (p_sem), 0u)
+#define  OS_TRACE_MUTEX_POST(p_mutex)                           OS_TraceRingPut(OS_TRACE_RING_EVT_MUTEX_POST, (p_mutex), 0u)
+#define  OS_TRACE_MUTEX_PEND(p_mutex)                           OS_TraceRingPut(OS_TRACE_RING_EVT_MUTEX_PEND, (p_mutex), 0u)
+#define  OS_TRACE_MUTEX_PEND_BLOCK(p_mutex)                     OS_TraceRingPut(OS_TRACE_RING_EVT_MUTEX_PEND_BLOCK, (p_mutex), 0u)
+#define  OS_TRACE_Q_POST(p_q)                                   OS_TraceRingPut(OS_TRACE_RING_EVT_Q_POST, (p_q), 0u)
+#define  OS_TRACE_Q_PEND(p_q)                                   OS_TraceRingPut(OS_TRACE_RING_EVT_Q_PEND, (p_q), 0u)
+#define  OS_TRACE_Q_PEND_BLOCK(p_q)                             OS_TraceRingPut(OS_TRACE_RING_EVT_Q_PEND_BLOCK, (p_q), 0u)
+#define  OS_TRACE_FLAG_POST(p_grp)                              OS_TraceRingPut(OS_TRACE_RING_EVT_FLAG_POST, (p_grp), 0u)
+#define  OS_TRACE_FLAG_PEND(p_grp)                              OS_TraceRingPut(OS_TRACE_RING_EVT_FLAG_PEND, (p_grp), 0u)
+#define  OS_TRACE_FLAG_PEND_BLOCK(p_grp)                        OS_TraceRingPut(OS_TRACE_RING_EVT_FLAG_PEND_BLOCK, (p_grp), 0u)
+#define  OS_TRACE_TASK_SEM_POST(p_tcb)                          OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_SEM_POST, (p_tcb), 0u)
+#define  OS_TRACE_TASK_SEM_PEND(p_tcb)                          OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_SEM_PEND, (p_tcb), 0u)
+#define  OS_TRACE_TASK_SEM_PEND_BLOCK(p_tcb)                    OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_SEM_PEND_BLOCK, (p_tcb), 0u)
+#define  OS_TRACE_TASK_MSG_Q_POST(p_msg_q)                      OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_MSG_Q_POST, (p_msg_q), 0u)
+#define  OS_TRACE_TASK_MSG_Q_PEND(p_msg_q)                      OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_MSG_Q_PEND, (p_msg_q), 0u)
+#define  OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q)                OS_TraceRingPut(OS_TRACE_RING_EVT_TASK_MSG_Q_PEND_BLOCK, (p_msg_q), 0u)
+
+#define  OS_TRACE_TMR_EXPIRED(p_tmr)                            OS_TraceRingPut(OS_TRACE_RING_EVT_TMR_EXPIRED, (p_tmr), 0u)
+
+#else
 #include  "os_trace_events.h"                                   // See Note #1.
 #endif
+#endif
 
 /********************************************************************************************************
  *                                   DEFAULT TRACE EVENT MACROS (EMPTY)
@@ -120,6 +168,10 @@
 #define  OS_TRACE_ON_IDLE_ENTER()
 #endif
 
+#ifndef  OS_TRACE_TMR_EXPIRED
+#define  OS_TRACE_TMR_EXPIRED(p_tmr)
+#endif
+
 #ifndef  OS_TRACE_TASK_MSG_Q_CREATE
 #define  OS_TRACE_TASK_MSG_Q_CREATE(p_msg_q, p_name)
 #endif
@@ -0,0 +1,223 @@
+#! /usr/bin/env python
+"""
+/***************************************************************************//**
+ * @file
+ * @brief Kernel - Trace ring decoder
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.
+ * The software is governed by the sections of the MSLA applicable to Micrium
+ * Software.
+ *
+ ******************************************************************************/
+
+Converts OS_TRACE_REC records recorded by the kernel trace ring to the Chrome
+trace event JSON format, which is opened by chrome://tracing and Perfetto.
+
+The capture is either a memory dump of OSTraceRingTbl[] or the records read
+with OSTraceRingRd(). Records are ordered by their sequence number, and records
+that were being written when the capture was taken are dropped.
+
+usage: OSTraceRingDecode.py [--ptr-size 4|8] [--ts-size 4|8] [--big-endian]
+                            [--ts-freq HZ] [--task ADDR=NAME ...]
+                            [capture.bin] [-o trace.json]
+
+The capture is read from stdin if no file is given.
+"""
+
+#    General imports
+import sys
+import json
+import struct
+import logging
+import argparse
+
+FORMAT = '%(message)s'
+logging.basicConfig(format=FORMAT, level=logging.WARNING)
+
+#    Must match the OS_TRACE_RING_EVT_xxx values in os.h.
+EVT_NAMES = [
+    'None',
+    'Task Switched In',
+    'Task Ready',
+    'Task Dly',
+    'Task Suspend',
+    'Task Resume',
+    'Task Prio Change',
+    'ISR Enter',
+    'ISR Exit',
+    'Idle Enter',
+    'Tick',
+    'Sem Post',
+    'Sem Pend',
+    'Sem Pend Block',
+    'Mutex Post',
+    'Mutex Pend',
+    'Mutex Pend Block',
+    'Q Post',
+    'Q Pend',
+    'Q Pend Block',
+    'Flag Post',
+    'Flag Pend',
+    'Flag Pend Block',
+    'Task Sem Post',
+    'Task Sem Pend',
+    'Task Sem Pend Block',
+    'Task Msg Q Post',
+    'Task Msg Q Pend',
+    'Task Msg Q Pend Block',
+    'Tmr Expired',
+]
+
+EVT_NONE             = 0
+EVT_TASK_SWITCHED_IN = 1
+EVT_ISR_ENTER        = 7
+EVT_ISR_EXIT         = 8
+
+#    Chrome trace ids of the tracks that are not tasks.
+PID      = 1
+TID_ISR  = 0
+
+SEQ_MOD  = 1 << 32
+
+
+class RecLayout(object):
+    """Layout of OS_TRACE_REC for a target, following the C alignment rules."""
+
+    def __init__(self, ptr_size, ts_size, big_endian):
+        fields = [('Seq', 4), ('Ts', ts_size), ('Evt', 2), ('Val', 2), ('ObjPtr', ptr_size), ('TCBPtr', ptr_size)]
+        codes = {2: 'H', 4: 'I', 8: 'Q'}
+
+        fmt = '>' if big_endian else '<'
+        offset = 0
+        for _, size in fields:
+            pad = (-offset) % size
+            fmt += 'x' * pad + codes[size]
+            offset += pad + size
+        align = max(size for _, size in fields)
+        fmt += 'x' * ((-offset) % align)
+
+        self.fmt = fmt
+        self.size = struct.calcsize(fmt)
+        self.names = [name for name, _ in fields]
+
+
+def records(data, layout):
+    """Returns the complete records of a capture, from the oldest to the most recent."""
+    recs = []
+    for pos in range(0, len(data) - layout.size + 1, layout.size):
+        rec = dict(zip(layout.names, struct.unpack_from(layout.fmt, data, pos)))
+        if (rec['Seq'] == 0) or (rec['Evt'] == EVT_NONE):
+            continue                                            # Being written or never written.
+        recs.append(rec)
+
+    if not recs:
+        return recs
+
+    #    Sequence numbers wrap; a capture spans far less than half of their range.
+    ref = recs[0]['Seq']
+    recs.sort(key=lambda r: (r['Seq'] - ref + SEQ_MOD // 2) % SEQ_MOD)
+
+    lost = 0
+    for prev, cur in zip(recs, recs[1:]):
+        lost += ((cur['Seq'] - prev['Seq']) % SEQ_MOD) - 1
+    if lost:
+        logging.warning("%u record(s) missing from the capture." % lost)
+
+    return recs
+
+
+def convert(recs, ts_size, ts_freq, task_names):
+    """Converts records to a list of Chrome trace events."""
+    events = []
+    tids = {}
+    ts_mod = 1 << (8 * ts_size)
+    ts_base = None
+    ts_prev = 0
+    ts_wraps = 0
+    task_cur = None
+    isr_nest = 0
+
+    def tid_get(tcb):
+        if tcb not in tids:
+            tids[tcb] = len(tids) + 1
+            name = task_names.get(tcb, 'Task 0x%x' % tcb)
+            events.append({'ph': 'M', 'pid': PID, 'tid': tids[tcb], 'name': 'thread_name', 'args': {'name': name}})
+        return tids[tcb]
+
+    events.append({'ph': 'M', 'pid': PID, 'tid': TID_ISR, 'name': 'thread_name', 'args': {'name': 'ISR'}})
+
+    for rec in recs:
+        if ts_base is None:
+            ts_base = rec['Ts']
+        elif rec['Ts'] < ts_prev:                               # Timestamp counter wrapped.
+            ts_wraps += 1
+        ts_prev = rec['Ts']
+        ts_us = ((rec['Ts'] + ts_wraps * ts_mod) - ts_base) * 1000000.0 / ts_freq
+
+        evt = rec['Evt']
+        name = EVT_NAMES[evt] if evt < len(EVT_NAMES) else 'Evt %u' % evt
+
+        if evt == EVT_TASK_SWITCHED_IN:
+            if task_cur is not None:
+                events.append({'ph': 'E', 'pid': PID, 'tid': tid_get(task_cur), 'ts': ts_us})
+            task_cur = rec['ObjPtr']
+            events.append({'ph': 'B', 'pid': PID, 'tid': tid_get(task_cur), 'ts': ts_us,
+                           'name': 'Running', 'args': {'prio': rec['Val']}})
+        elif evt == EVT_ISR_ENTER:
+            isr_nest += 1
+            events.append({'ph': 'B', 'pid': PID, 'tid': TID_ISR, 'ts': ts_us, 'name': 'ISR'})
+        elif evt == EVT_ISR_EXIT:
+            if isr_nest > 0:                                    # Enter may precede the capture.
+                isr_nest -= 1
+                events.append({'ph': 'E', 'pid': PID, 'tid': TID_ISR, 'ts': ts_us})
+        else:
+            tid = tid_get(rec['TCBPtr']) if rec['TCBPtr'] else TID_ISR
+            events.append({'ph': 'i', 's': 't', 'pid': PID, 'tid': tid, 'ts': ts_us, 'name': name,
+                           'args': {'obj': '0x%x' % rec['ObjPtr'], 'val': rec['Val']}})
+
+    return events
+
+
+def task_arg(text):
+    addr, _, name = text.partition('=')
+    if not name:
+        raise argparse.ArgumentTypeError("expected ADDR=NAME, got '%s'" % text)
+    return int(addr, 0), name
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Convert a kernel trace ring capture to Chrome trace JSON.")
+    parser.add_argument('capture', nargs='?', help="binary capture of the trace records (default: stdin)")
+    parser.add_argument('-o', '--output', help="JSON file to write (default: stdout)")
+    parser.add_argument('--ptr-size', type=int, choices=(4, 8), default=4, help="target pointer size, in octets")
+    parser.add_argument('--ts-size', type=int, choices=(4, 8), default=4, help="target CPU_TS size, in octets")
+    parser.add_argument('--big-endian', action='store_true', help="target is big-endian")
+    parser.add_argument('--ts-freq', type=float, default=1000000.0,
+                        help="timestamp frequency, in Hz, as returned by CPU_TS_TmrFreqGet()")
+    parser.add_argument('--task', type=task_arg, action='append', default=[], metavar='ADDR=NAME',
+                        help="name to display for the task whose OS_TCB is at ADDR")
+    args = parser.parse_args()
+
+    layout = RecLayout(args.ptr_size, args.ts_size, args.big_endian)
+
+    stream = open(args.capture, 'rb') if args.capture else getattr(sys.stdin, 'buffer', sys.stdin)
+    data = stream.read()
+    if len(data) % layout.size:
+        logging.warning("Capture size is not a multiple of the %u-octet record size." % layout.size)
+
+    events = convert(records(data, layout), args.ts_size, args.ts_freq, dict(args.task))
+
+    out = open(args.output, 'w') if args.output else sys.stdout
+    json.dump({'traceEvents': events, 'displayTimeUnit': 'ns'}, out, indent=1)
+    out.write('\n')
+
+
+if __name__ == '__main__':
+    main()
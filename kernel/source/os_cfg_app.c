@@ -84,6 +84,14 @@ CPU_STK *OSCfg_TmrTaskStk;
 #endif
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+#ifdef  OS_CFG_COMPAT_INIT
+CPU_STK OSCfg_IntQTaskStk[OS_CFG_INT_Q_TASK_STK_SIZE];
+#else
+CPU_STK *OSCfg_IntQTaskStk;
+#endif
+#endif
+
 /********************************************************************************************************
  *                                           CONFIGURATION VARIABLES
  *******************************************************************************************************/
@@ -150,6 +158,22 @@ CPU_INT32U   OSCfg_TmrTaskStkSizeRAM = 0u;
 #endif
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+#ifdef  OS_CFG_COMPAT_INIT
+OS_PRIO const      OSCfg_IntQTaskPrio = OS_CFG_INT_Q_TASK_PRIO;
+CPU_STK * const    OSCfg_IntQTaskStkBasePtr = &OSCfg_IntQTaskStk[0];
+CPU_STK_SIZE const OSCfg_IntQTaskStkLimit = ((OS_CFG_INT_Q_TASK_STK_SIZE * OS_CFG_TASK_STK_LIMIT_PCT_EMPTY) / 100u);
+CPU_STK_SIZE const OSCfg_IntQTaskStkSize = OS_CFG_INT_Q_TASK_STK_SIZE;
+CPU_INT32U const   OSCfg_IntQTaskStkSizeRAM = sizeof(OSCfg_IntQTaskStk);
+#else
+OS_PRIO      OSCfg_IntQTaskPrio = 0u;
+CPU_STK      *OSCfg_IntQTaskStkBasePtr = DEF_NULL;
+CPU_STK_SIZE OSCfg_IntQTaskStkLimit = 0u;
+CPU_STK_SIZE OSCfg_IntQTaskStkSize = 0u;
+CPU_INT32U   OSCfg_IntQTaskStkSizeRAM = 0u;
+#endif
+#endif
+
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
 #ifdef  OS_CFG_COMPAT_INIT
 __USED OS_RATE_HZ const   OSCfg_TickRate_Hz = OS_CFG_TICK_RATE_HZ;
@@ -177,6 +201,10 @@ CPU_INT32U const OSCfg_DataSizeRAM = 0u
                                      + sizeof(OSCfg_TmrTaskStk)
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+                                     + sizeof(OSCfg_IntQTaskStk)
+#endif
+
 #if (OS_CFG_ISR_STK_SIZE > 0u)
                                      + sizeof(OSCfg_ISRStk)
 #endif
@@ -246,6 +274,14 @@ void OSCfg_Init(void)
   (void)&OSCfg_TmrTaskStkSize;
   (void)&OSCfg_TmrTaskStkSizeRAM;
 #endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  (void)&OSCfg_IntQTaskPrio;
+  (void)&OSCfg_IntQTaskStkBasePtr;
+  (void)&OSCfg_IntQTaskStkLimit;
+  (void)&OSCfg_IntQTaskStkSize;
+  (void)&OSCfg_IntQTaskStkSizeRAM;
+#endif
 }
 
 /********************************************************************************************************
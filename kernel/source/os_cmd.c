@@ -0,0 +1,1487 @@
+/***************************************************************************//**
+ * @file
+ * @brief Kernel - Shell Commands
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.  This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                       DEPENDENCIES & AVAIL CHECK(S)
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#include  <rtos_description.h>
+
+#if (defined(RTOS_MODULE_KERNEL_AVAIL) \
+  && defined(RTOS_MODULE_COMMON_SHELL_AVAIL))
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               INCLUDE FILES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  MICRIUM_SOURCE
+#include "../include/os.h"
+#include "os_priv.h"
+#include "os_cmd_priv.h"
+
+#if (OS_CMD_EN == DEF_ENABLED)
+#include  <common/include/shell.h>
+#include  <common/include/lib_str.h>
+#include  <common/source/lib/lib_str_priv.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const CPU_CHAR *os_cmd__c = "$Id: $";
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               LOCAL DEFINES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  OS_CMD_HELP                                ("--help")
+#define  OS_CMD_HELP_SHORT                          ("-h")
+
+#define  OS_CMD_OUTPUT_ERR_ARG_INVALID              ("Invalid argument\r\n")
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+#define  OS_CMD_BENCH_ITER                          ("-n")
+#define  OS_CMD_BENCH_TASKS                         ("-t")
+
+#define  OS_CMD_BENCH_ITER_DFLT                     1000u
+#define  OS_CMD_BENCH_TASK_NBR_MAX                  8u
+#define  OS_CMD_BENCH_TASK_STK_SIZE                 256u
+#define  OS_CMD_BENCH_TMR_DLY                       10000u
+#define  OS_CMD_BENCH_PEND_LIST_WAITER_NBR          8u          // Waiting TCBs per contending task of 'pend_list'.
+
+#define  OS_CMD_BENCH_HELP_INFO                     ("usage: os_bench [-n ITER] [-t TASKS]\r\n"                                 \
+                                                     "\r\n"                                                                     \
+                                                     " -h,--help     this help message\r\n"                                     \
+                                                     " -n ITER       number of operations per benchmark (default 1000)\r\n"     \
+                                                     " -t TASKS      maximum number of contending tasks (default 1, max 8)\r\n" \
+                                                     "\r\n"                                                                     \
+                                                     "Results are printed as CSV: bench,tasks,iter,cycles_per_op,ops_per_sec\r\n")
+#endif
+
+#if (OS_CMD_PROF_EN == DEF_ENABLED)
+#define  OS_CMD_PROF_RESET                          ("--reset")
+#define  OS_CMD_PROF_TASK_NAME_LEN_MAX              32u
+
+#define  OS_CMD_PROF_HELP_INFO                      ("usage: os_prof [--reset]\r\n"                                               \
+                                                     "\r\n"                                                                       \
+                                                     " -h,--help     this help message\r\n"                                       \
+                                                     "    --reset    clear the histograms after printing them\r\n"                \
+                                                     "\r\n"                                                                       \
+                                                     "Prints the non-empty task profiling histograms as CSV, in timestamp counts:\r\n" \
+                                                     " run          length of the run slices\r\n"                                \
+                                                     " rdy          latency from ready to running\r\n"                           \
+                                                     " <obj>        time blocked on a kernel object type\r\n")
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               DATA TYPES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+/*
+ ********************************************************************************************************
+ *                                       BENCHMARK FUNCTION DATA TYPE
+ *
+ * Note(s) : (1) A benchmark function performs 'iter' operations with 'task_nbr' contending tasks and
+ *               returns the number of timestamp counts (see OS_TS_GET()) it took.
+ *******************************************************************************************************/
+
+typedef CPU_TS (*OS_CMD_BENCH_FNCT)(CPU_INT32U iter,
+                                    CPU_INT32U task_nbr,
+                                    RTOS_ERR   *p_err);
+
+typedef struct os_cmd_bench {
+  const CPU_CHAR    *NamePtr;                                   // Name printed in the first column of the results.
+  OS_CMD_BENCH_FNCT Fnct;                                       // Function running the benchmark.
+  CPU_BOOLEAN       IsContended;                                // Run with 1 to TASKS contending tasks.
+} OS_CMD_BENCH;
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                       LOCAL FUNCTION PROTOTYPES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+static CPU_INT16S OSCmd_Bench(CPU_INT16U      argc,
+                              CPU_CHAR        *p_argv[],
+                              SHELL_OUT_FNCT  out_fnct,
+                              SHELL_CMD_PARAM *p_cmd_param);
+
+static CPU_TS OSCmd_BenchSem(CPU_INT32U iter,
+                             CPU_INT32U task_nbr,
+                             RTOS_ERR   *p_err);
+
+static CPU_TS OSCmd_BenchSemHandoff(CPU_INT32U iter,
+                                    CPU_INT32U task_nbr,
+                                    RTOS_ERR   *p_err);
+
+static void OSCmd_BenchSemWaiterTask(void *p_arg);
+
+static void OSCmd_BenchTasksCreate(CPU_INT32U  task_nbr,
+                                   OS_TASK_PTR p_task,
+                                   void        *p_arg,
+                                   RTOS_ERR    *p_err);
+
+static CPU_TS OSCmd_BenchCtxSw(CPU_INT32U iter,
+                               CPU_INT32U task_nbr,
+                               RTOS_ERR   *p_err);
+
+static void OSCmd_BenchCtxSwTask(void *p_arg);
+
+static CPU_TS OSCmd_BenchTaskSem(CPU_INT32U iter,
+                                 CPU_INT32U task_nbr,
+                                 RTOS_ERR   *p_err);
+
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchMutex(CPU_INT32U iter,
+                               CPU_INT32U task_nbr,
+                               RTOS_ERR   *p_err);
+
+static CPU_TS OSCmd_BenchMutexContended(CPU_INT32U iter,
+                                        CPU_INT32U task_nbr,
+                                        RTOS_ERR   *p_err);
+
+static void OSCmd_BenchMutexWaiterTask(void *p_arg);
+#endif
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchQ(CPU_INT32U iter,
+                           CPU_INT32U task_nbr,
+                           RTOS_ERR   *p_err);
+
+static CPU_TS OSCmd_BenchQHandoff(CPU_INT32U iter,
+                                  CPU_INT32U task_nbr,
+                                  RTOS_ERR   *p_err);
+
+static void OSCmd_BenchQWaiterTask(void *p_arg);
+#endif
+
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchTaskQHandoff(CPU_INT32U iter,
+                                      CPU_INT32U task_nbr,
+                                      RTOS_ERR   *p_err);
+
+static void OSCmd_BenchTaskQWaiterTask(void *p_arg);
+#endif
+
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchFlag(CPU_INT32U iter,
+                              CPU_INT32U task_nbr,
+                              RTOS_ERR   *p_err);
+
+static CPU_TS OSCmd_BenchFlagHandoff(CPU_INT32U iter,
+                                     CPU_INT32U task_nbr,
+                                     RTOS_ERR   *p_err);
+
+static void OSCmd_BenchFlagWaiterTask(void *p_arg);
+#endif
+
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchTmr(CPU_INT32U iter,
+                             CPU_INT32U task_nbr,
+                             RTOS_ERR   *p_err);
+
+static void OSCmd_BenchTmrCallback(void *p_tmr,
+                                   void *p_arg);
+#endif
+
+static CPU_TS OSCmd_BenchPendList(CPU_INT32U iter,
+                                  CPU_INT32U task_nbr,
+                                  RTOS_ERR   *p_err);
+#endif
+
+#if (OS_CMD_PROF_EN == DEF_ENABLED)
+static CPU_INT16S OSCmd_Prof(CPU_INT16U      argc,
+                             CPU_CHAR        *p_argv[],
+                             SHELL_OUT_FNCT  out_fnct,
+                             SHELL_CMD_PARAM *p_cmd_param);
+
+static void OSCmd_ProfHistOutput(const CPU_CHAR     *p_task_name,
+                                 const CPU_CHAR     *p_hist_name,
+                                 const OS_PROF_HIST *p_hist,
+                                 SHELL_OUT_FNCT     out_fnct);
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               LOCAL TABLES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+static SHELL_CMD OSCmdTbl[] =
+{
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+  { "os_bench", OSCmd_Bench },
+#endif
+#if (OS_CMD_PROF_EN == DEF_ENABLED)
+  { "os_prof", OSCmd_Prof },
+#endif
+  { 0, 0 }
+};
+
+#if (OS_CMD_PROF_EN == DEF_ENABLED)                             // Names of the blocking histograms, per OS_TASK_PEND_ON_xxx.
+static const CPU_CHAR *OSCmd_ProfPendOnNameTbl[OS_TASK_PEND_ON_NBR] =
+{
+  DEF_NULL,
+  "flag",
+  "task_q",
+  DEF_NULL,
+  "mutex",
+  "q",
+  "sem",
+  "task_sem",
+  "cond_var"
+};
+#endif
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+static const OS_CMD_BENCH OSCmd_BenchTbl[] =
+{
+  { "ctx_sw", OSCmd_BenchCtxSw, DEF_NO },
+  { "sem", OSCmd_BenchSem, DEF_NO },
+  { "sem_handoff", OSCmd_BenchSemHandoff, DEF_YES },
+  { "task_sem", OSCmd_BenchTaskSem, DEF_NO },
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+  { "mutex", OSCmd_BenchMutex, DEF_NO },
+  { "mutex_contended", OSCmd_BenchMutexContended, DEF_YES },
+#endif
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+  { "q", OSCmd_BenchQ, DEF_NO },
+  { "q_handoff", OSCmd_BenchQHandoff, DEF_YES },
+#endif
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+  { "task_q_handoff", OSCmd_BenchTaskQHandoff, DEF_NO },
+#endif
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+  { "flag", OSCmd_BenchFlag, DEF_NO },
+  { "flag_handoff", OSCmd_BenchFlagHandoff, DEF_YES },
+#endif
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+  { "tmr", OSCmd_BenchTmr, DEF_NO },
+#endif
+  { "pend_list", OSCmd_BenchPendList, DEF_YES },
+};
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           LOCAL VARIABLES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+static OS_TCB      OSCmd_BenchTaskTCBTbl[OS_CMD_BENCH_TASK_NBR_MAX];
+static CPU_STK     OSCmd_BenchTaskStkTbl[OS_CMD_BENCH_TASK_NBR_MAX][OS_CMD_BENCH_TASK_STK_SIZE];
+static OS_SEM      OSCmd_BenchSemObj;
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+static OS_MUTEX    OSCmd_BenchMutexObj;
+#endif
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+static OS_Q        OSCmd_BenchQObj;
+#endif
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+static OS_FLAG_GRP OSCmd_BenchFlagObj;
+#endif
+static OS_SEM      OSCmd_BenchPendListObj;                      // Never created: only its pend list is used.
+static OS_TCB      OSCmd_BenchPendListTCBTbl[(OS_CMD_BENCH_TASK_NBR_MAX * OS_CMD_BENCH_PEND_LIST_WAITER_NBR) + 1u];
+#endif
+
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           GLOBAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                               OSCmdInit()
+ *
+ * @brief    Adds the Kernel commands to the Shell.
+ *
+ * @param    p_err   Pointer to the variable that will receive the return error code from this function.
+ *
+ * @note     (1) This function must be called after Shell_Init(), typically from the startup task. The
+ *               commands are selected with OS_CFG_BENCH_EN and OS_CFG_TASK_PROFILE_HIST_EN; if none is
+ *               enabled, no command is added.
+ *******************************************************************************************************/
+void OSCmdInit(RTOS_ERR *p_err)
+{
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+#if (OS_CMD_EN == DEF_ENABLED)
+  Shell_CmdTblAdd((CPU_CHAR *)"os",
+                  OSCmdTbl,
+                  p_err);
+#else
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+#endif
+}
+
+#if (OS_CMD_EN == DEF_ENABLED)
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           LOCAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if (OS_CFG_BENCH_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                               OSCmd_Bench()
+ *
+ * @brief    Runs the Kernel micro-benchmarks and outputs the results.
+ *
+ * @param    argc            Count of the arguments supplied.
+ *
+ * @param    p_argv          Array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        Callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     Pointer to additional information to pass to the command.
+ *
+ * @return   SHELL_EXEC_ERR_NONE, if NO error(s).
+ *               - SHELL_EXEC_ERR otherwise.
+ *
+ * @note     (1) Each result line gives the average number of timestamp counts per operation and the
+ *               number of operations per second, computed from the timestamp timer frequency. When
+ *               the frequency is unknown, the operations per second are reported as 0.
+ *
+ * @note     (2) Contending tasks are created at priorities higher than the priority of the task running
+ *               the shell. That priority must thus be greater than the number of contending tasks.
+ *******************************************************************************************************/
+static CPU_INT16S OSCmd_Bench(CPU_INT16U      argc,
+                              CPU_CHAR        *p_argv[],
+                              SHELL_OUT_FNCT  out_fnct,
+                              SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_CHAR        line[96];
+  CPU_INT16U      len;
+  CPU_INT32U      iter;
+  CPU_INT32U      task_nbr_max;
+  CPU_INT32U      task_nbr;
+  CPU_INT32U      task_nbr_first;
+  CPU_INT32U      task_nbr_last;
+  CPU_INT32U      ix;
+  CPU_INT16U      i;
+  CPU_TS          ts_delta;
+  CPU_TS_TMR_FREQ ts_freq;
+  CPU_INT32U      ops_per_sec;
+  RTOS_ERR        err;
+
+  (void)p_cmd_param;
+
+  iter = OS_CMD_BENCH_ITER_DFLT;
+  task_nbr_max = 1u;
+  for (i = 1u; i < argc; i++) {
+    if ((Str_Cmp(p_argv[i], OS_CMD_HELP) == 0)
+        || (Str_Cmp(p_argv[i], OS_CMD_HELP_SHORT) == 0)) {
+      (void)out_fnct((CPU_CHAR *)OS_CMD_BENCH_HELP_INFO, (CPU_INT16U)Str_Len(OS_CMD_BENCH_HELP_INFO), DEF_NULL);
+      return (SHELL_EXEC_ERR_NONE);
+    } else if ((Str_Cmp(p_argv[i], OS_CMD_BENCH_ITER) == 0)
+               && (i + 1u < argc)) {
+      i++;
+      iter = Str_ParseNbr_Int32U(p_argv[i], DEF_NULL, 10u);
+    } else if ((Str_Cmp(p_argv[i], OS_CMD_BENCH_TASKS) == 0)
+               && (i + 1u < argc)) {
+      i++;
+      task_nbr_max = Str_ParseNbr_Int32U(p_argv[i], DEF_NULL, 10u);
+    } else {
+      (void)out_fnct((CPU_CHAR *)OS_CMD_OUTPUT_ERR_ARG_INVALID, (CPU_INT16U)Str_Len(OS_CMD_OUTPUT_ERR_ARG_INVALID), DEF_NULL);
+      return (SHELL_EXEC_ERR);
+    }
+  }
+
+  if ((iter == 0u)
+      || (task_nbr_max == 0u)
+      || (task_nbr_max > OS_CMD_BENCH_TASK_NBR_MAX)
+      || (task_nbr_max >= OSTCBCurPtr->Prio)) {                 // See Note #2.
+    (void)out_fnct((CPU_CHAR *)OS_CMD_OUTPUT_ERR_ARG_INVALID, (CPU_INT16U)Str_Len(OS_CMD_OUTPUT_ERR_ARG_INVALID), DEF_NULL);
+    return (SHELL_EXEC_ERR);
+  }
+
+  ts_freq = CPU_TS_TmrFreqGet(&err);
+  if (RTOS_ERR_CODE_GET(err) != RTOS_ERR_NONE) {
+    ts_freq = 0u;
+  }
+
+  len = Str_Sprintf(line, "bench,tasks,iter,cycles_per_op,ops_per_sec\r\n");
+  (void)out_fnct(line, len, DEF_NULL);
+
+  for (ix = 0u; ix < (sizeof(OSCmd_BenchTbl) / sizeof(OSCmd_BenchTbl[0])); ix++) {
+    if (OSCmd_BenchTbl[ix].IsContended == DEF_YES) {
+      task_nbr_first = 1u;
+      task_nbr_last = task_nbr_max;
+    } else {
+      task_nbr_first = 0u;
+      task_nbr_last = 0u;
+    }
+
+    for (task_nbr = task_nbr_first; task_nbr <= task_nbr_last; task_nbr++) {
+      ts_delta = OSCmd_BenchTbl[ix].Fnct(iter, task_nbr, &err);
+      if (RTOS_ERR_CODE_GET(err) != RTOS_ERR_NONE) {
+        len = Str_Sprintf(line, "%s,%u,%u,err,err\r\n", OSCmd_BenchTbl[ix].NamePtr, task_nbr, iter);
+        (void)out_fnct(line, len, DEF_NULL);
+        continue;
+      }
+
+      ops_per_sec = 0u;
+      if ((ts_freq != 0u)
+          && (ts_delta != 0u)) {
+        ops_per_sec = (CPU_INT32U)(((CPU_INT64U)iter * ts_freq) / ts_delta);
+      }
+      len = Str_Sprintf(line,
+                        "%s,%u,%u,%u,%u\r\n",
+                        OSCmd_BenchTbl[ix].NamePtr,
+                        task_nbr,
+                        iter,
+                        ts_delta / iter,
+                        ops_per_sec);
+      (void)out_fnct(line, len, DEF_NULL);
+    }
+  }
+
+  return (SHELL_EXEC_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                               OSCmd_BenchSem()
+ *
+ * @brief    Measures an uncontended semaphore post followed by a pend.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchSem(CPU_INT32U iter,
+                             CPU_INT32U task_nbr,
+                             RTOS_ERR   *p_err)
+{
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  (void)task_nbr;
+
+  OSSemCreate(&OSCmd_BenchSemObj, (CPU_CHAR *)"Bench Sem", 0u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    (void)OSSemPost(&OSCmd_BenchSemObj, OS_OPT_POST_1, p_err);
+    (void)OSSemPend(&OSCmd_BenchSemObj, 0u, OS_OPT_PEND_NON_BLOCKING, DEF_NULL, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  (void)OSSemDel(&OSCmd_BenchSemObj, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchSemHandoff()
+ *
+ * @brief    Measures a semaphore post that readies the highest priority of 'task_nbr' waiting tasks.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Number of tasks waiting on the semaphore.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) Each operation includes the post, the switch to the readied task, its pend (inserting it
+ *               back in the pend list of 'task_nbr - 1' tasks) and the switch back to the posting task.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchSemHandoff(CPU_INT32U iter,
+                                    CPU_INT32U task_nbr,
+                                    RTOS_ERR   *p_err)
+{
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  OSSemCreate(&OSCmd_BenchSemObj, (CPU_CHAR *)"Bench Sem", 0u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  OSCmd_BenchTasksCreate(task_nbr, OSCmd_BenchSemWaiterTask, (void *)&OSCmd_BenchSemObj, p_err);
+
+  ts_delta = 0u;
+  if (RTOS_ERR_CODE_GET(*p_err) == RTOS_ERR_NONE) {
+    ts_start = OS_TS_GET();
+    for (i = 0u; i < iter; i++) {
+      (void)OSSemPost(&OSCmd_BenchSemObj, OS_OPT_POST_1, p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+    }
+    ts_delta = OS_TS_GET() - ts_start;
+  }
+                                                                // Waiters delete themselves when the sem is deleted
+  (void)OSSemDel(&OSCmd_BenchSemObj, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchSemWaiterTask()
+ *
+ * @brief    Task pending on the benchmark semaphore until it is deleted.
+ *
+ * @param    p_arg   Pointer to the semaphore.
+ *******************************************************************************************************/
+static void OSCmd_BenchSemWaiterTask(void *p_arg)
+{
+  OS_SEM   *p_sem;
+  RTOS_ERR err;
+
+  p_sem = (OS_SEM *)p_arg;
+  do {
+    (void)OSSemPend(p_sem, 0u, OS_OPT_PEND_BLOCKING, DEF_NULL, &err);
+  } while (RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE);
+
+  OSTaskDel(DEF_NULL, &err);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchTasksCreate()
+ *
+ * @brief    Creates the contending tasks of a benchmark.
+ *
+ * @param    task_nbr    Number of tasks to create.
+ *
+ * @param    p_task      Pointer to the task function.
+ *
+ * @param    p_arg       Argument passed to the tasks.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @note     (1) The tasks are created at decreasing priorities, starting one priority above the current
+ *               task (see 'OSCmd_Bench() Note #2'). Each task thus runs as soon as it is created, until it
+ *               blocks on the benchmark object.
+ *******************************************************************************************************/
+static void OSCmd_BenchTasksCreate(CPU_INT32U  task_nbr,
+                                   OS_TASK_PTR p_task,
+                                   void        *p_arg,
+                                   RTOS_ERR    *p_err)
+{
+  OS_PRIO    prio;
+  CPU_INT32U i;
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+  prio = OSTCBCurPtr->Prio;
+  for (i = 0u; i < task_nbr; i++) {
+    OSTaskCreate(&OSCmd_BenchTaskTCBTbl[i],
+                 (CPU_CHAR *)"Bench Contender",
+                 p_task,
+                 p_arg,
+                 prio - 1u - (OS_PRIO)i,
+                 &OSCmd_BenchTaskStkTbl[i][0],
+                 OS_CMD_BENCH_TASK_STK_SIZE / 10u,
+                 OS_CMD_BENCH_TASK_STK_SIZE,
+                 0u,
+                 0u,
+                 DEF_NULL,
+                 OS_OPT_TASK_NONE,
+                 p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+}
+
+/****************************************************************************************************//**
+ *                                               OSCmd_BenchCtxSw()
+ *
+ * @brief    Measures a round trip between the current task and a higher priority task.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) Each operation posts to the task semaphore of the other task, which pends on it again.
+ *               It thus includes two context switches, the post and the pend.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchCtxSw(CPU_INT32U iter,
+                               CPU_INT32U task_nbr,
+                               RTOS_ERR   *p_err)
+{
+  OS_TCB     *p_tcb;
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  (void)task_nbr;
+
+  OSCmd_BenchTasksCreate(1u, OSCmd_BenchCtxSwTask, DEF_NULL, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  p_tcb = &OSCmd_BenchTaskTCBTbl[0];
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    (void)OSTaskSemPost(p_tcb, OS_OPT_POST_NONE, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  OSTaskDel(p_tcb, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchCtxSwTask()
+ *
+ * @brief    Task pending on its task semaphore until it is deleted.
+ *
+ * @param    p_arg   Not used.
+ *******************************************************************************************************/
+static void OSCmd_BenchCtxSwTask(void *p_arg)
+{
+  RTOS_ERR err;
+
+  (void)p_arg;
+
+  while (DEF_ON) {
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_BLOCKING, DEF_NULL, &err);
+  }
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchTaskSem()
+ *
+ * @brief    Measures a post to the task semaphore of the current task followed by a pend.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchTaskSem(CPU_INT32U iter,
+                                 CPU_INT32U task_nbr,
+                                 RTOS_ERR   *p_err)
+{
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+
+  (void)task_nbr;
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    (void)OSTaskSemPost(DEF_NULL, OS_OPT_POST_NONE, p_err);
+    (void)OSTaskSemPend(0u, OS_OPT_PEND_NON_BLOCKING, DEF_NULL, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                               OSCmd_BenchMutex()
+ *
+ * @brief    Measures an uncontended mutex pend followed by a post.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *******************************************************************************************************/
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchMutex(CPU_INT32U iter,
+                               CPU_INT32U task_nbr,
+                               RTOS_ERR   *p_err)
+{
+  OS_MUTEX   mutex;
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  (void)task_nbr;
+
+  OSMutexCreate(&mutex, (CPU_CHAR *)"Bench Mutex", p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    OSMutexPend(&mutex, 0u, OS_OPT_PEND_BLOCKING, DEF_NULL, p_err);
+    OSMutexPost(&mutex, OS_OPT_POST_NONE, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  (void)OSMutexDel(&mutex, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchMutexContended()
+ *
+ * @brief    Measures a mutex pend followed by a post while 'task_nbr' higher priority tasks contend
+ *           for the mutex.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Number of tasks contending for the mutex.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) Each operation takes the mutex, then releases the contending tasks which all block on it
+ *               (raising the priority of the benchmark task). The post hands the mutex over from task
+ *               to task until the last one releases it and every task waits for the next operation.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchMutexContended(CPU_INT32U iter,
+                                        CPU_INT32U task_nbr,
+                                        RTOS_ERR   *p_err)
+{
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  OSMutexCreate(&OSCmd_BenchMutexObj, (CPU_CHAR *)"Bench Mutex", p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  OSSemCreate(&OSCmd_BenchSemObj, (CPU_CHAR *)"Bench Sem", 0u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    (void)OSMutexDel(&OSCmd_BenchMutexObj, OS_OPT_DEL_ALWAYS, &err);
+    return (0u);
+  }
+                                                                // Contenders run and wait on the sem when created
+  OSCmd_BenchTasksCreate(task_nbr, OSCmd_BenchMutexWaiterTask, DEF_NULL, p_err);
+
+  ts_delta = 0u;
+  if (RTOS_ERR_CODE_GET(*p_err) == RTOS_ERR_NONE) {
+    ts_start = OS_TS_GET();
+    for (i = 0u; i < iter; i++) {
+      OSMutexPend(&OSCmd_BenchMutexObj, 0u, OS_OPT_PEND_BLOCKING, DEF_NULL, p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+      (void)OSSemPost(&OSCmd_BenchSemObj, OS_OPT_POST_ALL, p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        OSMutexPost(&OSCmd_BenchMutexObj, OS_OPT_POST_NONE, &err);
+        break;
+      }
+      OSMutexPost(&OSCmd_BenchMutexObj, OS_OPT_POST_NONE, p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+    }
+    ts_delta = OS_TS_GET() - ts_start;
+  }
+                                                                // Contenders delete themselves when the sem is deleted
+  (void)OSSemDel(&OSCmd_BenchSemObj, OS_OPT_DEL_ALWAYS, &err);
+  (void)OSMutexDel(&OSCmd_BenchMutexObj, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchMutexWaiterTask()
+ *
+ * @brief    Task taking and releasing the benchmark mutex each time the benchmark semaphore is posted,
+ *           until the semaphore is deleted.
+ *
+ * @param    p_arg   Not used.
+ *******************************************************************************************************/
+static void OSCmd_BenchMutexWaiterTask(void *p_arg)
+{
+  RTOS_ERR err;
+
+  (void)p_arg;
+
+  do {
+    (void)OSSemPend(&OSCmd_BenchSemObj, 0u, OS_OPT_PEND_BLOCKING, DEF_NULL, &err);
+    if (RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE) {
+      OSMutexPend(&OSCmd_BenchMutexObj, 0u, OS_OPT_PEND_BLOCKING, DEF_NULL, &err);
+      OSMutexPost(&OSCmd_BenchMutexObj, OS_OPT_POST_NONE, &err);
+    }
+  } while (RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE);
+
+  OSTaskDel(DEF_NULL, &err);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                               OSCmd_BenchQ()
+ *
+ * @brief    Measures an uncontended message queue post followed by a pend.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *******************************************************************************************************/
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchQ(CPU_INT32U iter,
+                           CPU_INT32U task_nbr,
+                           RTOS_ERR   *p_err)
+{
+  OS_Q        q;
+  OS_MSG_SIZE msg_size;
+  CPU_TS      ts_start;
+  CPU_TS      ts_delta;
+  CPU_INT32U  i;
+  RTOS_ERR    err;
+
+  (void)task_nbr;
+
+  OSQCreate(&q, (CPU_CHAR *)"Bench Q", 1u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    OSQPost(&q, (void *)&q, sizeof(q), OS_OPT_POST_FIFO, p_err);
+    (void)OSQPend(&q, 0u, OS_OPT_PEND_NON_BLOCKING, &msg_size, DEF_NULL, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  (void)OSQDel(&q, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchQHandoff()
+ *
+ * @brief    Measures a message queue post that readies the highest priority of 'task_nbr' waiting
+ *           tasks.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Number of tasks waiting on the message queue.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) Each operation includes the post, the switch to the readied task, its pend and the switch
+ *               back to the posting task.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchQHandoff(CPU_INT32U iter,
+                                  CPU_INT32U task_nbr,
+                                  RTOS_ERR   *p_err)
+{
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  OSQCreate(&OSCmd_BenchQObj, (CPU_CHAR *)"Bench Q", 1u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  OSCmd_BenchTasksCreate(task_nbr, OSCmd_BenchQWaiterTask, DEF_NULL, p_err);
+
+  ts_delta = 0u;
+  if (RTOS_ERR_CODE_GET(*p_err) == RTOS_ERR_NONE) {
+    ts_start = OS_TS_GET();
+    for (i = 0u; i < iter; i++) {
+      OSQPost(&OSCmd_BenchQObj, (void *)&OSCmd_BenchQObj, sizeof(OS_Q), OS_OPT_POST_FIFO, p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+    }
+    ts_delta = OS_TS_GET() - ts_start;
+  }
+                                                                // Waiters delete themselves when the Q is deleted
+  (void)OSQDel(&OSCmd_BenchQObj, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchQWaiterTask()
+ *
+ * @brief    Task pending on the benchmark message queue until it is deleted.
+ *
+ * @param    p_arg   Not used.
+ *******************************************************************************************************/
+static void OSCmd_BenchQWaiterTask(void *p_arg)
+{
+  OS_MSG_SIZE msg_size;
+  RTOS_ERR    err;
+
+  (void)p_arg;
+
+  do {
+    (void)OSQPend(&OSCmd_BenchQObj, 0u, OS_OPT_PEND_BLOCKING, &msg_size, DEF_NULL, &err);
+  } while (RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE);
+
+  OSTaskDel(DEF_NULL, &err);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchTaskQHandoff()
+ *
+ * @brief    Measures a post to the message queue of a waiting, higher priority task.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) Posting a NULL message makes the waiting task delete itself.
+ *******************************************************************************************************/
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchTaskQHandoff(CPU_INT32U iter,
+                                      CPU_INT32U task_nbr,
+                                      RTOS_ERR   *p_err)
+{
+  OS_TCB     *p_tcb;
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  (void)task_nbr;
+
+  p_tcb = &OSCmd_BenchTaskTCBTbl[0];
+  OSTaskCreate(p_tcb,
+               (CPU_CHAR *)"Bench Waiter",
+               OSCmd_BenchTaskQWaiterTask,
+               DEF_NULL,
+               OSTCBCurPtr->Prio - 1u,
+               &OSCmd_BenchTaskStkTbl[0][0],
+               OS_CMD_BENCH_TASK_STK_SIZE / 10u,
+               OS_CMD_BENCH_TASK_STK_SIZE,
+               1u,
+               0u,
+               DEF_NULL,
+               OS_OPT_TASK_NONE,
+               p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    OSTaskQPost(p_tcb, (void *)p_tcb, sizeof(OS_TCB), OS_OPT_POST_FIFO, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  OSTaskQPost(p_tcb, DEF_NULL, 0u, OS_OPT_POST_FIFO, &err);     // See Note #1.
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchTaskQWaiterTask()
+ *
+ * @brief    Task pending on its message queue until it receives a NULL message.
+ *
+ * @param    p_arg   Not used.
+ *******************************************************************************************************/
+static void OSCmd_BenchTaskQWaiterTask(void *p_arg)
+{
+  void        *p_msg;
+  OS_MSG_SIZE msg_size;
+  RTOS_ERR    err;
+
+  (void)p_arg;
+
+  do {
+    p_msg = OSTaskQPend(0u, OS_OPT_PEND_BLOCKING, &msg_size, DEF_NULL, &err);
+  } while ((RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE)
+           && (p_msg != DEF_NULL));
+
+  OSTaskDel(DEF_NULL, &err);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                               OSCmd_BenchFlag()
+ *
+ * @brief    Measures an uncontended event flag post followed by a consuming pend.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *******************************************************************************************************/
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchFlag(CPU_INT32U iter,
+                              CPU_INT32U task_nbr,
+                              RTOS_ERR   *p_err)
+{
+  OS_FLAG_GRP grp;
+  CPU_TS      ts_start;
+  CPU_TS      ts_delta;
+  CPU_INT32U  i;
+  RTOS_ERR    err;
+
+  (void)task_nbr;
+
+  OSFlagCreate(&grp, (CPU_CHAR *)"Bench Flags", 0u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    (void)OSFlagPost(&grp, 0x01u, OS_OPT_POST_FLAG_SET, p_err);
+    (void)OSFlagPend(&grp,
+                     0x01u,
+                     0u,
+                     (OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_NON_BLOCKING),
+                     DEF_NULL,
+                     p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  (void)OSFlagDel(&grp, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchFlagHandoff()
+ *
+ * @brief    Measures an event flag post that readies 'task_nbr' waiting tasks.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Number of tasks waiting on the event flag group.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) A post readies every task waiting for the flag. Each operation thus includes the post and,
+ *               for each waiting task, a switch to it and its consuming pend.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchFlagHandoff(CPU_INT32U iter,
+                                     CPU_INT32U task_nbr,
+                                     RTOS_ERR   *p_err)
+{
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  OSFlagCreate(&OSCmd_BenchFlagObj, (CPU_CHAR *)"Bench Flags", 0u, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  OSCmd_BenchTasksCreate(task_nbr, OSCmd_BenchFlagWaiterTask, DEF_NULL, p_err);
+
+  ts_delta = 0u;
+  if (RTOS_ERR_CODE_GET(*p_err) == RTOS_ERR_NONE) {
+    ts_start = OS_TS_GET();
+    for (i = 0u; i < iter; i++) {
+      (void)OSFlagPost(&OSCmd_BenchFlagObj, 0x01u, OS_OPT_POST_FLAG_SET, p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+    }
+    ts_delta = OS_TS_GET() - ts_start;
+  }
+                                                                // Waiters delete themselves when the grp is deleted
+  (void)OSFlagDel(&OSCmd_BenchFlagObj, OS_OPT_DEL_ALWAYS, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchFlagWaiterTask()
+ *
+ * @brief    Task pending on the benchmark event flag group until it is deleted.
+ *
+ * @param    p_arg   Not used.
+ *******************************************************************************************************/
+static void OSCmd_BenchFlagWaiterTask(void *p_arg)
+{
+  RTOS_ERR err;
+
+  (void)p_arg;
+
+  do {
+    (void)OSFlagPend(&OSCmd_BenchFlagObj,
+                     0x01u,
+                     0u,
+                     (OS_OPT_PEND_FLAG_SET_ANY | OS_OPT_PEND_FLAG_CONSUME | OS_OPT_PEND_BLOCKING),
+                     DEF_NULL,
+                     &err);
+  } while (RTOS_ERR_CODE_GET(err) == RTOS_ERR_NONE);
+
+  OSTaskDel(DEF_NULL, &err);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                               OSCmd_BenchTmr()
+ *
+ * @brief    Measures a timer start followed by a stop.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Not used.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *******************************************************************************************************/
+#if (OS_CFG_TMR_EN == DEF_ENABLED)
+static CPU_TS OSCmd_BenchTmr(CPU_INT32U iter,
+                             CPU_INT32U task_nbr,
+                             RTOS_ERR   *p_err)
+{
+  OS_TMR     tmr;
+  CPU_TS     ts_start;
+  CPU_TS     ts_delta;
+  CPU_INT32U i;
+  RTOS_ERR   err;
+
+  (void)task_nbr;
+
+  OSTmrCreate(&tmr,
+              (CPU_CHAR *)"Bench Tmr",
+              OS_CMD_BENCH_TMR_DLY,
+              0u,
+              OS_OPT_TMR_ONE_SHOT,
+              OSCmd_BenchTmrCallback,
+              DEF_NULL,
+              p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (0u);
+  }
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    (void)OSTmrStart(&tmr, p_err);
+    (void)OSTmrStop(&tmr, OS_OPT_TMR_NONE, DEF_NULL, p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      break;
+    }
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  (void)OSTmrDel(&tmr, &err);
+
+  return (ts_delta);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchTmrCallback()
+ *
+ * @brief    Callback of the benchmark timer. The timer is always stopped before it expires.
+ *
+ * @param    p_tmr   Pointer to the timer.
+ *
+ * @param    p_arg   Not used.
+ *******************************************************************************************************/
+static void OSCmd_BenchTmrCallback(void *p_tmr,
+                                   void *p_arg)
+{
+  (void)p_tmr;
+  (void)p_arg;
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           OSCmd_BenchPendList()
+ *
+ * @brief    Measures the insertion of a task in a pend list, followed by its removal, with waiting
+ *           tasks already in the list.
+ *
+ * @param    iter        Number of operations to perform.
+ *
+ * @param    task_nbr    Number of contending tasks. The pend list holds OS_CMD_BENCH_PEND_LIST_WAITER_NBR
+ *                       waiting tasks per contending task.
+ *
+ * @param    p_err       Pointer to the variable that will receive the return error code from this function.
+ *
+ * @return   Number of timestamp counts taken by the operations.
+ *
+ * @note     (1) The waiting tasks are TCBs that are never created: the pend list of an object that is
+ *               never created either is operated on directly, so that only the list insertion is
+ *               measured. A semaphore post would wake the task at the head of the list instead.
+ *
+ * @note     (2) The inserted task has a lower priority than all the waiting tasks and thus goes at the
+ *               tail of the list, which is the worst case of the list walk. Comparing the results with
+ *               OS_CFG_PEND_LIST_PRIO_TBL_EN enabled and disabled, for example on the POSIX port with
+ *               'os_bench -t 8', shows a cost that is flat with the number of waiting tasks when
+ *               enabled and that grows linearly with it when disabled.
+ *******************************************************************************************************/
+static CPU_TS OSCmd_BenchPendList(CPU_INT32U iter,
+                                  CPU_INT32U task_nbr,
+                                  RTOS_ERR   *p_err)
+{
+  OS_PEND_LIST *p_pend_list;
+  OS_TCB       *p_tcb;
+  CPU_INT32U   waiter_nbr;
+  CPU_TS       ts_start;
+  CPU_TS       ts_delta;
+  CPU_INT32U   i;
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+  p_pend_list = &OSCmd_BenchPendListObj.PendList;
+  OS_PendListInit(p_pend_list);
+
+  waiter_nbr = task_nbr * OS_CMD_BENCH_PEND_LIST_WAITER_NBR;
+  for (i = 0u; i < waiter_nbr; i++) {                           // Spread the waiting tasks over the priorities.
+    p_tcb = &OSCmd_BenchPendListTCBTbl[i];
+    p_tcb->Prio = (OS_PRIO)(i % (OS_CFG_PRIO_MAX - 2u));
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)&OSCmd_BenchPendListObj;
+    OS_PendListInsertPrio(p_pend_list, p_tcb);
+  }
+
+  p_tcb = &OSCmd_BenchPendListTCBTbl[waiter_nbr];               // See Note #2.
+  p_tcb->Prio = (OS_PRIO)(OS_CFG_PRIO_MAX - 2u);
+
+  ts_start = OS_TS_GET();
+  for (i = 0u; i < iter; i++) {
+    p_tcb->PendObjPtr = (OS_PEND_OBJ *)&OSCmd_BenchPendListObj;
+    OS_PendListInsertPrio(p_pend_list, p_tcb);
+    OS_PendListRemove(p_tcb);
+  }
+  ts_delta = OS_TS_GET() - ts_start;
+
+  for (i = 0u; i < waiter_nbr; i++) {
+    OS_PendListRemove(&OSCmd_BenchPendListTCBTbl[i]);
+  }
+
+  return (ts_delta);
+}
+#endif
+
+#if (OS_CMD_PROF_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                               OSCmd_Prof()
+ *
+ * @brief    Outputs the profiling histograms of all the tasks.
+ *
+ * @param    argc            Count of the arguments supplied.
+ *
+ * @param    p_argv          Array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        Callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     Pointer to additional information to pass to the command.
+ *
+ * @return   SHELL_EXEC_ERR_NONE, if NO error(s).
+ *           SHELL_EXEC_ERR,      otherwise.
+ *
+ * @note     (1) The histograms of each task are copied with interrupts disabled, then output. The
+ *               header gives the exclusive upper bound of each bin, in timestamp counts (see 'TASK
+ *               PROFILING HISTOGRAM Note #1').
+ *******************************************************************************************************/
+static CPU_INT16S OSCmd_Prof(CPU_INT16U      argc,
+                             CPU_CHAR        *p_argv[],
+                             SHELL_OUT_FNCT  out_fnct,
+                             SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_CHAR     line[32u + (OS_CFG_TASK_PROFILE_HIST_SIZE * 12u)];
+  CPU_INT16U   len;
+  CPU_BOOLEAN  reset;
+  OS_TCB       *p_tcb;
+  CPU_CHAR     *p_task_name;
+  OS_PROF_HIST run_hist;
+  OS_PROF_HIST rdy_hist;
+  OS_PROF_HIST pend_hist_tbl[OS_TASK_PEND_ON_NBR];
+  CPU_INT16U   i;
+  CORE_DECLARE_IRQ_STATE;
+
+  (void)p_cmd_param;
+
+  reset = DEF_NO;
+  for (i = 1u; i < argc; i++) {
+    if ((Str_Cmp(p_argv[i], OS_CMD_HELP) == 0)
+        || (Str_Cmp(p_argv[i], OS_CMD_HELP_SHORT) == 0)) {
+      (void)out_fnct((CPU_CHAR *)OS_CMD_PROF_HELP_INFO, (CPU_INT16U)Str_Len(OS_CMD_PROF_HELP_INFO), DEF_NULL);
+      return (SHELL_EXEC_ERR_NONE);
+    } else if (Str_Cmp(p_argv[i], OS_CMD_PROF_RESET) == 0) {
+      reset = DEF_YES;
+    } else {
+      (void)out_fnct((CPU_CHAR *)OS_CMD_OUTPUT_ERR_ARG_INVALID, (CPU_INT16U)Str_Len(OS_CMD_OUTPUT_ERR_ARG_INVALID), DEF_NULL);
+      return (SHELL_EXEC_ERR);
+    }
+  }
+
+  len = Str_Sprintf(line, "task,hist,max");                     // See Note #1.
+  for (i = 0u; i < (OS_CFG_TASK_PROFILE_HIST_SIZE - 1u); i++) {
+    len += Str_Sprintf(&line[len], ",<%u", (CPU_INT32U)1u << (OS_CFG_TASK_PROFILE_HIST_SHIFT + i));
+  }
+  len += Str_Sprintf(&line[len], ",more\r\n");
+  (void)out_fnct(line, len, DEF_NULL);
+
+  CORE_ENTER_ATOMIC();
+  p_tcb = OSTaskDbgListPtr;
+  CORE_EXIT_ATOMIC();
+  while (p_tcb != DEF_NULL) {
+    CORE_ENTER_ATOMIC();                                        // Take a consistent copy of the histograms.
+    p_task_name = p_tcb->DbgNamePtr;
+    run_hist = p_tcb->ProfRunHist;
+    rdy_hist = p_tcb->ProfRdyHist;
+    for (i = 0u; i < OS_TASK_PEND_ON_NBR; i++) {
+      pend_hist_tbl[i] = p_tcb->ProfPendHistTbl[i];
+    }
+    if (reset == DEF_YES) {
+      OS_TaskProfHistClr(p_tcb);
+    }
+    CORE_EXIT_ATOMIC();
+
+    OSCmd_ProfHistOutput(p_task_name, "run", &run_hist, out_fnct);
+    OSCmd_ProfHistOutput(p_task_name, "rdy", &rdy_hist, out_fnct);
+    for (i = 0u; i < OS_TASK_PEND_ON_NBR; i++) {
+      if (OSCmd_ProfPendOnNameTbl[i] != DEF_NULL) {
+        OSCmd_ProfHistOutput(p_task_name, OSCmd_ProfPendOnNameTbl[i], &pend_hist_tbl[i], out_fnct);
+      }
+    }
+
+    CORE_ENTER_ATOMIC();
+    p_tcb = p_tcb->DbgNextPtr;
+    CORE_EXIT_ATOMIC();
+  }
+
+  return (SHELL_EXEC_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                           OSCmd_ProfHistOutput()
+ *
+ * @brief    Outputs a task profiling histogram as a CSV line, if it is not empty.
+ *
+ * @param    p_task_name     Name of the task.
+ *
+ * @param    p_hist_name     Name of the histogram.
+ *
+ * @param    p_hist          Pointer to the histogram.
+ *
+ * @param    out_fnct        Callback to a respond to the requester.
+ *
+ * @note     (1) The task name is truncated to OS_CMD_PROF_TASK_NAME_LEN_MAX characters so the line fits
+ *               in its buffer; Str_Sprintf() does not support a precision for strings.
+ *******************************************************************************************************/
+static void OSCmd_ProfHistOutput(const CPU_CHAR     *p_task_name,
+                                 const CPU_CHAR     *p_hist_name,
+                                 const OS_PROF_HIST *p_hist,
+                                 SHELL_OUT_FNCT     out_fnct)
+{
+  CPU_CHAR   line[64u + (OS_CFG_TASK_PROFILE_HIST_SIZE * 6u)];
+  CPU_CHAR   task_name[OS_CMD_PROF_TASK_NAME_LEN_MAX + 1u];
+  CPU_INT16U len;
+  CPU_INT16U i;
+
+  for (i = 0u; i < OS_CFG_TASK_PROFILE_HIST_SIZE; i++) {
+    if (p_hist->BinTbl[i] != 0u) {
+      break;
+    }
+  }
+  if (i == OS_CFG_TASK_PROFILE_HIST_SIZE) {                     // Skip empty histograms.
+    return;
+  }
+
+  task_name[0] = '\0';                                          // See Note #1.
+  (void)Str_Copy_N(task_name, p_task_name, OS_CMD_PROF_TASK_NAME_LEN_MAX);
+  task_name[OS_CMD_PROF_TASK_NAME_LEN_MAX] = '\0';
+
+  len = Str_Sprintf(line, "%s,%s,%u", task_name, p_hist_name, (CPU_INT32U)p_hist->Max);
+  for (i = 0u; i < OS_CFG_TASK_PROFILE_HIST_SIZE; i++) {
+    len += Str_Sprintf(&line[len], ",%u", p_hist->BinTbl[i]);
+  }
+  len += Str_Sprintf(&line[len], "\r\n");
+  (void)out_fnct(line, len, DEF_NULL);
+}
+#endif
+
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                   DEPENDENCIES & AVAIL CHECK(S) END
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#endif // (defined(RTOS_MODULE_KERNEL_AVAIL) && defined(RTOS_MODULE_COMMON_SHELL_AVAIL))
@@ -0,0 +1,56 @@
+/***************************************************************************//**
+ * @file
+ * @brief Kernel - Shell Commands
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.  This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               MODULE
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef  _OS_CMD_PRIV_H_
+#define  _OS_CMD_PRIV_H_
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               INCLUDE FILES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#include  <rtos_description.h>
+
+#include  <kernel/include/os.h>
+#include  <common/include/rtos_err.h>
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                                   DEFINES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  OS_CMD_PROF_EN            (((OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED) && (OS_CFG_DBG_EN == DEF_ENABLED)) \
+                                   ? DEF_ENABLED : DEF_DISABLED)
+
+#define  OS_CMD_EN                 (((OS_CFG_BENCH_EN == DEF_ENABLED) || (OS_CMD_PROF_EN == DEF_ENABLED)) \
+                                   ? DEF_ENABLED : DEF_DISABLED)
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               MODULE END
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#endif // End of kernel cmd module include.
@@ -58,6 +58,19 @@ const CPU_CHAR *os_core__c = "$Id: $";
  *                                       DEFAULT RUNTIME CONFIGURATION
  *******************************************************************************************************/
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+#define  OS_INIT_CFG_DFLT_INT_Q_TASK        \
+  .IntQTaskCfg =                            \
+  {                                         \
+    .StkBasePtr = DEF_NULL,                 \
+    .StkSize = 256u,                        \
+    .Prio = KERNEL_INT_Q_TASK_PRIO_DFLT,    \
+    .RateHz = 0u                            \
+  },
+#else
+#define  OS_INIT_CFG_DFLT_INT_Q_TASK
+#endif
+
 // Default Stacks, Pool Size, Stack Limit and Tasks.
 #define  OS_INIT_CFG_DFLT                   { \
     .ISR =                                    \
@@ -81,6 +94,7 @@ const CPU_CHAR *os_core__c = "$Id: $";
       .Prio = KERNEL_TMR_TASK_PRIO_DFLT,      \
       .RateHz = 10u                           \
     },                                        \
+    OS_INIT_CFG_DFLT_INT_Q_TASK               \
     .MemSeg = DEF_NULL,                       \
     .TickRate = 1000u                         \
 }
@@ -107,6 +121,27 @@ static sl_sleeptimer_timer_handle_t OSRoundRobinTimer;
 static OS_TCB                       *OSRoundRobinCurTCB;
 #endif
 
+/*********************************************************************************************************
+ *********************************************************************************************************
+ *                                       LOCAL FUNCTION PROTOTYPES
+ *********************************************************************************************************
+ ********************************************************************************************************/
+
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+static OS_TCB *OS_PendListPrioTailFind(OS_PEND_LIST *p_pend_list,
+                                       OS_PRIO      prio);
+#endif
+
+#if (OS_CFG_TICK_EN == DEF_ENABLED)
+static void OS_TimerExpire(OS_TCB *p_tcb);
+#endif
+
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+static void OS_TickSlackListInsert(OS_TCB *p_tcb);
+
+static void OS_TickSlackListRemove(OS_TCB *p_tcb);
+#endif
+
 /*
 *********************************************************************************************************
 *                                        HOOK WEAK REFERENCES
@@ -266,6 +301,32 @@ void OS_ConfigureTmrTask(OS_TASK_CFG *p_tmr_task_cfg)
 }
 #endif
 
+/*****************************************************************************************************//**
+ *                                           OS_ConfigureIntQTask()
+ *
+ * @brief    If enabled, configure the ISR Handler Task, which performs the posts deferred by ISRs.
+ *
+ * @param    p_int_q_task_cfg    Pointer to the ISR Handler Task configuration.
+ *
+ * @note     (1) This function is optional. If it is called, it must be called before OSInit().
+ *               If it is not called, default values will be used.
+ *
+ * @note     (2) The ISR Handler Task should have a higher priority than any task it posts to. Its
+ *               'RateHz' field is unused.
+ ********************************************************************************************************/
+#if (!defined(OS_CFG_COMPAT_INIT)                           \
+  && (RTOS_CFG_EXTERNALIZE_OPTIONAL_CFG_EN == DEF_DISABLED) \
+  && (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED))
+void OS_ConfigureIntQTask(OS_TASK_CFG *p_int_q_task_cfg)
+{
+  RTOS_ASSERT_CRITICAL((OSInitialized == DEF_FALSE), RTOS_ERR_ALREADY_INIT,; );
+
+  OS_ASSERT_DBG_NO_ERR((p_int_q_task_cfg != DEF_NULL), RTOS_ERR_NULL_PTR,; );
+
+  OS_InitCfg.IntQTaskCfg = *p_int_q_task_cfg;
+}
+#endif
+
 
 /*****************************************************************************************************//**
  *                                          OS_ConfigureTickRate()
@@ -410,6 +471,29 @@ void OSInit(RTOS_ERR *p_err)
   }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)                // ISR Handler Task's Stack.
+  if (OS_InitCfg.IntQTaskCfg.StkSize > 0u) {
+    if (OS_InitCfg.IntQTaskCfg.StkBasePtr == DEF_NULL) {
+      OSCfg_IntQTaskStk = (CPU_STK *)Mem_SegAlloc("Kernel's ISR Handler Task Stack",
+                                                  OS_InitCfg.MemSeg,
+                                                  OS_InitCfg.IntQTaskCfg.StkSize * sizeof(CPU_STK),
+                                                  p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        return;
+      }
+    } else {
+      OSCfg_IntQTaskStk = OS_InitCfg.IntQTaskCfg.StkBasePtr;
+    }
+
+    OSCfg_IntQTaskPrio = OS_InitCfg.IntQTaskCfg.Prio;
+    OSCfg_IntQTaskStkBasePtr = OSCfg_IntQTaskStk;
+    OSCfg_IntQTaskStkLimit = ((OS_InitCfg.IntQTaskCfg.StkSize * OS_InitCfg.TaskStkLimit) / 100u);
+    OSCfg_IntQTaskStkSize = OS_InitCfg.IntQTaskCfg.StkSize;
+    OSCfg_IntQTaskStkSizeRAM = OS_InitCfg.IntQTaskCfg.StkSize * sizeof(CPU_STK);
+    OSCfg_DataSizeRAM += OSCfg_IntQTaskStkSizeRAM;
+  }
+#endif
+
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
   OSCfg_TickRate_Hz = OS_InitCfg.TickRate;
 #endif
@@ -502,6 +586,16 @@ void OSInit(RTOS_ERR *p_err)
   OSTaskRegNextAvailID = 0u;
 #endif
 
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+  OS_TraceRingInit();                                           // Initialize the trace ring before any event occurs
+#endif
+
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  OSTickSlackListPtr = DEF_NULL;                                // No task is delayed yet
+  OSTickSlackWakeupCtr = 0u;
+  OSTickSlackCoalescedCtr = 0u;
+#endif
+
   OS_PrioInit();                                                // Initialize the priority bitmap table
 
   OS_RdyListInit();                                             // Initialize the Ready List
@@ -576,6 +670,13 @@ void OSInit(RTOS_ERR *p_err)
   }
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)                // Initialize the deferred ISR posts
+  OS_IntQInit(p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+#endif
+
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
   OS_Dbg_Init();
 #endif
@@ -712,6 +813,9 @@ void OSSched(void)
 #endif
 
   if (OSPrioHighRdy != (OS_CFG_PRIO_MAX)) {
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+    OS_TaskProfHistSw(OSTCBCurPtr, OSTCBHighRdyPtr);
+#endif
 #if OS_CFG_TASK_PROFILE_EN > 0u
     if (OSTCBCurPtr != OSTCBHighRdyPtr) {
       OSTCBCurPtr->CyclesDelta = OS_TMR_GET_DIFF(OS_TS_GET(), OSTCBCurPtr->CyclesStart);
@@ -723,6 +827,9 @@ void OSSched(void)
 #if OS_CFG_STAT_TASK_EN > 0u
     OS_StatIdleEnterNotify();
 #endif
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+    OS_TaskProfHistSw(OSTCBCurPtr, DEF_NULL);
+#endif
 #if OS_CFG_TASK_PROFILE_EN > 0u
     OSTCBCurPtr->CyclesStart = OS_TS_GET();
 #endif
@@ -963,6 +1070,9 @@ void OSStart(RTOS_ERR *p_err)
 #if (OS_CFG_TMR_EN == DEF_ENABLED)
   kernel_task_cnt++;
 #endif
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  kernel_task_cnt++;
+#endif
 
   //                                                               Make sure at least one application task is created
   OS_ASSERT_DBG_ERR_SET((OSTaskQty > kernel_task_cnt), *p_err, RTOS_ERR_INVALID_CFG,; );
@@ -1067,6 +1177,10 @@ void OS_Pend(OS_PEND_OBJ *p_obj,
 
   OSTCBCurPtr->PendOn = pending_on;                             // Resource not available, wait until it is
   OSTCBCurPtr->PendStatus = OS_STATUS_PEND_OK;
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+  OSTCBCurPtr->ProfPendOn = pending_on;                         // Measure the time blocked on the object type
+  OSTCBCurPtr->ProfPendTS = OS_TS_GET();
+#endif
 
   OS_TaskBlock(OSTCBCurPtr,                                     // Block the task and add it to the tick list if needed
                timeout);
@@ -1131,7 +1245,7 @@ void OS_PendAbort(OS_TCB    *p_tcb,
 
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
-        status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+        status = OS_TaskTimerStop(p_tcb);
         RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
       }
 #endif
@@ -1154,7 +1268,7 @@ void OS_PendAbort(OS_TCB    *p_tcb,
 
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
-        status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+        status = OS_TaskTimerStop(p_tcb);
         RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
       }
 #endif
@@ -1269,12 +1383,19 @@ void OS_PendListChangePrio(OS_TCB *p_tcb)
   p_obj = p_tcb->PendObjPtr;                                    // Get pointer to pend list
   p_pend_list = &p_obj->PendList;
 
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+  OS_PendListRemove(p_tcb);                                     // Always move: tables are indexed by the old priority
+  p_tcb->PendObjPtr = p_obj;
+  OS_PendListInsertPrio(p_pend_list,
+                        p_tcb);
+#else
   if (p_pend_list->HeadPtr->PendNextPtr != DEF_NULL) {          // Only move if multiple entries in the list
     OS_PendListRemove(p_tcb);                                   // Remove entry from current position
     p_tcb->PendObjPtr = p_obj;
     OS_PendListInsertPrio(p_pend_list,                          // INSERT it back in the list
                           p_tcb);
   }
+#endif
 }
 
 /****************************************************************************************************//**
@@ -1288,11 +1409,23 @@ void OS_PendListChangePrio(OS_TCB *p_tcb)
  *******************************************************************************************************/
 void OS_PendListInit(OS_PEND_LIST *p_pend_list)
 {
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+  CPU_DATA i;
+#endif
+
   p_pend_list->HeadPtr = DEF_NULL;
   p_pend_list->TailPtr = DEF_NULL;
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
   p_pend_list->NbrEntries = 0u;
 #endif
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+  for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {                     // No priority is waiting
+    p_pend_list->PrioTbl[i] = 0u;
+  }
+  for (i = 0u; i < OS_CFG_PRIO_MAX; i++) {
+    p_pend_list->PrioTailTbl[i] = DEF_NULL;
+  }
+#endif
 }
 
 /****************************************************************************************************//**
@@ -1347,7 +1480,48 @@ void OS_PendListInit(OS_PEND_LIST *p_pend_list)
  * @param    p_tcb           The OS_TCB to insert in the list.
  *
  * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) When OS_CFG_PEND_LIST_PRIO_TBL_EN is enabled, the list is not walked. The entry is
+ *               inserted after the last task of the same or of the nearest higher priority, found
+ *               using the priority bitmap and the tail table of the pend list. Tasks of the same
+ *               priority remain in FIFO order.
  *******************************************************************************************************/
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+void OS_PendListInsertPrio(OS_PEND_LIST *p_pend_list,
+                           OS_TCB       *p_tcb)
+{
+  OS_PRIO  prio;
+  OS_TCB   *p_tcb_prev;
+  OS_TCB   *p_tcb_next;
+  CPU_DATA bit_nbr;
+
+  prio = p_tcb->Prio;                                           // Obtain the priority of the task to insert
+  p_tcb->PendPrio = prio;
+
+  p_tcb_prev = OS_PendListPrioTailFind(p_pend_list, prio);
+  if (p_tcb_prev == DEF_NULL) {                                 // No task of higher or same priority ...
+    p_tcb_next = p_pend_list->HeadPtr;                          // ... insert as new Head of list
+    p_pend_list->HeadPtr = p_tcb;
+  } else {
+    p_tcb_next = p_tcb_prev->PendNextPtr;                       // Insert after the last task of higher or same prio
+    p_tcb_prev->PendNextPtr = p_tcb;
+  }
+  p_tcb->PendPrevPtr = p_tcb_prev;
+  p_tcb->PendNextPtr = p_tcb_next;
+  if (p_tcb_next == DEF_NULL) {
+    p_pend_list->TailPtr = p_tcb;
+  } else {
+    p_tcb_next->PendPrevPtr = p_tcb;
+  }
+
+  p_pend_list->PrioTailTbl[prio] = p_tcb;                       // Task is the new tail of its priority
+  bit_nbr = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
+  p_pend_list->PrioTbl[prio / DEF_INT_CPU_NBR_BITS] |= 1u << ((DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr);
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  p_pend_list->NbrEntries++;
+#endif
+}
+#else
 void OS_PendListInsertPrio(OS_PEND_LIST *p_pend_list,
                            OS_TCB       *p_tcb)
 {
@@ -1396,6 +1570,7 @@ void OS_PendListInsertPrio(OS_PEND_LIST *p_pend_list,
     }
   }
 }
+#endif
 
 /****************************************************************************************************//**
  *                                           OS_PendListRemove()
@@ -1443,10 +1618,30 @@ void OS_PendListRemove(OS_TCB *p_tcb)
   OS_PEND_LIST *p_pend_list;
   OS_TCB       *p_next;
   OS_TCB       *p_prev;
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+  OS_PRIO      prio;
+  CPU_DATA     bit_nbr;
+#endif
 
   if (p_tcb->PendObjPtr != DEF_NULL) {                          // Only remove if object has a pend list.
     p_pend_list = &p_tcb->PendObjPtr->PendList;                 // Get pointer to pend list
 
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+    prio = p_tcb->PendPrio;
+    if (p_pend_list->PrioTailTbl[prio] == p_tcb) {              // Update the tail of the task's priority
+      p_prev = p_tcb->PendPrevPtr;
+      if ((p_prev != DEF_NULL)
+          && (p_prev->PendPrio == prio)) {
+        p_pend_list->PrioTailTbl[prio] = p_prev;
+      } else {
+        p_pend_list->PrioTailTbl[prio] = DEF_NULL;              // Last task of this priority leaves the list
+        bit_nbr = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
+        p_pend_list->PrioTbl[prio / DEF_INT_CPU_NBR_BITS] &= ~(1u << ((DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr));
+      }
+    }
+#endif
+
+
     // Remove TCB from the pend list.
     if (p_pend_list->HeadPtr->PendNextPtr == DEF_NULL) {
       p_pend_list->HeadPtr = DEF_NULL;                          // Only one entry in the pend list
@@ -1539,7 +1734,7 @@ void OS_Post(OS_PEND_OBJ *p_obj,
 #endif
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
-        status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+        status = OS_TaskTimerStop(p_tcb);
         RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
       }
 #endif
@@ -1567,7 +1762,7 @@ void OS_Post(OS_PEND_OBJ *p_obj,
 #endif
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED) {
-        status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+        status = OS_TaskTimerStop(p_tcb);
         RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
       }
 #endif
@@ -1649,6 +1844,14 @@ void OS_RdyListInit(void)
  *******************************************************************************************************/
 void OS_RdyListInsert(OS_TCB *p_tcb)
 {
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+  if ((p_tcb != OSTCBCurPtr)                                    // Measure the latency until the task runs
+      && (p_tcb->ProfRdyValid == DEF_FALSE)) {
+    p_tcb->ProfRdyTS = OS_TS_GET();
+    p_tcb->ProfRdyValid = DEF_TRUE;
+  }
+#endif
+
   OS_PrioInsert(p_tcb->Prio);
   if (p_tcb->Prio == OSPrioCur) {                               // Are we readying a task at the same prio?
     OS_RdyListInsertTail(p_tcb);                                // Yes, insert readied task at the end of the list
@@ -2135,13 +2338,7 @@ void OS_TaskBlock(OS_TCB  *p_tcb,
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
     sl_status_t status;
 
-    uint32_t delay = (uint64_t)(((uint64_t)timeout * (uint64_t)sl_sleeptimer_get_timer_frequency()) + (OSCfg_TickRate_Hz - 1u)) / OSCfg_TickRate_Hz;
-    status = sl_sleeptimer_start_timer(&p_tcb->TimerHandle,
-                                       delay,
-                                       OS_TimerCallback,
-                                       (void *)p_tcb,
-                                       0u,
-                                       0u);
+    status = OS_TaskTimerStart(p_tcb, timeout);
     RTOS_ASSERT_CRITICAL(status == SL_STATUS_OK, RTOS_ERR_FAIL, ;);
 
     p_tcb->TaskState = OS_TASK_STATE_PEND_TIMEOUT;
@@ -2156,6 +2353,85 @@ void OS_TaskBlock(OS_TCB  *p_tcb,
 }
 
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                           OS_TaskTimerStart()
+ *
+ * @brief    Starts the timer of a task that is delayed or pending with a timeout.
+ *
+ * @param    p_tcb       Pointer to the OS_TCB of the task.
+ *
+ * @param    timeout     Number of kernel ticks before the timer expires.
+ *
+ * @return   SL_STATUS_OK, if the timer is started.
+ *           Error code returned by sl_sleeptimer_start_timer(), otherwise.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) This function MUST be called with interrupts disabled.
+ *
+ * @note     (3) The timer of a task that accepts a slack (see OSTaskTickSlackSet()) is started to expire
+ *               at the end of its tolerance window, and the task is added to the slack list. The task is
+ *               woken earlier if another task's timer expires after its delay elapsed (see
+ *               OS_TimerCallback()).
+ *******************************************************************************************************/
+sl_status_t OS_TaskTimerStart(OS_TCB  *p_tcb,
+                              OS_TICK timeout)
+{
+  uint32_t delay;
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  uint32_t    slack;
+  sl_status_t status;
+#endif
+
+  delay = (uint64_t)(((uint64_t)timeout * (uint64_t)sl_sleeptimer_get_timer_frequency()) + (OSCfg_TickRate_Hz - 1u)) / OSCfg_TickRate_Hz;
+
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  if (p_tcb->TickSlack > 0u) {                                  // See Note #3.
+    slack = (uint64_t)((uint64_t)p_tcb->TickSlack * (uint64_t)sl_sleeptimer_get_timer_frequency()) / OSCfg_TickRate_Hz;
+    p_tcb->TickSlackMatch = sl_sleeptimer_get_tick_count() + delay;
+    status = sl_sleeptimer_start_timer(&p_tcb->TimerHandle,
+                                       delay + slack,
+                                       OS_TimerCallback,
+                                       (void *)p_tcb,
+                                       0u,
+                                       0u);
+    if (status == SL_STATUS_OK) {
+      OS_TickSlackListInsert(p_tcb);
+    }
+    return (status);
+  }
+#endif
+
+  return (sl_sleeptimer_start_timer(&p_tcb->TimerHandle,
+                                    delay,
+                                    OS_TimerCallback,
+                                    (void *)p_tcb,
+                                    0u,
+                                    0u));
+}
+
+/****************************************************************************************************//**
+ *                                           OS_TaskTimerStop()
+ *
+ * @brief    Stops the timer of a task that is delayed or pending with a timeout.
+ *
+ * @param    p_tcb   Pointer to the OS_TCB of the task.
+ *
+ * @return   Error code returned by sl_sleeptimer_stop_timer().
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) This function MUST be called with interrupts disabled.
+ *******************************************************************************************************/
+sl_status_t OS_TaskTimerStop(OS_TCB *p_tcb)
+{
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  OS_TickSlackListRemove(p_tcb);
+#endif
+
+  return (sl_sleeptimer_stop_timer(&p_tcb->TimerHandle));
+}
+
 /*****************************************************************************************************//**
  *                                             OS_TimerCallback()
  *
@@ -2166,19 +2442,122 @@ void OS_TaskBlock(OS_TCB  *p_tcb,
  * @param    data   Pointer caller specific data.
  *
  * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) The tasks of the slack list whose delay elapsed are woken with the task of the expired
+ *               timer, and their own timer is stopped. The slack list is not sorted: it is walked
+ *               entirely on each expiration.
  ********************************************************************************************************/
 void OS_TimerCallback (sl_sleeptimer_timer_handle_t *handle,
                        void                         *data)
 {
-  OS_TCB  *p_tcb = (OS_TCB *)data;
-#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
-  OS_TCB  *p_tcb_owner;
-  OS_PRIO  prio_new;
+  OS_TCB   *p_tcb = (OS_TCB *)data;
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  OS_TCB   *p_tcb_slack;
+  OS_TCB   *p_tcb_next;
+  uint32_t tick_ctr;
 #endif
   PP_UNUSED_PARAM(handle);
   CORE_DECLARE_IRQ_STATE;
 
   CORE_ENTER_ATOMIC();
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  OS_TickSlackListRemove(p_tcb);
+  OSTickSlackWakeupCtr++;
+#endif
+
+  OS_TimerExpire(p_tcb);
+
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  tick_ctr = sl_sleeptimer_get_tick_count();                    // Wake the tasks whose delay elapsed (see Note #2)
+  p_tcb_slack = OSTickSlackListPtr;
+  while (p_tcb_slack != DEF_NULL) {
+    p_tcb_next = p_tcb_slack->TickSlackNextPtr;
+    if ((CPU_INT32S)(tick_ctr - p_tcb_slack->TickSlackMatch) >= 0) {
+      (void)OS_TaskTimerStop(p_tcb_slack);
+      OS_TimerExpire(p_tcb_slack);
+      OSTickSlackCoalescedCtr++;
+    }
+    p_tcb_slack = p_tcb_next;
+  }
+#endif
+  CORE_EXIT_ATOMIC();
+
+  OSSched();
+}
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           LOCAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                           OS_PendListPrioTailFind()
+ *
+ * @brief    This function is called to find the task after which a task of the specified priority
+ *           must be inserted in a pend list.
+ *
+ * @param    p_pend_list     Pointer to the OS_PEND_LIST to search.
+ *
+ * @param    prio            Priority of the task to insert.
+ *
+ * @return   Pointer to the last task waiting at 'prio' or, if there is none, at the nearest higher
+ *           priority. DEF_NULL if no task of higher or same priority is waiting.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) Like OSPrioTbl, the most significant bit of each entry of the bitmap corresponds to the
+ *               highest priority. The lowest priority set among 'prio' and the higher priorities is thus
+ *               given by the trailing zeros of the masked entries.
+ *******************************************************************************************************/
+#if (OS_CFG_PEND_LIST_PRIO_TBL_EN == DEF_ENABLED)
+static OS_TCB *OS_PendListPrioTailFind(OS_PEND_LIST *p_pend_list,
+                                       OS_PRIO      prio)
+{
+  CPU_DATA bits;
+  CPU_DATA bit_nbr;
+  OS_PRIO  ix;
+
+  ix = prio / DEF_INT_CPU_NBR_BITS;
+  bit_nbr = (CPU_DATA)prio & (DEF_INT_CPU_NBR_BITS - 1u);
+  //                                                               Keep 'prio' and the higher priorities of the entry.
+  bits = p_pend_list->PrioTbl[ix] & (~(CPU_DATA)0u << ((DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr));
+
+  while (bits == 0u) {                                          // Search the previous entries if none is waiting
+    if (ix == 0u) {
+      return (DEF_NULL);
+    }
+    ix--;
+    bits = p_pend_list->PrioTbl[ix];
+  }
+
+  prio = (ix * DEF_INT_CPU_NBR_BITS) + ((DEF_INT_CPU_NBR_BITS - 1u) - (OS_PRIO)CPU_CntTrailZeros(bits));
+
+  return (p_pend_list->PrioTailTbl[prio]);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                               OS_TimerExpire()
+ *
+ * @brief    This function is called when the delay or the timeout of a task expires, to make the task
+ *           ready.
+ *
+ * @param    p_tcb   Pointer to the OS_TCB of the task.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) This function MUST be called with interrupts disabled.
+ *******************************************************************************************************/
+#if (OS_CFG_TICK_EN == DEF_ENABLED)
+static void OS_TimerExpire(OS_TCB *p_tcb)
+{
+#if (OS_CFG_MUTEX_EN == DEF_ENABLED)
+  OS_TCB  *p_tcb_owner;
+  OS_PRIO prio_new;
+#endif
+
   switch (p_tcb->TaskState) {
     case OS_TASK_STATE_PEND_TIMEOUT:
     case OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED:
@@ -2233,9 +2612,52 @@ void OS_TimerCallback (sl_sleeptimer_timer_handle_t *handle,
     default:
       break;
   }
-  CORE_EXIT_ATOMIC();
+}
+#endif
 
-  OSSched();
+/****************************************************************************************************//**
+ *                                           OS_TickSlackListInsert()
+ *
+ * @brief    This function is called to add a delayed task to the slack list.
+ *
+ * @param    p_tcb   Pointer to the OS_TCB of the task.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *******************************************************************************************************/
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+static void OS_TickSlackListInsert(OS_TCB *p_tcb)
+{
+  p_tcb->TickSlackPrevPtr = DEF_NULL;
+  p_tcb->TickSlackNextPtr = OSTickSlackListPtr;
+  if (OSTickSlackListPtr != DEF_NULL) {
+    OSTickSlackListPtr->TickSlackPrevPtr = p_tcb;
+  }
+  OSTickSlackListPtr = p_tcb;
+}
+
+/****************************************************************************************************//**
+ *                                           OS_TickSlackListRemove()
+ *
+ * @brief    This function is called to remove a task from the slack list, if it is in the list.
+ *
+ * @param    p_tcb   Pointer to the OS_TCB of the task.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *******************************************************************************************************/
+static void OS_TickSlackListRemove(OS_TCB *p_tcb)
+{
+  if (p_tcb->TickSlackPrevPtr != DEF_NULL) {
+    p_tcb->TickSlackPrevPtr->TickSlackNextPtr = p_tcb->TickSlackNextPtr;
+  } else if (OSTickSlackListPtr == p_tcb) {
+    OSTickSlackListPtr = p_tcb->TickSlackNextPtr;
+  } else {
+    return;                                                     // Task is not in the list
+  }
+  if (p_tcb->TickSlackNextPtr != DEF_NULL) {
+    p_tcb->TickSlackNextPtr->TickSlackPrevPtr = p_tcb->TickSlackPrevPtr;
+  }
+  p_tcb->TickSlackNextPtr = DEF_NULL;
+  p_tcb->TickSlackPrevPtr = DEF_NULL;
 }
 #endif
 
@@ -147,6 +147,14 @@ CPU_INT08U OS_VOLATILE OSDbg_TaskChangePrioEn = 1u;             // DEPRECATED, a
 CPU_INT08U OS_VOLATILE OSDbg_TaskDelEn = OS_CFG_TASK_DEL_EN;
 CPU_INT08U OS_VOLATILE OSDbg_TaskQEn = OS_CFG_TASK_Q_EN;
 CPU_INT08U OS_VOLATILE OSDbg_TaskProfileEn = OS_CFG_TASK_PROFILE_EN;
+CPU_INT08U OS_VOLATILE OSDbg_TaskProfileHistEn = OS_CFG_TASK_PROFILE_HIST_EN;
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+CPU_INT16U OS_VOLATILE OSDbg_TaskProfileHistSize = sizeof(OS_PROF_HIST);   // Size in bytes of OS_PROF_HIST
+CPU_INT08U OS_VOLATILE OSDbg_TaskProfileHistShift = OS_CFG_TASK_PROFILE_HIST_SHIFT;
+#else
+CPU_INT16U OS_VOLATILE OSDbg_TaskProfileHistSize = 0u;
+CPU_INT08U OS_VOLATILE OSDbg_TaskProfileHistShift = 0u;
+#endif
 CPU_INT16U OS_VOLATILE OSDbg_TaskRegTblSize = OS_CFG_TASK_REG_TBL_SIZE;
 CPU_INT08U OS_VOLATILE OSDbg_TaskSuspendEn = OS_CFG_TASK_SUSPEND_EN;
 
@@ -233,6 +241,9 @@ CPU_INT32U OS_VOLATILE const OSDbg_DataSize = 0u
                                               + sizeof(OSPrioCur)
                                               + sizeof(OSPrioHighRdy)
                                               + sizeof(OSPrioTbl)
+#if (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)
+                                              + sizeof(OSPrioTblSummary)
+#endif
 
 #if (OS_CFG_Q_EN == DEF_ENABLED)
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
@@ -287,7 +298,11 @@ CPU_INT32U OS_VOLATILE const OSDbg_DataSize = 0u
                                               + sizeof(OSTmrDbgListPtr)
                                               + sizeof(OSTmrListEntries)
 #endif
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+                                              + sizeof(OSTmrWheelTbl)
+#else
                                               + sizeof(OSTmrListPtr)
+#endif
 #if (OS_CFG_MUTEX_EN == DEF_ENABLED)
                                               + sizeof(OSTmrMutex)
 #endif
@@ -307,6 +322,32 @@ CPU_INT32U OS_VOLATILE const OSDbg_DataSize = 0u
                                               + sizeof(OSTaskRegNextAvailID)
 #endif
 
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+                                              + sizeof(OSTraceRingTbl)
+                                              + sizeof(OSTraceRingWrIx)
+                                              + sizeof(OSTraceRingRdIx)
+                                              + sizeof(OSTraceRingLostCtr)
+                                              + sizeof(OSTraceRingEn)
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+                                              + sizeof(OSIntQTbl)
+                                              + sizeof(OSIntQWrIx)
+                                              + sizeof(OSIntQRdIx)
+                                              + sizeof(OSIntQNbrEntriesMax)
+                                              + sizeof(OSIntQOvfCtr)
+                                              + sizeof(OSIntQTaskTCB)
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+                                              + sizeof(OSIntQTaskTimeMax)
+#endif
+#endif
+
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+                                              + sizeof(OSTickSlackListPtr)
+                                              + sizeof(OSTickSlackWakeupCtr)
+                                              + sizeof(OSTickSlackCoalescedCtr)
+#endif
+
                                               + sizeof(OSTCBCurPtr)
                                               + sizeof(OSTCBHighRdyPtr);
 
@@ -404,6 +445,9 @@ void OS_Dbg_Init(void)
   temp08 = (CPU_INT08U)OSDbg_TaskDelEn;
   temp08 = (CPU_INT08U)OSDbg_TaskQEn;
   temp08 = (CPU_INT08U)OSDbg_TaskProfileEn;
+  temp08 = (CPU_INT08U)OSDbg_TaskProfileHistEn;
+  temp16 = (CPU_INT16U)OSDbg_TaskProfileHistSize;
+  temp08 = (CPU_INT08U)OSDbg_TaskProfileHistShift;
   temp16 = (CPU_INT16U)OSDbg_TaskRegTblSize;
   temp08 = (CPU_INT08U)OSDbg_TaskSuspendEn;
 
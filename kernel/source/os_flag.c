@@ -754,6 +754,7 @@ OS_FLAGS OSFlagPendGetFlagsRdy(RTOS_ERR *p_err)
  * @param    p_err   Pointer to the variable that will receive one of the following error code(s)
  *                   from this function:
  *                       - RTOS_ERR_NONE
+ *                       - RTOS_ERR_WOULD_OVF
  *
  * @return   The new value of the event flags bits that are still set.
  *
@@ -764,6 +765,10 @@ OS_FLAGS OSFlagPendGetFlagsRdy(RTOS_ERR *p_err)
  *
  * @note     (3) OS_OPT_POST_NO_SCHED can be OR'ed with one of the other two options to prevent the
  *               scheduler from being called.
+ *
+ * @note     (4) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a post from an ISR is only recorded and is
+ *               performed later by the kernel's ISR handler task. 0 is then returned, and RTOS_ERR_WOULD_OVF
+ *               if the deferred post ring is full.
  *******************************************************************************************************/
 OS_FLAGS OSFlagPost(OS_FLAG_GRP *p_grp,
                     OS_FLAGS    flags,
@@ -798,6 +803,20 @@ OS_FLAGS OSFlagPost(OS_FLAG_GRP *p_grp,
   //                                                               Validate event group object
   OS_ASSERT_DBG_ERR_SET((p_grp->Type == OS_OBJ_TYPE_FLAG), *p_err, RTOS_ERR_INVALID_TYPE, 0u);
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  if (CORE_InIrqContext() == DEF_TRUE) {                        // Defer the post when called from an ISR, see Note #4.
+    OS_IntQPost(OS_OBJ_TYPE_FLAG,
+                (void *)p_grp,
+                DEF_NULL,
+                0u,
+                flags,
+                opt,
+                p_err);
+    OS_TRACE_FLAG_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (0u);
+  }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
   ts = OS_TS_GET();                                             // Get timestamp
 #else
@@ -1069,7 +1088,7 @@ void OS_FlagTaskRdy(OS_TCB   *p_tcb,
     case OS_TASK_STATE_PEND_TIMEOUT:
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       if (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT) {
-        status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+        status = OS_TaskTimerStop(p_tcb);
         RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
       }
 #endif
@@ -0,0 +1,320 @@
+/***************************************************************************//**
+ * @file
+ * @brief Kernel - Deferred ISR Posts
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.  This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                       DEPENDENCIES & AVAIL CHECK(S)
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#include  <rtos_description.h>
+
+#if (defined(RTOS_MODULE_KERNEL_AVAIL))
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               INCLUDE FILES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  MICRIUM_SOURCE
+#include "../include/os.h"
+#include "os_priv.h"
+
+#include  <em_core.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const CPU_CHAR *os_int__c = "$Id: $";
+#endif
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                       LOCAL FUNCTION PROTOTYPES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+static void OS_IntQRePost(OS_INT_Q_REC *p_rec);
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           INTERNAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                               OS_IntQInit()
+ *
+ * @brief    This function is called by OSInit() to initialize the deferred post ring and to create the
+ *           ISR handler task.
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s) from
+ *                   this function:
+ *                       - RTOS_ERR_NONE
+ *                       - RTOS_ERR_INVALID_ARG
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *******************************************************************************************************/
+void OS_IntQInit(RTOS_ERR *p_err)
+{
+  OS_INT_Q_REC *p_rec;
+  CPU_INT32U   ix;
+
+  for (ix = 0u; ix < OS_CFG_ISR_POST_DEFERRED_Q_SIZE; ix++) {
+    p_rec = &OSIntQTbl[ix];
+    p_rec->Type = OS_OBJ_TYPE_NONE;
+    p_rec->ObjPtr = DEF_NULL;
+    p_rec->MsgPtr = DEF_NULL;
+    p_rec->MsgSize = 0u;
+    p_rec->Flags = 0u;
+    p_rec->Opt = 0u;
+    p_rec->TS = 0u;
+  }
+  OSIntQWrIx = 0u;
+  OSIntQRdIx = 0u;
+  OSIntQNbrEntriesMax = 0u;
+  OSIntQOvfCtr = 0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  OSIntQTaskTimeMax = 0u;
+#endif
+
+  //                                                               Validate the handler task's stack
+  OS_ASSERT_DBG_ERR_SET((OSCfg_IntQTaskStkBasePtr != DEF_NULL), *p_err, RTOS_ERR_INVALID_ARG,; );
+  OS_ASSERT_DBG_ERR_SET((OSCfg_IntQTaskStkSize >= OSCfg_StkSizeMin), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+                                                                // ------------ CREATE THE ISR HANDLER TASK -----------
+  OSTaskCreate(&OSIntQTaskTCB,
+               (CPU_CHAR *)((void *)"Kernel's ISR Handler Task"),
+               OS_IntQTask,
+               DEF_NULL,
+               OSCfg_IntQTaskPrio,
+               OSCfg_IntQTaskStkBasePtr,
+               OSCfg_IntQTaskStkLimit,
+               OSCfg_IntQTaskStkSize,
+               0u,
+               0u,
+               DEF_NULL,
+               (OS_OPT_TASK_STK_CHK | OS_OPT_TASK_STK_CLR | OS_OPT_TASK_NO_TLS),
+               p_err);
+}
+
+/****************************************************************************************************//**
+ *                                               OS_IntQPost()
+ *
+ * @brief    This function is called by the post services when they are invoked from an ISR. The post
+ *           is recorded in the deferred post ring and will be performed by the ISR handler task.
+ *
+ * @param    type        Type of the object posted to:
+ *                           - OS_OBJ_TYPE_SEM
+ *                           - OS_OBJ_TYPE_Q
+ *                           - OS_OBJ_TYPE_FLAG
+ *
+ * @param    p_obj       Pointer to the object posted to.
+ *
+ * @param    p_msg       Pointer to the message to post (queues only).
+ *
+ * @param    msg_size    Size of the message to post   (queues only).
+ *
+ * @param    flags       Flags to post                 (event flags only).
+ *
+ * @param    opt         Options of the post, as passed to the post service.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error code(s)
+ *                       from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_WOULD_OVF
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) Interrupts are only disabled while the slot of the record is reserved, by incrementing
+ *               the free running write index. The record is then filled without any lock: a nested ISR
+ *               posting in the meantime uses the next slot. The time spent with interrupts disabled is
+ *               thus constant and independent of the number of tasks waiting on the object.
+ *
+ * @note     (3) The ISR handler task is signaled after every record, so that a record filled after a
+ *               nested ISR's record is never left behind in the ring.
+ *******************************************************************************************************/
+void OS_IntQPost(OS_OBJ_TYPE type,
+                 void        *p_obj,
+                 void        *p_msg,
+                 OS_MSG_SIZE msg_size,
+                 OS_FLAGS    flags,
+                 OS_OPT      opt,
+                 RTOS_ERR    *p_err)
+{
+  OS_INT_Q_REC *p_rec;
+  CPU_INT32U   ix;
+  RTOS_ERR     err;
+  CORE_DECLARE_IRQ_STATE;
+
+  CORE_ENTER_ATOMIC();                                          // Reserve a slot, see Note #2.
+  ix = OSIntQWrIx;
+  if ((ix - OSIntQRdIx) >= OS_CFG_ISR_POST_DEFERRED_Q_SIZE) {   // Ring full?
+    OSIntQOvfCtr++;
+    CORE_EXIT_ATOMIC();
+    RTOS_ERR_SET(*p_err, RTOS_ERR_WOULD_OVF);
+    return;
+  }
+  OSIntQWrIx = ix + 1u;
+  CORE_EXIT_ATOMIC();
+
+  p_rec = &OSIntQTbl[ix & (OS_CFG_ISR_POST_DEFERRED_Q_SIZE - 1u)];
+  p_rec->ObjPtr = p_obj;
+  p_rec->MsgPtr = p_msg;
+  p_rec->MsgSize = msg_size;
+  p_rec->Flags = flags;
+  p_rec->Opt = opt;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  p_rec->TS = OS_TS_GET();
+#else
+  p_rec->TS = 0u;
+#endif
+  p_rec->Type = type;                                           // Record is now complete.
+
+  (void)OSTaskSemPost(&OSIntQTaskTCB,                           // Signal the ISR handler task, see Note #3.
+                      OS_OPT_POST_NONE,
+                      &err);
+  (void)err;
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+
+/****************************************************************************************************//**
+ *                                               OS_IntQTask()
+ *
+ * @brief    This task performs, in order, the posts recorded by ISRs in the deferred post ring. It is
+ *           created by OS_IntQInit().
+ *
+ * @param    p_arg   Argument passed to the task when the task is created (unused).
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) The posts are performed without calling the scheduler. The scheduler is called once, when
+ *               all the recorded posts have been performed, so the highest priority task readied by the
+ *               batch runs next.
+ *
+ * @note     (3) On a single CPU, an ISR cannot be preempted by this task, so every slot reserved is
+ *               filled before the task runs. A record not complete yet is nevertheless left in the
+ *               ring: the ISR filling it signals the task again once done.
+ *******************************************************************************************************/
+void OS_IntQTask(void *p_arg)
+{
+  OS_INT_Q_REC *p_rec;
+  OS_OBJ_QTY   nbr_entries;
+  RTOS_ERR     err;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  CPU_TS ts_delta;
+#endif
+
+  (void)p_arg;                                                  // Not using 'p_arg', prevent compiler warning
+  while (DEF_ON) {
+    (void)OSTaskSemPend(0u,
+                        OS_OPT_PEND_BLOCKING,
+                        DEF_NULL,
+                        &err);
+    (void)err;
+
+    nbr_entries = (OS_OBJ_QTY)(OSIntQWrIx - OSIntQRdIx);
+    if (OSIntQNbrEntriesMax < nbr_entries) {
+      OSIntQNbrEntriesMax = nbr_entries;
+    }
+
+    while (OSIntQRdIx != OSIntQWrIx) {
+      p_rec = &OSIntQTbl[OSIntQRdIx & (OS_CFG_ISR_POST_DEFERRED_Q_SIZE - 1u)];
+      if (p_rec->Type == OS_OBJ_TYPE_NONE) {                    // See Note #3.
+        break;
+      }
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+      ts_delta = OS_TS_GET() - p_rec->TS;                       // Measure the delay from the ISR to the post
+      if (OSIntQTaskTimeMax < ts_delta) {
+        OSIntQTaskTimeMax = ts_delta;
+      }
+#endif
+      OS_IntQRePost(p_rec);
+      p_rec->Type = OS_OBJ_TYPE_NONE;                           // Free the slot for the ISRs.
+      OSIntQRdIx++;
+    }
+
+    OSSched();                                                  // See Note #2.
+  }
+}
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           LOCAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                               OS_IntQRePost()
+ *
+ * @brief    Performs a post recorded in the deferred post ring.
+ *
+ * @param    p_rec   Pointer to the record of the post.
+ *
+ * @note     (1) The errors of the post itself cannot be reported to the ISR that recorded it and are
+ *               ignored, as they would have been by an ISR using the returned value of the post.
+ *******************************************************************************************************/
+static void OS_IntQRePost(OS_INT_Q_REC *p_rec)
+{
+  RTOS_ERR err;
+
+  switch (p_rec->Type) {
+#if (OS_CFG_SEM_EN == DEF_ENABLED)
+    case OS_OBJ_TYPE_SEM:
+      (void)OSSemPost((OS_SEM *)p_rec->ObjPtr,
+                      p_rec->Opt | OS_OPT_POST_NO_SCHED,
+                      &err);
+      break;
+#endif
+
+#if (OS_CFG_Q_EN == DEF_ENABLED)
+    case OS_OBJ_TYPE_Q:
+      OSQPost((OS_Q *)p_rec->ObjPtr,
+              p_rec->MsgPtr,
+              p_rec->MsgSize,
+              p_rec->Opt | OS_OPT_POST_NO_SCHED,
+              &err);
+      break;
+#endif
+
+#if (OS_CFG_FLAG_EN == DEF_ENABLED)
+    case OS_OBJ_TYPE_FLAG:
+      (void)OSFlagPost((OS_FLAG_GRP *)p_rec->ObjPtr,
+                       p_rec->Flags,
+                       p_rec->Opt | OS_OPT_POST_NO_SCHED,
+                       &err);
+      break;
+#endif
+
+    default:
+      RTOS_ERR_SET(err, RTOS_ERR_INVALID_TYPE);
+      break;
+  }
+  (void)err;                                                    // See Note #1.
+}
+
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                   DEPENDENCIES & AVAIL CHECK(S) END
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#endif // (defined(RTOS_MODULE_KERNEL_AVAIL))
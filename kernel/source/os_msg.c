@@ -110,6 +110,16 @@ OS_MSG_QTY OS_MsgQFreeAll(OS_MSG_Q *p_msg_q)
   OS_MSG_QTY qty;
 
   qty = p_msg_q->NbrEntries;                                    // Get the number of OS_MSGs being freed
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  if (p_msg_q->RingPtr != DEF_NULL) {                           // Ring queue, no OS_MSG to return to the pool
+    p_msg_q->RingOutIx = p_msg_q->RingInIx;
+    p_msg_q->NbrEntries = 0u;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_msg_q->NbrEntriesMax = 0u;
+#endif
+    return (qty);
+  }
+#endif
   if (p_msg_q->NbrEntries > 0u) {
     p_msg = p_msg_q->InPtr;                                     // Point to end of message chain
     p_msg->NextPtr = OSMsgPool.NextPtr;
@@ -147,7 +157,41 @@ void OS_MsgQInit(OS_MSG_Q   *p_msg_q,
 #endif
   p_msg_q->InPtr = DEF_NULL;
   p_msg_q->OutPtr = DEF_NULL;
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  p_msg_q->RingPtr = DEF_NULL;
+  p_msg_q->RingInIx = 0u;
+  p_msg_q->RingOutIx = 0u;
+#endif
+}
+
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                               OS_MsgQRingInit()
+ *
+ * @brief    This function is called to initialize a message queue storing its messages in a ring of
+ *           message slots instead of OS_MSGs taken from the message pool.
+ *
+ * @param    p_msg_q     Pointer to the message queue to initialize.
+ *
+ * @param    p_slot_tbl  Pointer to the ring of message slots.
+ *
+ * @param    slot_qty    Number of slots in 'p_slot_tbl'. MUST be a power of 2.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) The ring indexes are free running: the number of entries is their difference and the
+ *               slot of an index is found by masking it with 'slot_qty - 1'. Since 'slot_qty' is a power
+ *               of 2 that fits in an OS_MSG_QTY, the indexes wrap around consistently.
+ *******************************************************************************************************/
+void OS_MsgQRingInit(OS_MSG_Q    *p_msg_q,
+                     OS_MSG_SLOT *p_slot_tbl,
+                     OS_MSG_QTY  slot_qty)
+{
+  OS_MsgQInit(p_msg_q, slot_qty);
+
+  p_msg_q->RingPtr = p_slot_tbl;
 }
+#endif
 
 /****************************************************************************************************//**
  *                                               OS_MsgQGet()
@@ -175,6 +219,9 @@ void *OS_MsgQGet(OS_MSG_Q    *p_msg_q,
 {
   OS_MSG *p_msg;
   void   *p_void;
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  OS_MSG_SLOT *p_slot;
+#endif
 
 #if (OS_CFG_TS_EN == DEF_DISABLED)
   (void)p_ts;                                                   // Prevent compiler warning for not using 'ts'
@@ -191,6 +238,24 @@ void *OS_MsgQGet(OS_MSG_Q    *p_msg_q,
     return (DEF_NULL);
   }
 
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  if (p_msg_q->RingPtr != DEF_NULL) {                           // Ring queue, see OS_MsgQRingInit() Note #2
+    p_slot = &p_msg_q->RingPtr[p_msg_q->RingOutIx & (p_msg_q->NbrEntriesSize - 1u)];
+    p_void = p_slot->MsgPtr;
+    *p_msg_size = p_slot->MsgSize;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    if (p_ts != DEF_NULL) {
+      *p_ts = p_slot->MsgTS;
+    }
+#endif
+    p_msg_q->RingOutIx++;
+    p_msg_q->NbrEntries--;
+
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    return (p_void);
+  }
+#endif
+
   p_msg = p_msg_q->OutPtr;                                      // No, get the next message to extract from the queue
   p_void = p_msg->MsgPtr;
   *p_msg_size = p_msg->MsgSize;
@@ -218,6 +283,43 @@ void *OS_MsgQGet(OS_MSG_Q    *p_msg_q,
   return (p_void);
 }
 
+/****************************************************************************************************//**
+ *                                               OS_MsgQGetMulti()
+ *
+ * @brief    This function retrieves up to 'nbr_max' messages from a message queue.
+ *
+ * @param    p_msg_q         Pointer to the message queue where we want to extract the messages from.
+ *
+ * @param    p_void_tbl      Table that will receive the messages.
+ *
+ * @param    msg_size_tbl    Table that will receive the sizes (in bytes) of the messages.
+ *
+ * @param    nbr_max         Maximum number of messages to extract.
+ *
+ * @return   The number of messages extracted from the queue.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *******************************************************************************************************/
+OS_MSG_QTY OS_MsgQGetMulti(OS_MSG_Q    *p_msg_q,
+                           void        *p_void_tbl[],
+                           OS_MSG_SIZE msg_size_tbl[],
+                           OS_MSG_QTY  nbr_max)
+{
+  OS_MSG_QTY nbr;
+  OS_MSG_QTY i;
+  RTOS_ERR   err;
+
+  nbr = DEF_MIN(p_msg_q->NbrEntries, nbr_max);
+  for (i = 0u; i < nbr; i++) {
+    p_void_tbl[i] = OS_MsgQGet(p_msg_q,
+                               &msg_size_tbl[i],
+                               DEF_NULL,
+                               &err);
+  }
+
+  return (nbr);
+}
+
 /****************************************************************************************************//**
  *                                               OS_MsgQPut()
  *
@@ -251,6 +353,9 @@ void OS_MsgQPut(OS_MSG_Q    *p_msg_q,
 {
   OS_MSG *p_msg;
   OS_MSG *p_msg_in;
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  OS_MSG_SLOT *p_slot;
+#endif
 
 #if (OS_CFG_TS_EN == DEF_DISABLED)
   (void)ts;                                                     // Prevent compiler warning for not using 'ts'
@@ -261,6 +366,32 @@ void OS_MsgQPut(OS_MSG_Q    *p_msg_q,
     return;
   }
 
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+  if (p_msg_q->RingPtr != DEF_NULL) {                           // Ring queue, see OS_MsgQRingInit() Note #2
+    if ((opt & OS_OPT_POST_LIFO) == OS_OPT_POST_FIFO) {         // FIFO, fill the slot after the last message
+      p_slot = &p_msg_q->RingPtr[p_msg_q->RingInIx & (p_msg_q->NbrEntriesSize - 1u)];
+      p_msg_q->RingInIx++;
+    } else {                                                    // LIFO, fill the slot before the next message
+      p_msg_q->RingOutIx--;
+      p_slot = &p_msg_q->RingPtr[p_msg_q->RingOutIx & (p_msg_q->NbrEntriesSize - 1u)];
+    }
+    p_msg_q->NbrEntries++;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    if (p_msg_q->NbrEntriesMax < p_msg_q->NbrEntries) {
+      p_msg_q->NbrEntriesMax = p_msg_q->NbrEntries;
+    }
+#endif
+
+    p_slot->MsgPtr = p_void;                                    // Deposit message in the slot
+    p_slot->MsgSize = msg_size;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_slot->MsgTS = ts;
+#endif
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    return;
+  }
+#endif
+
   if (OSMsgPool.NbrFree == 0u) {
     RTOS_ERR_SET(*p_err, RTOS_ERR_NO_MORE_RSRC);                // No more OS_MSG to use
     return;
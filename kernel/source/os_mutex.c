@@ -96,6 +96,9 @@ void OSMutexCreate(OS_MUTEX *p_mutex,
   p_mutex->MutexGrpNextPtr = DEF_NULL;
   p_mutex->OwnerTCBPtr = DEF_NULL;
   p_mutex->OwnerNestingCtr = 0u;                                // Mutex is available
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  p_mutex->FastOwner = 0u;
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
   p_mutex->TS = 0u;
 #endif
@@ -177,6 +180,9 @@ OS_OBJ_QTY OSMutexDel(OS_MUTEX *p_mutex,
   OS_ASSERT_DBG_ERR_SET((p_mutex->Type == OS_OBJ_TYPE_MUTEX), *p_err, RTOS_ERR_INVALID_TYPE, 0u);
 
   CORE_ENTER_ATOMIC();
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  OS_MutexFastInflate(p_mutex);                                 // Make a fast path owner visible to the group
+#endif
   p_pend_list = &p_mutex->PendList;
   nbr_tasks = 0u;
   switch (opt) {
@@ -283,6 +289,11 @@ OS_OBJ_QTY OSMutexDel(OS_MUTEX *p_mutex,
  * @note     (1) A mutex can be nested, so RTOS_ERR_IS_OWNER error can be used as an indicator that you
  *               are nesting the mutex. If the correct number of OSMutexPost() is done the mutex will
  *               be released.
+ *
+ * @note     (2) When OS_CFG_MUTEX_FAST_EN is enabled, a free mutex is taken with a single CPU_CmpSwap()
+ *               on 'FastOwner', without a critical section. The owner is only added to the mutex group
+ *               when another task contends for the mutex, when the owner nests it, or when the mutex or
+ *               its owner is deleted (see OS_MutexFastInflate()).
  *******************************************************************************************************/
 void OSMutexPend(OS_MUTEX *p_mutex,
                  OS_TICK  timeout,
@@ -317,10 +328,32 @@ void OSMutexPend(OS_MUTEX *p_mutex,
   //                                                               Validate object type
   OS_ASSERT_DBG_ERR_SET((p_mutex->Type == OS_OBJ_TYPE_MUTEX), *p_err, RTOS_ERR_INVALID_TYPE,; );
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  if (CPU_CmpSwap(&p_mutex->FastOwner,                          // Take free mutex without a critical section ...
+                  0u,                                           // ... (see Note #2).
+                  (CPU_ADDR)OSTCBCurPtr) == DEF_YES) {
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    if (p_ts != DEF_NULL) {
+      *p_ts = p_mutex->TS;
+    }
+#endif
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    OS_TRACE_MUTEX_PEND(p_mutex);
+    OS_TRACE_MUTEX_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return;
+  }
+#endif
+
   CORE_ENTER_ATOMIC();
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  OS_MutexFastInflate(p_mutex);
+#endif
   if (p_mutex->OwnerNestingCtr == 0u) {                         // Resource available?
     p_mutex->OwnerTCBPtr = OSTCBCurPtr;                         // Yes, caller may proceed
     p_mutex->OwnerNestingCtr = 1u;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->FastOwner = OS_MUTEX_FAST_OWNER_SLOW;              // Keep the fast path away until released
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     if (p_ts != DEF_NULL) {
       *p_ts = p_mutex->TS;
@@ -566,6 +599,11 @@ OS_OBJ_QTY OSMutexPendAbort(OS_MUTEX *p_mutex,
  *                           - RTOS_ERR_NONE
  *                           - RTOS_ERR_OWNERSHIP
  *                           - RTOS_ERR_IS_OWNER
+ *
+ * @note     (1) When OS_CFG_MUTEX_FAST_EN is enabled, a mutex taken through the fast path and never
+ *               contended is released with a single CPU_CmpSwap() on 'FastOwner'. If another task
+ *               started waiting in the meantime, the compare fails and the mutex is handed over with
+ *               priority disinheritance as usual.
  *******************************************************************************************************/
 void OSMutexPost(OS_MUTEX *p_mutex,
                  OS_OPT   opt,
@@ -597,7 +635,26 @@ void OSMutexPost(OS_MUTEX *p_mutex,
   //                                                               Validate object type
   OS_ASSERT_DBG_ERR_SET((p_mutex->Type == OS_OBJ_TYPE_MUTEX), *p_err, RTOS_ERR_INVALID_TYPE,; );
 
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  if (p_mutex->FastOwner == (CPU_ADDR)OSTCBCurPtr) {            // Held through the fast path (see Note #1)?
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+    p_mutex->TS = OS_TS_GET();
+#endif
+    if (CPU_CmpSwap(&p_mutex->FastOwner,                        // Yes, release it unless a task started waiting.
+                    (CPU_ADDR)OSTCBCurPtr,
+                    0u) == DEF_YES) {
+      OS_TRACE_MUTEX_POST(p_mutex);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+      OS_TRACE_MUTEX_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+      return;
+    }
+  }
+#endif
+
   CORE_ENTER_ATOMIC();
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  OS_MutexFastInflate(p_mutex);
+#endif
   if (OSTCBCurPtr != p_mutex->OwnerTCBPtr) {                    // Make sure the mutex owner is releasing the mutex
     CORE_EXIT_ATOMIC();
     RTOS_ERR_SET(*p_err, RTOS_ERR_OWNERSHIP);
@@ -629,6 +686,9 @@ void OSMutexPost(OS_MUTEX *p_mutex,
   if (p_pend_list->HeadPtr == DEF_NULL) {                       // Any task waiting on mutex?
     p_mutex->OwnerTCBPtr = DEF_NULL;                            // No
     p_mutex->OwnerNestingCtr = 0u;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+    p_mutex->FastOwner = 0u;                                    // Free mutex can be taken by the fast path again
+#endif
     CORE_EXIT_ATOMIC();
     RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
     OS_TRACE_MUTEX_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
@@ -695,6 +755,9 @@ void OS_MutexClr(OS_MUTEX *p_mutex)
   p_mutex->MutexGrpNextPtr = DEF_NULL;
   p_mutex->OwnerTCBPtr = DEF_NULL;
   p_mutex->OwnerNestingCtr = 0u;
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  p_mutex->FastOwner = 0u;
+#endif
 #if (OS_CFG_TS_EN == DEF_ENABLED)
   p_mutex->TS = 0u;
 #endif
@@ -847,6 +910,9 @@ OS_PRIO OS_MutexGrpPrioFindHighest(OS_TCB *p_tcb)
  * @param    p_tcb   Pointer to the TCB of the task to process.
  *
  * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) Mutexes taken through the fast path are not part of the group. Nobody waits on them,
+ *               so they are found in the mutex debug list and simply marked free.
  *******************************************************************************************************/
 void OS_MutexGrpPostAll(OS_TCB *p_tcb)
 {
@@ -874,6 +940,9 @@ void OS_MutexGrpPostAll(OS_TCB *p_tcb)
     if (p_pend_list->HeadPtr == DEF_NULL) {                     // Any task waiting on mutex?
       p_mutex->OwnerNestingCtr = 0u;                            // Decrement owner's nesting counter
       p_mutex->OwnerTCBPtr = DEF_NULL;                          // No
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+      p_mutex->FastOwner = 0u;
+#endif
     } else {
       //                                                           Get TCB from head of pend list
       p_tcb_new = p_pend_list->HeadPtr;
@@ -890,8 +959,54 @@ void OS_MutexGrpPostAll(OS_TCB *p_tcb)
 
     p_mutex = p_mutex_next;
   }
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+  p_mutex = OSMutexDbgListPtr;                                  // Release mutexes taken through the fast path ...
+  while (p_mutex != DEF_NULL) {                                 // ... (see Note #2).
+    if (p_mutex->FastOwner == (CPU_ADDR)p_tcb) {
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+      p_mutex->TS = OS_TS_GET();
+#endif
+      p_mutex->FastOwner = 0u;
+    }
+    p_mutex = p_mutex->DbgNextPtr;
+  }
+#endif
+}
+
+/****************************************************************************************************//**
+ *                                           OS_MutexFastInflate()
+ *
+ * @brief    This function is called by the Kernel to turn a mutex taken through the fast path into a
+ *           regular owned mutex, so that its owner, nesting counter and group membership can be used.
+ *
+ * @param    p_mutex     Pointer to the mutex to process.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) This function MUST be called from within a critical section. 'FastOwner' is then set to
+ *               OS_MUTEX_FAST_OWNER_SLOW so that the owner's CPU_CmpSwap() in OSMutexPost() fails and
+ *               the release goes through the regular path, which hands the mutex to the waiters. It is
+ *               cleared again once the mutex is released with no task waiting.
+ *******************************************************************************************************/
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+void OS_MutexFastInflate(OS_MUTEX *p_mutex)
+{
+  OS_TCB *p_tcb;
+
+  if ((p_mutex->FastOwner == 0u)                                // Free or already owned through the regular path?
+      || (p_mutex->FastOwner == OS_MUTEX_FAST_OWNER_SLOW)) {
+    return;                                                     // Yes, nothing to do.
+  }
+
+  p_tcb = (OS_TCB *)p_mutex->FastOwner;
+  p_mutex->OwnerTCBPtr = p_tcb;
+  p_mutex->OwnerNestingCtr = 1u;
+  OS_MutexGrpAdd(p_tcb, p_mutex);                               // Add mutex to owner's group
+  p_mutex->FastOwner = OS_MUTEX_FAST_OWNER_SLOW;
 }
 #endif
+#endif
 
 /********************************************************************************************************
  ********************************************************************************************************
@@ -48,6 +48,9 @@ const CPU_CHAR *os_prio__c = "$Id: $";
 CPU_DATA OSPrioTbl[OS_PRIO_TBL_SIZE];                           // Declare the array local to this file to allow for...
                                                                 // ... optimization. This allows the table to be    ...
                                                                 // ... located in fast memory.
+#if (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)
+CPU_DATA OSPrioTblSummary;                                      // Bit set for each entry of OSPrioTbl that is not 0.
+#endif
 
 /********************************************************************************************************
  ********************************************************************************************************
@@ -70,6 +73,9 @@ void OS_PrioInit(void)
   for (i = 0u; i < OS_PRIO_TBL_SIZE; i++) {
     OSPrioTbl[i] = 0u;
   }
+#if (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)
+  OSPrioTblSummary = 0u;
+#endif
 }
 
 /****************************************************************************************************//**
@@ -81,6 +87,14 @@ void OS_PrioInit(void)
  * @return   The priority of the Highest Priority Task (HPT) waiting for the event.
  *
  * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) When OSPrioTbl spans more than two CPU_DATA entries, OSPrioTblSummary holds one bit per
+ *               entry (most significant bit for entry 0), set when the entry is not 0. The highest
+ *               priority is then found with two leading zeros counts, whatever the number of priorities.
+ *
+ * @note     (3) The idle task is always ready, so OSPrioTblSummary is never 0 once the Kernel runs. If it
+ *               is, the lowest priority (OS_CFG_PRIO_MAX - 1) is returned: unlike OS_CFG_PRIO_MAX, it
+ *               always fits in OS_PRIO & is a valid index in OSRdyList.
  *******************************************************************************************************/
 OS_PRIO OS_PrioGetHighest(void)
 {
@@ -96,6 +110,15 @@ OS_PRIO OS_PrioGetHighest(void)
   } else {
     return ((OS_PRIO)CPU_CntLeadZeros(OSPrioTbl[0]));
   }
+#elif (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)                   // Use the summary word, see Note #2.
+  CPU_DATA ix;
+
+  if (OSPrioTblSummary == 0u) {                                 // No task is ready, see Note #3.
+    return ((OS_PRIO)(OS_CFG_PRIO_MAX - 1u));
+  }
+  ix = CPU_CntLeadZeros(OSPrioTblSummary);
+
+  return ((OS_PRIO)((ix * DEF_INT_CPU_NBR_BITS) + CPU_CntLeadZeros(OSPrioTbl[ix])));
 #else
   CPU_DATA *p_tbl;
   OS_PRIO  prio;
@@ -142,6 +165,9 @@ void OS_PrioInsert(OS_PRIO prio)
   ix = prio / DEF_INT_CPU_NBR_BITS;
   bit_nbr = (CPU_DATA) prio & (DEF_INT_CPU_NBR_BITS - 1u);
   OSPrioTbl[ix] |= 1u << ((DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr);
+#if (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)
+  OSPrioTblSummary |= 1u << ((DEF_INT_CPU_NBR_BITS - 1u) - ix); // Entry is no longer empty.
+#endif
 #endif
 }
 
@@ -173,6 +199,11 @@ void OS_PrioRemove(OS_PRIO prio)
   ix = prio / DEF_INT_CPU_NBR_BITS;
   bit_nbr = (CPU_DATA) prio & (DEF_INT_CPU_NBR_BITS - 1u);
   OSPrioTbl[ix] &= ~(1u << ((DEF_INT_CPU_NBR_BITS - 1u) - bit_nbr));
+#if (OS_PRIO_TBL_SUMMARY_EN == DEF_ENABLED)
+  if (OSPrioTbl[ix] == 0u) {                                    // Last priority of the entry was removed.
+    OSPrioTblSummary &= ~(1u << ((DEF_INT_CPU_NBR_BITS - 1u) - ix));
+  }
+#endif
 #endif
 }
 
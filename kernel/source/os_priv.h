@@ -84,6 +84,13 @@
 #define  OS_ASSERT_DBG_ERR_SET(expr, err_var, err_code, ret_val)
 #endif
 
+//                                                                 ---------------- TIMER LINK OPTIONS ----------------
+#define  OS_OPT_LINK_DLY                          (OS_OPT)(0u)  // Link timer using its initial delay
+#define  OS_OPT_LINK_PERIODIC                     (OS_OPT)(1u)  // Link timer using its period
+
+//                                                                 ------------- MUTEX FAST OWNER SENTINEL ------------
+#define  OS_MUTEX_FAST_OWNER_SLOW              (CPU_ADDR)(1u)  // Mutex owned through the regular path
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           FUNCTION PROTOTYPES
@@ -152,6 +159,11 @@ void *OS_MsgQGet(OS_MSG_Q    *p_msg_q,
                  CPU_TS      *p_ts,
                  RTOS_ERR    *p_err);
 
+OS_MSG_QTY OS_MsgQGetMulti(OS_MSG_Q    *p_msg_q,
+                           void        *p_void_tbl[],
+                           OS_MSG_SIZE msg_size_tbl[],
+                           OS_MSG_QTY  nbr_max);
+
 void OS_MsgQInit(OS_MSG_Q   *p_msg_q,
                  OS_MSG_QTY size);
 
@@ -162,6 +174,12 @@ void OS_MsgQPut(OS_MSG_Q    *p_msg_q,
                 CPU_TS      ts,
                 RTOS_ERR    *p_err);
 
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+void OS_MsgQRingInit(OS_MSG_Q    *p_msg_q,
+                     OS_MSG_SLOT *p_slot_tbl,
+                     OS_MSG_QTY  slot_qty);
+#endif
+
 /********************************************************************************************************
  *                                       MUTUAL EXCLUSION SEMAPHORES
  *******************************************************************************************************/
@@ -184,6 +202,10 @@ void OS_MutexGrpRemove(OS_TCB   *p_tcb,
 OS_PRIO OS_MutexGrpPrioFindHighest(OS_TCB *p_tcb);
 
 void OS_MutexGrpPostAll(OS_TCB *p_tcb);
+
+#if (OS_CFG_MUTEX_FAST_EN == DEF_ENABLED)
+void OS_MutexFastInflate(OS_MUTEX *p_mutex);
+#endif
 #endif
 
 /********************************************************************************************************
@@ -308,10 +330,29 @@ void OS_TaskBlock(OS_TCB  *p_tcb,
                   OS_TICK timeout);
 
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
+sl_status_t OS_TaskTimerStart(OS_TCB  *p_tcb,
+                              OS_TICK timeout);
+
+sl_status_t OS_TaskTimerStop(OS_TCB *p_tcb);
+
 void OS_TimerCallback(sl_sleeptimer_timer_handle_t  *handle,
                       void                          *data);
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+void OS_TaskProfHistAdd(OS_PROF_HIST *p_hist,
+                        CPU_TS       ts);
+
+void OS_TaskProfHistClr(OS_TCB *p_tcb);
+
+void OS_TaskProfHistSw(OS_TCB *p_tcb_out,
+                       OS_TCB *p_tcb_in);
+#endif
+
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+CPU_STK_SIZE OS_TaskStkChkIncr(OS_TCB *p_tcb);
+#endif
+
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
 void OS_TaskDbgListAdd(OS_TCB *p_tcb);
 
@@ -356,6 +397,36 @@ void OS_TmrUnlink(OS_TMR *p_tmr);
 void OS_TmrTask(void *p_arg);
 #endif
 
+/********************************************************************************************************
+ *                                           DEFERRED ISR POSTS
+ *******************************************************************************************************/
+
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+void OS_IntQInit(RTOS_ERR *p_err);
+
+void OS_IntQPost(OS_OBJ_TYPE type,
+                 void        *p_obj,
+                 void        *p_msg,
+                 OS_MSG_SIZE msg_size,
+                 OS_FLAGS    flags,
+                 OS_OPT      opt,
+                 RTOS_ERR    *p_err);
+
+void OS_IntQTask(void *p_arg);
+#endif
+
+/********************************************************************************************************
+ *                                           TRACE RING RECORDER
+ *******************************************************************************************************/
+
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+void OS_TraceRingInit(void);
+
+void OS_TraceRingPut(CPU_INT16U evt,
+                     void       *p_obj,
+                     CPU_INT32U val);
+#endif
+
 /********************************************************************************************************
  *                                               MISCELLANEOUS
  *******************************************************************************************************/
@@ -118,6 +118,85 @@ void OSQCreate(OS_Q       *p_q,
   RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
 }
 
+#if (OS_CFG_Q_RING_EN == DEF_ENABLED)
+/****************************************************************************************************//**
+ *                                               OSQCreateRing()
+ *
+ * @brief    Called by your application to create a message queue that stores its messages in its own
+ *           ring of message slots instead of taking OS_MSGs from the kernel's message pool.
+ *
+ * @param    p_q         Pointer to the message queue.
+ *
+ * @param    p_name      Pointer to an ASCII string used to name the message queue.
+ *
+ * @param    p_slot_tbl  Pointer to the ring of message slots. It MUST remain allocated until the
+ *                       message queue is deleted.
+ *
+ * @param    slot_qty    Number of slots in 'p_slot_tbl', which is the maximum size of the message
+ *                       queue. MUST be a power of 2.
+ *
+ * @param    p_err       Pointer to the variable that will receive one of the following error
+ *                       code(s) from this function:
+ *                           - RTOS_ERR_NONE
+ *                           - RTOS_ERR_OS_ILLEGAL_RUN_TIME
+ *
+ * @note     (1) A ring message queue is used with the same services as any other message queue.
+ *               Posting and pending only touch the queue and its slots: queues do not contend on the
+ *               message pool and the messages of a queue are contiguous in memory.
+ *******************************************************************************************************/
+void OSQCreateRing(OS_Q        *p_q,
+                   CPU_CHAR    *p_name,
+                   OS_MSG_SLOT *p_slot_tbl,
+                   OS_MSG_QTY  slot_qty,
+                   RTOS_ERR    *p_err)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+#ifdef OS_SAFETY_CRITICAL_IEC61508
+  if (OSSafetyCriticalStartFlag == DEF_TRUE) {
+    RTOS_ERR_SET(*p_err, RTOS_ERR_OS_ILLEGAL_RUN_TIME);
+    return;
+  }
+#endif
+
+                                                                // Not allowed to call from an ISR
+  OS_ASSERT_DBG_ERR_SET((!CORE_InIrqContext()), *p_err, RTOS_ERR_ISR, ;);
+
+  //                                                               Validate 'p_q'
+  OS_ASSERT_DBG_ERR_SET((p_q != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  //                                                               Validate 'p_slot_tbl'
+  OS_ASSERT_DBG_ERR_SET((p_slot_tbl != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR,; );
+
+  //                                                               Ring size must be a non-zero power of 2
+  OS_ASSERT_DBG_ERR_SET((MATH_IS_PWR2(slot_qty) == DEF_YES), *p_err, RTOS_ERR_INVALID_ARG,; );
+
+  CORE_ENTER_ATOMIC();
+#if (OS_OBJ_TYPE_REQ == DEF_ENABLED)
+  p_q->Type = OS_OBJ_TYPE_Q;                                    // Mark the data structure as a message queue
+#endif
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  p_q->NamePtr = p_name;
+#else
+  (void)&p_name;
+#endif
+  OS_MsgQRingInit(&p_q->MsgQ,                                   // Initialize the queue on its ring
+                  p_slot_tbl,
+                  slot_qty);
+  OS_PendListInit(&p_q->PendList);                              // Initialize the waiting list
+
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  OS_QDbgListAdd(p_q);
+  OSQQty++;                                                     // One more queue created
+#endif
+  OS_TRACE_Q_CREATE(p_q, p_name);
+  CORE_EXIT_ATOMIC();
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+#endif
+
 /****************************************************************************************************//**
  *                                                   OSQDel()
  *
@@ -450,6 +529,153 @@ void *OSQPend(OS_Q        *p_q,
   return (p_void);
 }
 
+/****************************************************************************************************//**
+ *                                               OSQPendMulti()
+ *
+ * @brief    Waits for messages to be sent to a queue and receives up to 'nbr_max' of them at once.
+ *
+ * @param    p_q             Pointer to the message queue.
+ *
+ * @param    p_void_tbl      Table that will receive the messages, from the oldest to the most recent.
+ *
+ * @param    msg_size_tbl    Table that will receive the sizes (in bytes) of the messages.
+ *
+ * @param    nbr_max         Maximum number of messages to receive. Both tables MUST have room for at
+ *                           least 'nbr_max' entries.
+ *
+ * @param    timeout         Optional timeout period (in clock ticks), used when the queue is empty.
+ *                           See OSQPend().
+ *
+ * @param    opt             Determines whether the user wants to block if the queue is empty:
+ *                               - OS_OPT_PEND_BLOCKING
+ *                               - OS_OPT_PEND_NON_BLOCKING
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_OS_OBJ_DEL
+ *                               - RTOS_ERR_WOULD_BLOCK
+ *                               - RTOS_ERR_OS_SCHED_LOCKED
+ *                               - RTOS_ERR_ABORT
+ *                               - RTOS_ERR_TIMEOUT
+ *
+ * @return   The number of messages received, which is 0 upon error.
+ *
+ * @note     (1) All the messages waiting in the queue, up to 'nbr_max', are extracted in a single
+ *               critical section. When the queue is empty, the task waits for the first message like
+ *               with OSQPend() and then also extracts the messages posted while it was being readied.
+ *******************************************************************************************************/
+OS_MSG_QTY OSQPendMulti(OS_Q        *p_q,
+                        void        *p_void_tbl[],
+                        OS_MSG_SIZE msg_size_tbl[],
+                        OS_MSG_QTY  nbr_max,
+                        OS_TICK     timeout,
+                        OS_OPT      opt,
+                        RTOS_ERR    *p_err)
+{
+  OS_MSG_QTY nbr;
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, 0u);
+
+  OS_TRACE_Q_PEND_ENTER(p_q, timeout, opt, DEF_NULL, DEF_NULL);
+
+                                                                // Not allowed to call from an ISR
+  OS_ASSERT_DBG_ERR_SET((!CORE_InIrqContext()), *p_err, RTOS_ERR_ISR, 0u);
+
+  //                                                               Make sure kernel is running.
+  OS_ASSERT_DBG_ERR_SET((OSRunning == OS_STATE_OS_RUNNING), *p_err, RTOS_ERR_NOT_READY, 0u);
+
+  //                                                               Validate 'p_q'
+  OS_ASSERT_DBG_ERR_SET((p_q != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  //                                                               Validate the tables
+  OS_ASSERT_DBG_ERR_SET(((p_void_tbl != DEF_NULL)
+                         && (msg_size_tbl != DEF_NULL)), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  //                                                               Must receive at least one message
+  OS_ASSERT_DBG_ERR_SET((nbr_max != 0u), *p_err, RTOS_ERR_INVALID_ARG, 0u);
+
+  //                                                               Validate 'opt'
+  OS_ASSERT_DBG_ERR_SET(((opt == OS_OPT_PEND_BLOCKING)
+                         || (opt == OS_OPT_PEND_NON_BLOCKING)), *p_err, RTOS_ERR_INVALID_ARG, 0u);
+
+  //                                                               Validate object type
+  OS_ASSERT_DBG_ERR_SET((p_q->Type == OS_OBJ_TYPE_Q), *p_err, RTOS_ERR_INVALID_TYPE, 0u);
+
+  CORE_ENTER_ATOMIC();
+  nbr = OS_MsgQGetMulti(&p_q->MsgQ,                             // Any message waiting in the message queue?
+                        p_void_tbl,
+                        msg_size_tbl,
+                        nbr_max);
+  if (nbr > 0u) {
+    CORE_EXIT_ATOMIC();
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    OS_TRACE_Q_PEND(p_q);
+    OS_TRACE_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (nbr);                                               // Yes, Return messages received
+  }
+
+  if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {                 // Caller wants to block if not available?
+    CORE_EXIT_ATOMIC();
+    RTOS_ERR_SET(*p_err, RTOS_ERR_WOULD_BLOCK);                 // No
+    OS_TRACE_Q_PEND_FAILED(p_q);
+    OS_TRACE_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (0u);
+  } else {
+    if (OSSchedLockNestingCtr > 0u) {                           // Can't pend when the scheduler is locked
+      CORE_EXIT_ATOMIC();
+      RTOS_ERR_SET(*p_err, RTOS_ERR_OS_SCHED_LOCKED);
+      OS_TRACE_Q_PEND_FAILED(p_q);
+      OS_TRACE_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+      return (0u);
+    }
+  }
+
+  OS_Pend((OS_PEND_OBJ *)((void *)p_q),                         // Block task pending on Message Queue
+          OS_TASK_PEND_ON_Q,
+          timeout);
+  CORE_EXIT_ATOMIC();
+  OS_TRACE_Q_PEND_BLOCK(p_q);
+  OSSched();                                                    // Find the next highest priority task ready to run
+
+  CORE_ENTER_ATOMIC();
+  switch (OSTCBCurPtr->PendStatus) {
+    case OS_STATUS_PEND_OK:                                     // Extract message from TCB (Put there by Post) ...
+      p_void_tbl[0] = OSTCBCurPtr->MsgPtr;
+      msg_size_tbl[0] = OSTCBCurPtr->MsgSize;
+      nbr = 1u + OS_MsgQGetMulti(&p_q->MsgQ,                    // ... and the ones posted since, see Note #1
+                                 &p_void_tbl[1],
+                                 &msg_size_tbl[1],
+                                 nbr_max - 1u);
+      OS_TRACE_Q_PEND(p_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+      break;
+
+    case OS_STATUS_PEND_ABORT:                                  // Indicate that we aborted
+      OS_TRACE_Q_PEND_FAILED(p_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_ABORT);
+      break;
+
+    case OS_STATUS_PEND_TIMEOUT:                                // Indicate that we didn't get event within TO
+      OS_TRACE_Q_PEND_FAILED(p_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_TIMEOUT);
+      break;
+
+    case OS_STATUS_PEND_DEL:                                    // Indicate that object pended on has been deleted
+      OS_TRACE_Q_PEND_FAILED(p_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_OS_OBJ_DEL);
+      break;
+
+    default:
+      OS_TRACE_Q_PEND_FAILED(p_q);
+      RTOS_CRITICAL_FAIL_EXEC(RTOS_ERR_OS, 0u);
+  }
+  CORE_EXIT_ATOMIC();
+  OS_TRACE_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+  return (nbr);
+}
+
 /****************************************************************************************************//**
  *                                               OSQPendAbort()
  *
@@ -580,6 +806,10 @@ OS_OBJ_QTY OSQPendAbort(OS_Q     *p_q,
  *                           - RTOS_ERR_NO_MORE_RSRC
  *
  * @note     (1) This function may be called from an ISR.
+ *
+ * @note     (2) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a post from an ISR is only recorded and is
+ *               performed later by the kernel's ISR handler task. RTOS_ERR_WOULD_OVF is then returned if
+ *               the deferred post ring is full, and the errors of the post itself are not reported.
  *******************************************************************************************************/
 void OSQPost(OS_Q        *p_q,
              void        *p_void,
@@ -617,6 +847,20 @@ void OSQPost(OS_Q        *p_q,
   //                                                               Validate object type
   OS_ASSERT_DBG_ERR_SET((p_q->Type == OS_OBJ_TYPE_Q), *p_err, RTOS_ERR_INVALID_TYPE,; );
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  if (CORE_InIrqContext() == DEF_TRUE) {                        // Defer the post when called from an ISR, see Note #2.
+    OS_IntQPost(OS_OBJ_TYPE_Q,
+                (void *)p_q,
+                p_void,
+                msg_size,
+                0u,
+                opt,
+                p_err);
+    OS_TRACE_Q_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return;
+  }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
   ts = OS_TS_GET();                                             // Get timestamp
 #else
@@ -671,6 +915,138 @@ void OSQPost(OS_Q        *p_q,
   OS_TRACE_Q_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
 }
 
+/****************************************************************************************************//**
+ *                                               OSQPostMulti()
+ *
+ * @brief    Sends up to 'nbr' messages to a message queue in a single kernel entry.
+ *
+ * @param    p_q             Pointer to a message queue.
+ *
+ * @param    p_void_tbl      Table of the messages to send.
+ *
+ * @param    msg_size_tbl    Table of the sizes (in bytes) of the messages to send.
+ *
+ * @param    nbr             Number of messages in the tables.
+ *
+ * @param    opt             Determines the type of POST performed:
+ *                               - OS_OPT_POST_FIFO        POST messages to the end of the queue (FIFO).
+ *                               - OS_OPT_POST_LIFO        POST messages to the front of the queue (LIFO).
+ *                               - OS_OPT_POST_NO_SCHED    Do not call the scheduler.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_WOULD_OVF
+ *                               - RTOS_ERR_NO_MORE_RSRC
+ *
+ * @return   The number of messages sent. When it is less than 'nbr', 'p_err' tells why the next message
+ *           could not be sent.
+ *
+ * @note     (1) This function may be called from an ISR.
+ *
+ * @note     (2) The messages are sent in the order of the tables. Each one is given to the highest
+ *               priority task waiting on the queue, if any, or placed in the queue. The scheduler is
+ *               called only once, after all the messages have been sent.
+ *
+ * @note     (3) Interrupts are disabled while all the messages are sent. Keep 'nbr' small enough for
+ *               the interrupt latency of your application.
+ *
+ * @note     (4) Unlike OSQPost(), this function is never deferred when called from an ISR, even when
+ *               OS_CFG_ISR_POST_DEFERRED_EN is enabled.
+ *******************************************************************************************************/
+OS_MSG_QTY OSQPostMulti(OS_Q        *p_q,
+                        void        *p_void_tbl[],
+                        OS_MSG_SIZE msg_size_tbl[],
+                        OS_MSG_QTY  nbr,
+                        OS_OPT      opt,
+                        RTOS_ERR    *p_err)
+{
+  OS_OPT       post_type;
+  OS_PEND_LIST *p_pend_list;
+  OS_MSG_QTY   nbr_posted;
+  CPU_BOOLEAN  sched;
+  CPU_TS       ts;
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, 0u);
+
+  OS_TRACE_Q_POST_ENTER(p_q, p_void_tbl, nbr, opt);
+
+  //                                                               Make sure kernel is running.
+  OS_ASSERT_DBG_ERR_SET((OSRunning == OS_STATE_OS_RUNNING), *p_err, RTOS_ERR_NOT_READY, 0u);
+
+  //                                                               Validate 'p_q'
+  OS_ASSERT_DBG_ERR_SET((p_q != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  //                                                               Validate the tables
+  OS_ASSERT_DBG_ERR_SET(((p_void_tbl != DEF_NULL)
+                         && (msg_size_tbl != DEF_NULL)), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  //                                                               Validate 'opt'
+  OS_ASSERT_DBG_ERR_SET(((opt == OS_OPT_POST_FIFO)
+                         || (opt == OS_OPT_POST_LIFO)
+                         || (opt == (OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED))
+                         || (opt == (OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED))), *p_err, RTOS_ERR_INVALID_ARG, 0u);
+
+  //                                                               Validate object type
+  OS_ASSERT_DBG_ERR_SET((p_q->Type == OS_OBJ_TYPE_Q), *p_err, RTOS_ERR_INVALID_TYPE, 0u);
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  ts = OS_TS_GET();                                             // Get timestamp
+#else
+  ts = 0u;
+#endif
+
+  OS_TRACE_Q_POST(p_q);
+
+  if ((opt & OS_OPT_POST_LIFO) == 0u) {                         // Determine whether we post FIFO or LIFO
+    post_type = OS_OPT_POST_FIFO;
+  } else {
+    post_type = OS_OPT_POST_LIFO;
+  }
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+  nbr_posted = 0u;
+  sched = DEF_NO;
+  p_pend_list = &p_q->PendList;
+
+  CORE_ENTER_ATOMIC();                                          // See Note #3.
+  while (nbr_posted < nbr) {
+    if (p_pend_list->HeadPtr != DEF_NULL) {                     // Any task waiting on message queue?
+      OS_Post((OS_PEND_OBJ *)((void *)p_q),                     // Yes, give message to the highest priority one
+              p_pend_list->HeadPtr,
+              p_void_tbl[nbr_posted],
+              msg_size_tbl[nbr_posted],
+              ts);
+      sched = DEF_YES;
+    } else {
+      OS_MsgQPut(&p_q->MsgQ,                                    // No,  place message in the message queue
+                 p_void_tbl[nbr_posted],
+                 msg_size_tbl[nbr_posted],
+                 post_type,
+                 ts,
+                 p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+    }
+    nbr_posted++;
+  }
+  CORE_EXIT_ATOMIC();
+
+  if ((sched == DEF_YES)
+      && ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+    OSSched();                                                  // Run the scheduler once, see Note #2.
+  }
+
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    OS_TRACE_Q_POST_FAILED(p_q);
+  }
+  OS_TRACE_Q_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+
+  return (nbr_posted);
+}
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           INTERNAL FUNCTIONS
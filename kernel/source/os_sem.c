@@ -512,6 +512,10 @@ OS_OBJ_QTY OSSemPendAbort(OS_SEM   *p_sem,
  *               scheduler from being called.
  *
  * @note     (2) This function may be called from an ISR.
+ *
+ * @note     (3) When OS_CFG_ISR_POST_DEFERRED_EN is enabled, a post from an ISR is only recorded and is
+ *               performed later by the kernel's ISR handler task. 0 is then returned, and RTOS_ERR_WOULD_OVF
+ *               if the deferred post ring is full.
  *******************************************************************************************************/
 OS_SEM_CTR OSSemPost(OS_SEM   *p_sem,
                      OS_OPT   opt,
@@ -543,6 +547,20 @@ OS_SEM_CTR OSSemPost(OS_SEM   *p_sem,
   //                                                               Validate object type
   OS_ASSERT_DBG_ERR_SET((p_sem->Type == OS_OBJ_TYPE_SEM), *p_err, RTOS_ERR_INVALID_TYPE, 0u);
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  if (CORE_InIrqContext() == DEF_TRUE) {                        // Defer the post when called from an ISR, see Note #3.
+    OS_IntQPost(OS_OBJ_TYPE_SEM,
+                (void *)p_sem,
+                DEF_NULL,
+                0u,
+                0u,
+                opt,
+                p_err);
+    OS_TRACE_SEM_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (0u);
+  }
+#endif
+
 #if (OS_CFG_TS_EN == DEF_ENABLED)
   ts = OS_TS_GET();                                             // Get timestamp
 #else
@@ -104,6 +104,13 @@ void OSStatReset(RTOS_ERR *p_err)
 #endif
 #endif
 
+#if (OS_CFG_ISR_POST_DEFERRED_EN == DEF_ENABLED)
+  OSIntQNbrEntriesMax = 0u;
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  OSIntQTaskTimeMax = 0u;
+#endif
+#endif
+
 #if (OS_CFG_SCHED_LOCK_TIME_MEAS_EN == DEF_ENABLED)
   OSSchedLockTimeMax = 0u;                                      // Reset the maximum scheduler lock time
 #endif
@@ -139,6 +146,10 @@ void OSStatReset(RTOS_ERR *p_err)
 #endif
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+    OS_TaskProfHistClr(p_tcb);
+#endif
+
 #if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
     p_msg_q = &p_tcb->MsgQ;
     p_msg_q->NbrEntriesMax = 0u;
@@ -41,6 +41,20 @@
 const CPU_CHAR *os_task__c = "$Id: $";
 #endif
 
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               LOCAL DEFINES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+//                                                                 Stack entry 'ix', counted from the stack end ...
+//                                                                 ... the task grows towards (see OS_TaskStkChkIncr()).
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+#define  OS_TASK_STK_CHK_ENTRY(p_stk_end, ix)       (*((p_stk_end) + (ix)))
+#else
+#define  OS_TASK_STK_CHK_ENTRY(p_stk_end, ix)       (*((p_stk_end) - (ix)))
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           GLOBAL FUNCTIONS
@@ -330,6 +344,14 @@ void OSTaskCreate(OS_TCB       *p_tcb,
 #if ((OS_CFG_DBG_EN == DEF_ENABLED) || (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED) || (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED))
   p_tcb->StkBasePtr = p_stk_base;                               // Save pointer to the base address of the stack
   p_tcb->StkSize = stk_size;                                    // Save the stack size (in number of CPU_STK elements)
+#endif
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+  p_tcb->StkChkFree = stk_size - OS_CFG_TASK_STK_REDZONE_DEPTH; // Nothing checked yet: whole stack is below watermark
+#else
+  p_tcb->StkChkFree = stk_size;                                 // Nothing checked yet: whole stack is below watermark
+#endif
+  p_tcb->StkChkSweepIx = 0u;
 #endif
   p_tcb->Opt = opt;                                             // Save task options
 
@@ -447,7 +469,7 @@ void OSTaskDel(OS_TCB   *p_tcb,
     case OS_TASK_STATE_DLY:                                     // Task is only delayed, not on any wait list
     case OS_TASK_STATE_DLY_SUSPENDED:
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
-      status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+      status = OS_TaskTimerStop(p_tcb);
       RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
 #endif
       break;
@@ -495,7 +517,7 @@ void OSTaskDel(OS_TCB   *p_tcb,
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       if ((p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT)
           || (p_tcb->TaskState == OS_TASK_STATE_PEND_TIMEOUT_SUSPENDED)) {
-        status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+        status = OS_TaskTimerStop(p_tcb);
         RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
       }
 #endif
@@ -762,6 +784,146 @@ void *OSTaskQPend(OS_TICK     timeout,
 }
 #endif
 
+/****************************************************************************************************//**
+ *                                           OSTaskQPendMulti()
+ *
+ * @brief    This function causes the current task to wait for messages to be posted to it and to
+ *           receive up to 'nbr_max' of them at once.
+ *
+ * @param    p_void_tbl      Table that will receive the messages, from the oldest to the most recent.
+ *
+ * @param    msg_size_tbl    Table that will receive the sizes (in bytes) of the messages.
+ *
+ * @param    nbr_max         Maximum number of messages to receive. Both tables MUST have room for at
+ *                           least 'nbr_max' entries.
+ *
+ * @param    timeout         Optional timeout period (in clock ticks), used when the task's queue is
+ *                           empty. See OSTaskQPend().
+ *
+ * @param    opt             Determines if the user wants to block if the task's queue is empty or
+ *                           not:
+ *                               - OS_OPT_PEND_BLOCKING        Task will     block.
+ *                               - OS_OPT_PEND_NON_BLOCKING    Task will NOT block.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_WOULD_BLOCK
+ *                               - RTOS_ERR_OS_SCHED_LOCKED
+ *                               - RTOS_ERR_ABORT
+ *                               - RTOS_ERR_TIMEOUT
+ *
+ * @return   The number of messages received, which is 0 upon error.
+ *
+ * @note     (1) All the messages waiting in the task's queue, up to 'nbr_max', are extracted in a
+ *               single critical section. When the queue is empty, the task waits for the first message
+ *               like with OSTaskQPend() and then also extracts the messages posted while it was being
+ *               readied.
+ ********************************************************************************************************/
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+OS_MSG_QTY OSTaskQPendMulti(void        *p_void_tbl[],
+                            OS_MSG_SIZE msg_size_tbl[],
+                            OS_MSG_QTY  nbr_max,
+                            OS_TICK     timeout,
+                            OS_OPT      opt,
+                            RTOS_ERR    *p_err)
+{
+  OS_MSG_Q   *p_msg_q;
+  OS_MSG_QTY nbr;
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, 0u);
+
+  OS_TRACE_TASK_MSG_Q_PEND_ENTER(&OSTCBCurPtr->MsgQ, timeout, opt, DEF_NULL, DEF_NULL);
+
+                                                                // Not allowed to call from an ISR
+  OS_ASSERT_DBG_ERR_SET((!CORE_InIrqContext()), *p_err, RTOS_ERR_ISR, 0u);
+
+  //                                                               Make sure kernel is running.
+  OS_ASSERT_DBG_ERR_SET((OSRunning == OS_STATE_OS_RUNNING), *p_err, RTOS_ERR_NOT_READY, 0u);
+
+  //                                                               Validate the tables
+  OS_ASSERT_DBG_ERR_SET(((p_void_tbl != DEF_NULL)
+                         && (msg_size_tbl != DEF_NULL)), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  //                                                               Must receive at least one message
+  OS_ASSERT_DBG_ERR_SET((nbr_max != 0u), *p_err, RTOS_ERR_INVALID_ARG, 0u);
+
+  //                                                               Validate 'opt'
+  OS_ASSERT_DBG_ERR_SET(((opt == OS_OPT_PEND_BLOCKING)
+                         || (opt == OS_OPT_PEND_NON_BLOCKING)), *p_err, RTOS_ERR_INVALID_ARG, 0u);
+
+  CORE_ENTER_ATOMIC();
+  p_msg_q = &OSTCBCurPtr->MsgQ;                                 // Any message waiting in the message queue?
+  nbr = OS_MsgQGetMulti(p_msg_q,
+                        p_void_tbl,
+                        msg_size_tbl,
+                        nbr_max);
+  if (nbr > 0u) {
+    CORE_EXIT_ATOMIC();
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+    OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+    OS_TRACE_TASK_MSG_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (nbr);                                               // Yes, Return oldest messages received
+  }
+
+  if ((opt & OS_OPT_PEND_NON_BLOCKING) != 0u) {                 // Caller wants to block if not available?
+    RTOS_ERR_SET(*p_err, RTOS_ERR_WOULD_BLOCK);                 // No
+    CORE_EXIT_ATOMIC();
+    OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+    OS_TRACE_TASK_MSG_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (0u);
+  } else {                                                      // Yes
+    if (OSSchedLockNestingCtr > 0u) {                           // Can't block when the scheduler is locked
+      CORE_EXIT_ATOMIC();
+      RTOS_ERR_SET(*p_err, RTOS_ERR_OS_SCHED_LOCKED);
+      OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+      OS_TRACE_TASK_MSG_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+      return (0u);
+    }
+  }
+
+  OS_Pend(DEF_NULL,                                             // Block task pending on Message
+          OS_TASK_PEND_ON_TASK_Q,
+          timeout);
+  CORE_EXIT_ATOMIC();
+  OS_TRACE_TASK_MSG_Q_PEND_BLOCK(p_msg_q);
+  OSSched();                                                    // Find the next highest priority task ready to run
+
+  CORE_ENTER_ATOMIC();
+  switch (OSTCBCurPtr->PendStatus) {
+    case OS_STATUS_PEND_OK:                                     // Extract message from TCB (Put there by Post) ...
+      p_void_tbl[0] = OSTCBCurPtr->MsgPtr;
+      msg_size_tbl[0] = OSTCBCurPtr->MsgSize;
+      nbr = 1u + OS_MsgQGetMulti(p_msg_q,                       // ... and the ones posted since, see Note #1
+                                 &p_void_tbl[1],
+                                 &msg_size_tbl[1],
+                                 nbr_max - 1u);
+      OS_TRACE_TASK_MSG_Q_PEND(p_msg_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+      break;
+
+    case OS_STATUS_PEND_ABORT:                                  // Indicate that we aborted
+      OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_ABORT);
+      break;
+
+    case OS_STATUS_PEND_TIMEOUT:                                // Indicate that we didn't get event within TO
+      OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+      RTOS_ERR_SET(*p_err, RTOS_ERR_TIMEOUT);
+      break;
+
+    case OS_STATUS_PEND_DEL:
+    default:
+      OS_TRACE_TASK_MSG_Q_PEND_FAILED(p_msg_q);
+      RTOS_CRITICAL_FAIL_EXEC(RTOS_ERR_OS, 0u);
+  }
+  CORE_EXIT_ATOMIC();
+  OS_TRACE_TASK_MSG_Q_PEND_EXIT(RTOS_ERR_CODE_GET(*p_err));
+  return (nbr);                                                 // Return number of received messages
+}
+#endif
+
 /****************************************************************************************************//**
  *                                           OSTaskQPendAbort()
  *
@@ -959,6 +1121,138 @@ void OSTaskQPost(OS_TCB      *p_tcb,
 }
 #endif
 
+/****************************************************************************************************//**
+ *                                           OSTaskQPostMulti()
+ *
+ * @brief    Sends up to 'nbr' messages to a task in a single kernel entry.
+ *
+ * @param    p_tcb           Pointer to the TCB of the task receiving the messages. If you specify a
+ *                           NULL pointer, the messages will be posted to the task's queue of the
+ *                           calling task.
+ *
+ * @param    p_void_tbl      Table of the messages to send.
+ *
+ * @param    msg_size_tbl    Table of the sizes (in bytes) of the messages to send.
+ *
+ * @param    nbr             Number of messages in the tables.
+ *
+ * @param    opt             Specifies whether the post will be FIFO or LIFO:
+ *                               - OS_OPT_POST_FIFO        Post at the end   of the queue.
+ *                               - OS_OPT_POST_LIFO        Post at the front of the queue.
+ *                               - OS_OPT_POST_NO_SCHED    Do not run the scheduler after the post.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *                               - RTOS_ERR_WOULD_OVF
+ *                               - RTOS_ERR_NO_MORE_RSRC
+ *                               - RTOS_ERR_INVALID_STATE
+ *
+ * @return   The number of messages sent. When it is less than 'nbr', 'p_err' tells why the next message
+ *           could not be sent.
+ *
+ * @note     (1) This function may be called from an ISR.
+ *
+ * @note     (2) If the task is waiting for a message, the first message is given to it directly and the
+ *               following ones are placed in its queue. The scheduler is called only once, after all the
+ *               messages have been sent.
+ *
+ * @note     (3) Interrupts are disabled while all the messages are sent. Keep 'nbr' small enough for
+ *               the interrupt latency of your application.
+ ********************************************************************************************************/
+#if (OS_CFG_TASK_Q_EN == DEF_ENABLED)
+OS_MSG_QTY OSTaskQPostMulti(OS_TCB      *p_tcb,
+                            void        *p_void_tbl[],
+                            OS_MSG_SIZE msg_size_tbl[],
+                            OS_MSG_QTY  nbr,
+                            OS_OPT      opt,
+                            RTOS_ERR    *p_err)
+{
+  OS_MSG_QTY  nbr_posted;
+  CPU_BOOLEAN sched;
+  CPU_TS      ts;
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, 0u);
+
+  //                                                               Make sure kernel is running.
+  OS_ASSERT_DBG_ERR_SET((OSRunning == OS_STATE_OS_RUNNING), *p_err, RTOS_ERR_NOT_READY, 0u);
+
+  //                                                               Validate the tables
+  OS_ASSERT_DBG_ERR_SET(((p_void_tbl != DEF_NULL)
+                         && (msg_size_tbl != DEF_NULL)), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  //                                                               Validate 'opt'
+  OS_ASSERT_DBG_ERR_SET(((opt == OS_OPT_POST_FIFO)
+                         || (opt == OS_OPT_POST_LIFO)
+                         || (opt == (OS_OPT_POST_FIFO | OS_OPT_POST_NO_SCHED))
+                         || (opt == (OS_OPT_POST_LIFO | OS_OPT_POST_NO_SCHED))), *p_err, RTOS_ERR_INVALID_ARG, 0u);
+
+#if (OS_CFG_TS_EN == DEF_ENABLED)
+  ts = OS_TS_GET();                                             // Get timestamp
+#else
+  ts = 0u;
+#endif
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);                          // Assume we won't have any errors
+  nbr_posted = 0u;
+  sched = DEF_NO;
+
+  CORE_ENTER_ATOMIC();                                          // See Note #3.
+  if (p_tcb == DEF_NULL) {                                      // Post msg to 'self'?
+    p_tcb = OSTCBCurPtr;
+  }
+
+  OS_TRACE_TASK_MSG_Q_POST_ENTER(&p_tcb->MsgQ, p_void_tbl, nbr, opt);
+  OS_TRACE_TASK_MSG_Q_POST(&p_tcb->MsgQ);
+
+#if (OS_CFG_TASK_DEL_EN == DEF_ENABLED)
+  if (p_tcb->TaskState == OS_TASK_STATE_DEL) {
+    CORE_EXIT_ATOMIC();
+    RTOS_ERR_SET(*p_err, RTOS_ERR_INVALID_STATE);
+    OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+    OS_TRACE_TASK_MSG_Q_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+    return (0u);
+  }
+#endif
+
+  while (nbr_posted < nbr) {
+    if (p_tcb->PendOn == OS_TASK_PEND_ON_TASK_Q) {              // Is task waiting for a message to be sent to it?
+      OS_Post(DEF_NULL,                                         // Yes, give it the message, see Note #2
+              p_tcb,
+              p_void_tbl[nbr_posted],
+              msg_size_tbl[nbr_posted],
+              ts);
+      sched = DEF_YES;
+    } else {
+      OS_MsgQPut(&p_tcb->MsgQ,                                  // No,  deposit the message in the task's queue
+                 p_void_tbl[nbr_posted],
+                 msg_size_tbl[nbr_posted],
+                 opt,
+                 ts,
+                 p_err);
+      if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+        break;
+      }
+    }
+    nbr_posted++;
+  }
+  CORE_EXIT_ATOMIC();
+
+  if ((sched == DEF_YES)
+      && ((opt & OS_OPT_POST_NO_SCHED) == 0u)) {
+    OSSched();                                                  // Run the scheduler once, see Note #2.
+  }
+
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    OS_TRACE_TASK_MSG_Q_POST_FAILED(&p_tcb->MsgQ);
+  }
+  OS_TRACE_TASK_MSG_Q_POST_EXIT(RTOS_ERR_CODE_GET(*p_err));
+
+  return (nbr_posted);
+}
+#endif
+
 /****************************************************************************************************//**
  *                                               OSTaskRegGet()
  *
@@ -1666,6 +1960,9 @@ OS_SEM_CTR OSTaskSemSet(OS_TCB     *p_tcb,
  *
  * @note     (1) Options OS_OPT_TASK_STK_CHK and OS_OPT_TASK_STK_CLR should be set in OSTaskCreate() call
  *           in order to use OSTaskStkChk(). See OS_OPT_TASK_xxx in os.h.
+ *
+ * @note     (2) When OS_CFG_TASK_STK_CHK_INCR_EN is enabled, the free entries are not all scanned at
+ *               each call. See OS_TaskStkChkIncr().
  *******************************************************************************************************/
 
 #if (OS_CFG_STAT_TASK_STK_CHK_EN == DEF_ENABLED)
@@ -1675,7 +1972,9 @@ void OSTaskStkChk(OS_TCB       *p_tcb,
                   RTOS_ERR     *p_err)
 {
   CPU_STK_SIZE free_stk;
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_DISABLED)
   CPU_STK      *p_stk;
+#endif
   CORE_DECLARE_IRQ_STATE;
 
   OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
@@ -1710,6 +2009,9 @@ void OSTaskStkChk(OS_TCB       *p_tcb,
   }
   CORE_EXIT_ATOMIC();
 
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+  free_stk = OS_TaskStkChkIncr(p_tcb);                          // See Note #2.
+#else
   free_stk = 0u;
 #if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
   p_stk = p_tcb->StkBasePtr;                                    // Start at the lowest memory and go up
@@ -1729,6 +2031,7 @@ void OSTaskStkChk(OS_TCB       *p_tcb,
     free_stk++;
     p_stk--;
   }
+#endif
 #endif
   *p_free = free_stk;
   *p_used = (p_tcb->StkSize - free_stk);                        // Compute number of entries used on the stack
@@ -1933,6 +2236,52 @@ void OSTaskTimeQuantaSet(OS_TCB   *p_tcb,
 }
 #endif
 
+/****************************************************************************************************//**
+ *                                           OSTaskTickSlackSet()
+ *
+ * @brief    Changes the tolerance a task accepts on its delays and pend timeouts, so that its wakeup
+ *           can be coalesced with the wakeup of other tasks.
+ *
+ * @param    p_tcb   Pointer to the TCB of the task to change. If you specify an NULL pointer, the
+ *                   current task is assumed.
+ *
+ * @param    slack   Number of ticks the task may be woken after its delay or timeout elapsed. A value
+ *                   of 0 means that the task is always woken on time (default).
+ *
+ * @param    p_err   Pointer to the variable that will receive one of the following error code(s)
+ *                   from this function:
+ *                       - RTOS_ERR_NONE
+ *
+ * @note     (1) A task with a slack is woken at the latest 'slack' ticks after its delay elapsed. It is
+ *               woken earlier if the timer of another task expires after its delay elapsed. Giving a
+ *               slack to periodic tasks with close deadlines reduces the number of timer interrupts and
+ *               context switches. OSTickSlackWakeupCtr and OSTickSlackCoalescedCtr count respectively
+ *               the number of task timers that expired and the number of tasks woken by another task's
+ *               timer.
+ *
+ * @note     (2) The new slack applies from the next delay or pend with timeout of the task.
+ ********************************************************************************************************/
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+void OSTaskTickSlackSet(OS_TCB   *p_tcb,
+                        OS_TICK  slack,
+                        RTOS_ERR *p_err)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err,; );
+
+  CORE_ENTER_ATOMIC();
+  if (p_tcb == DEF_NULL) {
+    p_tcb = OSTCBCurPtr;
+  }
+
+  p_tcb->TickSlack = slack;
+  CORE_EXIT_ATOMIC();
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+}
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           INTERNAL FUNCTIONS
@@ -2121,11 +2470,22 @@ void OS_TaskInitTCB(OS_TCB *p_tcb)
   p_tcb->StkUsed = 0u;
 #endif
 
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+  p_tcb->StkChkFree = 0u;
+  p_tcb->StkChkSweepIx = 0u;
+#endif
+
   p_tcb->Opt = 0u;
 
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
   p_tcb->TickCtrPrev = 0u;
   p_tcb->IsTickCtrPrevValid = DEF_NO;
+#if (OS_CFG_TICK_SLACK_EN == DEF_ENABLED)
+  p_tcb->TickSlack = 0u;
+  p_tcb->TickSlackMatch = 0u;
+  p_tcb->TickSlackNextPtr = DEF_NULL;
+  p_tcb->TickSlackPrevPtr = DEF_NULL;
+#endif
 #endif
 
 #if (OS_CFG_SCHED_ROUND_ROBIN_EN == DEF_ENABLED)
@@ -2150,6 +2510,14 @@ void OS_TaskInitTCB(OS_TCB *p_tcb)
   p_tcb->SchedLockTimeMax = 0u;
 #endif
 
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+  p_tcb->ProfRdyTS = 0u;
+  p_tcb->ProfPendTS = 0u;
+  p_tcb->ProfPendOn = OS_TASK_PEND_ON_NOTHING;
+  p_tcb->ProfRdyValid = DEF_FALSE;
+  OS_TaskProfHistClr(p_tcb);
+#endif
+
   p_tcb->PendNextPtr = DEF_NULL;
   p_tcb->PendPrevPtr = DEF_NULL;
   p_tcb->PendObjPtr = DEF_NULL;
@@ -2377,6 +2745,183 @@ void OS_TaskChangePrio(OS_TCB  *p_tcb,
   } while (p_tcb != DEF_NULL);
 }
 
+/****************************************************************************************************//**
+ *                                           OS_TaskProfHistAdd()
+ *
+ * @brief    This function is called to add a duration to a task profiling histogram.
+ *
+ * @param    p_hist  Pointer to the histogram.
+ *
+ * @param    ts      Duration, in timestamp counts.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) The bin is given by the number of significant bits of the duration, once shifted by
+ *               OS_CFG_TASK_PROFILE_HIST_SHIFT (see 'TASK PROFILING HISTOGRAM Note #1').
+ *******************************************************************************************************/
+#if (OS_CFG_TASK_PROFILE_HIST_EN == DEF_ENABLED)
+void OS_TaskProfHistAdd(OS_PROF_HIST *p_hist,
+                        CPU_TS       ts)
+{
+  CPU_INT32U val;
+  CPU_DATA   bin;
+
+  val = (CPU_INT32U)ts >> OS_CFG_TASK_PROFILE_HIST_SHIFT;       // See Note #2.
+  if (val == 0u) {
+    bin = 0u;
+  } else {
+    bin = 32u - CPU_CntLeadZeros32(val);
+    if (bin > (OS_CFG_TASK_PROFILE_HIST_SIZE - 1u)) {
+      bin = OS_CFG_TASK_PROFILE_HIST_SIZE - 1u;
+    }
+  }
+
+  if (p_hist->BinTbl[bin] < DEF_INT_16U_MAX_VAL) {
+    p_hist->BinTbl[bin]++;
+  }
+  if (p_hist->Max < ts) {
+    p_hist->Max = ts;
+  }
+}
+
+/****************************************************************************************************//**
+ *                                           OS_TaskProfHistClr()
+ *
+ * @brief    This function is called to clear the profiling histograms of a task.
+ *
+ * @param    p_tcb   Pointer to the OS_TCB of the task.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *******************************************************************************************************/
+void OS_TaskProfHistClr(OS_TCB *p_tcb)
+{
+  Mem_Clr(&p_tcb->ProfRunHist, sizeof(p_tcb->ProfRunHist));
+  Mem_Clr(&p_tcb->ProfRdyHist, sizeof(p_tcb->ProfRdyHist));
+  Mem_Clr(&p_tcb->ProfPendHistTbl[0], sizeof(p_tcb->ProfPendHistTbl));
+}
+
+/****************************************************************************************************//**
+ *                                           OS_TaskProfHistSw()
+ *
+ * @brief    This function is called by OSSched() when a task is switched out and/or another task is
+ *           switched in, to update their profiling histograms.
+ *
+ * @param    p_tcb_out   Pointer to the OS_TCB of the task switched out, DEF_NULL if the CPU was idle.
+ *
+ * @param    p_tcb_in    Pointer to the OS_TCB of the task switched in, DEF_NULL if the CPU goes idle.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) This function MUST be called with interrupts disabled, before .CyclesStart is updated.
+ *
+ * @note     (3) A task switched out while still ready was preempted: its ready latency restarts.
+ *
+ * @note     (4) The time a task was blocked is measured from OS_Pend() to the moment it was made ready
+ *               (see OS_RdyListInsert()), so that it does not include its ready latency.
+ *******************************************************************************************************/
+void OS_TaskProfHistSw(OS_TCB *p_tcb_out,
+                       OS_TCB *p_tcb_in)
+{
+  CPU_TS ts;
+
+  ts = OS_TS_GET();
+
+  if (p_tcb_out != DEF_NULL) {
+    OS_TaskProfHistAdd(&p_tcb_out->ProfRunHist, OS_TMR_GET_DIFF(ts, p_tcb_out->CyclesStart));
+    if (p_tcb_out->TaskState == OS_TASK_STATE_RDY) {            // See Note #3.
+      p_tcb_out->ProfRdyTS = ts;
+      p_tcb_out->ProfRdyValid = DEF_TRUE;
+    }
+  }
+
+  if ((p_tcb_in != DEF_NULL)
+      && (p_tcb_in->ProfRdyValid == DEF_TRUE)) {
+    OS_TaskProfHistAdd(&p_tcb_in->ProfRdyHist, OS_TMR_GET_DIFF(ts, p_tcb_in->ProfRdyTS));
+    if (p_tcb_in->ProfPendOn != OS_TASK_PEND_ON_NOTHING) {      // See Note #4.
+      OS_TaskProfHistAdd(&p_tcb_in->ProfPendHistTbl[p_tcb_in->ProfPendOn],
+                         OS_TMR_GET_DIFF(p_tcb_in->ProfRdyTS, p_tcb_in->ProfPendTS));
+      p_tcb_in->ProfPendOn = OS_TASK_PEND_ON_NOTHING;
+    }
+    p_tcb_in->ProfRdyValid = DEF_FALSE;
+  }
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           OS_TaskStkChkIncr()
+ *
+ * @brief    Updates the stack watermark of a task and returns its number of free stack entries.
+ *
+ * @param    p_tcb   Pointer to the TCB of the task to check.
+ *
+ * @return   Number of free entries on the task's stack.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) Stack entries are indexed from the end of the stack the task grows towards, after the
+ *               redzone. 'StkChkFree' is the index of the watermark: the entries below it were still
+ *               free at the last check. As the stack only ever gets deeper, the watermark only moves
+ *               down, and the entries above it never need to be checked again.
+ *
+ * @note     (3) A stack growing by pushes writes the entries just below the watermark, so they are
+ *               checked first, going down until a free entry is found. The cost is proportional to the
+ *               growth since the last check.
+ *
+ * @note     (4) A frame may reserve entries without writing all of them, leaving free entries between
+ *               the watermark and deeper used entries. OS_CFG_TASK_STK_CHK_INCR_WIN free entries are
+ *               thus swept at each call, from the end of the stack up to the watermark, so that such
+ *               usage is found within a bounded number of calls.
+ *******************************************************************************************************/
+#if (OS_CFG_TASK_STK_CHK_INCR_EN == DEF_ENABLED)
+CPU_STK_SIZE OS_TaskStkChkIncr(OS_TCB *p_tcb)
+{
+  CPU_STK      *p_stk_end;
+  CPU_STK_SIZE free_stk;
+  CPU_STK_SIZE ix;
+  CPU_STK_SIZE ix_end;
+
+#if (CPU_CFG_STK_GROWTH == CPU_STK_GROWTH_HI_TO_LO)
+  p_stk_end = p_tcb->StkBasePtr;                                // Lowest memory is the end of the stack
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+  p_stk_end += OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#else
+  p_stk_end = p_tcb->StkBasePtr + p_tcb->StkSize - 1u;          // Highest memory is the end of the stack
+#if (OS_CFG_TASK_STK_REDZONE_EN == DEF_ENABLED)
+  p_stk_end -= OS_CFG_TASK_STK_REDZONE_DEPTH;
+#endif
+#endif
+
+  free_stk = p_tcb->StkChkFree;
+  while ((free_stk > 0u)                                        // Follow the growth below the watermark (Note #3).
+         && (OS_TASK_STK_CHK_ENTRY(p_stk_end, free_stk - 1u) != 0u)) {
+    free_stk--;
+  }
+
+  ix = p_tcb->StkChkSweepIx;                                    // Sweep a window of the free entries (Note #4).
+  ix_end = ix + OS_CFG_TASK_STK_CHK_INCR_WIN;
+  if ((ix_end > free_stk)
+      || (ix_end < ix)) {
+    ix_end = free_stk;
+  }
+  while ((ix < ix_end)
+         && (OS_TASK_STK_CHK_ENTRY(p_stk_end, ix) == 0u)) {
+    ix++;
+  }
+  if (ix < ix_end) {                                            // Used entry found below the watermark ...
+    free_stk = ix;                                              // ... it becomes the new watermark.
+    ix = 0u;
+  } else if (ix >= free_stk) {                                  // All free entries swept, restart.
+    ix = 0u;
+  }
+
+  p_tcb->StkChkFree = free_stk;
+  p_tcb->StkChkSweepIx = ix;
+
+  return (free_stk);
+}
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                   DEPENDENCIES & AVAIL CHECK(S) END
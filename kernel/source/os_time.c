@@ -149,16 +149,8 @@ void OSTimeDly(OS_TICK  dly,
   }
 
   if (delay_ticks > 0u) {
-    uint32_t delay;
-
     CORE_ENTER_ATOMIC();
-    delay = (uint64_t)(((uint64_t)delay_ticks * (uint64_t)sl_sleeptimer_get_timer_frequency()) + (OSCfg_TickRate_Hz - 1u)) / OSCfg_TickRate_Hz;
-    status = sl_sleeptimer_start_timer(&OSTCBCurPtr->TimerHandle,
-                                       delay,
-                                       OS_TimerCallback,
-                                       (void *)OSTCBCurPtr,
-                                       0u,
-                                       0u);
+    status = OS_TaskTimerStart(OSTCBCurPtr, delay_ticks);
     if (status != SL_STATUS_OK) {
       CORE_EXIT_ATOMIC();
       RTOS_ERR_SET(*p_err, RTOS_ERR_FAIL);
@@ -320,7 +312,7 @@ void OSTimeDlyResume(OS_TCB   *p_tcb,
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       p_tcb->TaskState = OS_TASK_STATE_RDY;
       OS_RdyListInsert(p_tcb);                                  // Add to ready list                                    */
-      status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+      status = OS_TaskTimerStop(p_tcb);
       RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
 #endif
       CORE_EXIT_ATOMIC();
@@ -329,7 +321,7 @@ void OSTimeDlyResume(OS_TCB   *p_tcb,
     case OS_TASK_STATE_DLY_SUSPENDED:
 #if (OS_CFG_TICK_EN == DEF_ENABLED)
       p_tcb->TaskState = OS_TASK_STATE_SUSPENDED;
-      status = sl_sleeptimer_stop_timer(&p_tcb->TimerHandle);
+      status = OS_TaskTimerStop(p_tcb);
       RTOS_ASSERT_CRITICAL((status == SL_STATUS_OK), RTOS_ERR_FAIL, ;);
 #endif
       CORE_EXIT_ATOMIC();
@@ -154,6 +154,9 @@ void OSTmrCreate(OS_TMR              *p_tmr,
 #endif
   p_tmr->Dly = dly;
   p_tmr->Remain = 0u;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  p_tmr->Match = 0u;
+#endif
   p_tmr->Period = period;
   p_tmr->Opt = opt;
   p_tmr->CallbackPtr = p_callback;
@@ -298,7 +301,11 @@ OS_TICK OSTmrRemainGet(OS_TMR   *p_tmr,
   remain = 0u;
   switch (p_tmr->State) {
     case OS_TMR_STATE_RUNNING:
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+      remain = p_tmr->Match - OSTmrTickCtr;                     // Timers in the wheel are not decremented every tick
+#else
       remain = p_tmr->Remain;
+#endif
       RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
       break;
 
@@ -437,7 +444,6 @@ void OSTmrSet(OS_TMR              *p_tmr,
 CPU_BOOLEAN OSTmrStart(OS_TMR   *p_tmr,
                        RTOS_ERR *p_err)
 {
-  OS_TMR      *p_next;
   CPU_BOOLEAN success;
 
   OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, DEF_FALSE);
@@ -458,40 +464,23 @@ CPU_BOOLEAN OSTmrStart(OS_TMR   *p_tmr,
   success = DEF_FALSE;
   switch (p_tmr->State) {
     case OS_TMR_STATE_RUNNING:                                  // Restart the timer
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+      OS_TmrUnlink(p_tmr);                                      // Timer must move to the spoke of its new expiration
+      OS_TmrLink(p_tmr, OS_OPT_LINK_DLY);
+#else
       if (p_tmr->Dly == 0u) {
         p_tmr->Remain = p_tmr->Period;
       } else {
         p_tmr->Remain = p_tmr->Dly;
       }
+#endif
       success = DEF_TRUE;
       RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
       break;
 
     case OS_TMR_STATE_STOPPED:                                  // Start the timer
     case OS_TMR_STATE_COMPLETED:
-      p_tmr->State = OS_TMR_STATE_RUNNING;
-      if (p_tmr->Dly == 0u) {
-        p_tmr->Remain = p_tmr->Period;
-      } else {
-        p_tmr->Remain = p_tmr->Dly;
-      }
-      if (OSTmrListPtr == DEF_NULL) {                           // Link into timer list
-        p_tmr->NextPtr = DEF_NULL;                              // This is the first timer in the list
-        p_tmr->PrevPtr = DEF_NULL;
-        OSTmrListPtr = p_tmr;
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-        OSTmrListEntries = 1u;
-#endif
-      } else {
-        p_next = OSTmrListPtr;                                  // Insert at the beginning of the list
-        p_tmr->NextPtr = OSTmrListPtr;
-        p_tmr->PrevPtr = DEF_NULL;
-        p_next->PrevPtr = p_tmr;
-        OSTmrListPtr = p_tmr;
-#if (OS_CFG_DBG_EN == DEF_ENABLED)
-        OSTmrListEntries++;
-#endif
-      }
+      OS_TmrLink(p_tmr, OS_OPT_LINK_DLY);                       // Link into timer list
       RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
       success = DEF_TRUE;
       break;
@@ -704,6 +693,9 @@ void OS_TmrClr(OS_TMR *p_tmr)
 #endif
   p_tmr->Dly = 0u;
   p_tmr->Remain = 0u;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  p_tmr->Match = 0u;
+#endif
   p_tmr->Period = 0u;
   p_tmr->Opt = 0u;
   p_tmr->CallbackPtr = DEF_NULL;
@@ -782,13 +774,28 @@ void OS_TmrDbgListRemove(OS_TMR *p_tmr)
  ********************************************************************************************************/
 void OS_TmrInit(RTOS_ERR *p_err)
 {
-  OS_RATE_HZ tick_rate;
+  OS_RATE_HZ   tick_rate;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  OS_TMR_SPOKE *p_spoke;
+  CPU_INT32U   i;
+#endif
 
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
   OSTmrDbgListPtr = DEF_NULL;
 #endif
 
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  for (i = 0u; i < OS_CFG_TMR_WHEEL_SIZE; i++) {                // Create an empty timer wheel
+    p_spoke = &OSTmrWheelTbl[i];
+    p_spoke->FirstPtr = DEF_NULL;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+    p_spoke->NbrEntries = 0u;
+    p_spoke->NbrEntriesMax = 0u;
+#endif
+  }
+#else
   OSTmrListPtr = DEF_NULL;                                      // Create an empty timer list
+#endif
 #if (OS_CFG_DBG_EN == DEF_ENABLED)
   OSTmrListEntries = 0u;
 #endif
@@ -836,6 +843,66 @@ void OS_TmrInit(RTOS_ERR *p_err)
                p_err);
 }
 
+/*****************************************************************************************************//**
+ *                                               OS_TmrLink()
+ *
+ * @brief    Called to insert the timer in the timer list, or in the spoke of the timer wheel that
+ *           matches its expiration time.
+ *
+ * @param    p_tmr   Pointer to the timer to insert.
+ *
+ * @param    opt     Determines the time remaining before the timer expires:
+ *                       - OS_OPT_LINK_DLY         Use the initial delay (or the period if there is none).
+ *                       - OS_OPT_LINK_PERIODIC    Use the period.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) Timers are always inserted at the beginning of the list or of the spoke, since the
+ *               spokes are not sorted. The timer task compares the expiration time of each timer of
+ *               the current spoke to the current time instead.
+ ********************************************************************************************************/
+void OS_TmrLink(OS_TMR *p_tmr,
+                OS_OPT opt)
+{
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  OS_TMR_SPOKE *p_spoke;
+#endif
+  OS_TMR       *p_next;
+
+  if ((opt == OS_OPT_LINK_PERIODIC)
+      || (p_tmr->Dly == 0u)) {
+    p_tmr->Remain = p_tmr->Period;
+  } else {
+    p_tmr->Remain = p_tmr->Dly;
+  }
+  p_tmr->State = OS_TMR_STATE_RUNNING;
+  p_tmr->PrevPtr = DEF_NULL;
+
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  p_tmr->Match = OSTmrTickCtr + p_tmr->Remain;                  // Hash the timer on its expiration time
+  p_spoke = &OSTmrWheelTbl[p_tmr->Match & (OS_CFG_TMR_WHEEL_SIZE - 1u)];
+  p_next = p_spoke->FirstPtr;
+  p_spoke->FirstPtr = p_tmr;
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  p_spoke->NbrEntries++;
+  if (p_spoke->NbrEntriesMax < p_spoke->NbrEntries) {
+    p_spoke->NbrEntriesMax = p_spoke->NbrEntries;
+  }
+#endif
+#else
+  p_next = OSTmrListPtr;                                        // Insert at the beginning of the list
+  OSTmrListPtr = p_tmr;
+#endif
+
+  p_tmr->NextPtr = p_next;
+  if (p_next != DEF_NULL) {
+    p_next->PrevPtr = p_tmr;
+  }
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  OSTmrListEntries++;
+#endif
+}
+
 /*****************************************************************************************************//**
  *                                               OS_TmrUnlink()
  *
@@ -849,7 +916,21 @@ void OS_TmrUnlink(OS_TMR *p_tmr)
 {
   OS_TMR *p_tmr1;
   OS_TMR *p_tmr2;
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+  OS_TMR_SPOKE *p_spoke;
 
+  p_spoke = &OSTmrWheelTbl[p_tmr->Match & (OS_CFG_TMR_WHEEL_SIZE - 1u)];
+#if (OS_CFG_DBG_EN == DEF_ENABLED)
+  p_spoke->NbrEntries--;
+#endif
+  if (p_spoke->FirstPtr == p_tmr) {                             // See if timer to remove is at the beginning of spoke
+    p_tmr1 = p_tmr->NextPtr;
+    p_spoke->FirstPtr = p_tmr1;
+    if (p_tmr1 != DEF_NULL) {
+      p_tmr1->PrevPtr = DEF_NULL;
+    }
+  } else {
+#else
   if (OSTmrListPtr == p_tmr) {                                  // See if timer to remove is at the beginning of list
     p_tmr1 = p_tmr->NextPtr;
     OSTmrListPtr = p_tmr1;
@@ -857,6 +938,7 @@ void OS_TmrUnlink(OS_TMR *p_tmr)
       p_tmr1->PrevPtr = DEF_NULL;
     }
   } else {
+#endif
     p_tmr1 = p_tmr->PrevPtr;                                    // Remove timer from somewhere in the list
     p_tmr2 = p_tmr->NextPtr;
     p_tmr1->NextPtr = p_tmr2;
@@ -902,6 +984,32 @@ void OS_TmrTask(void *p_arg)
     ts_start = OS_TS_GET();
 #endif
     OSTmrTickCtr++;                                             // Increment the current time
+#if (OS_CFG_TMR_WHEEL_EN == DEF_ENABLED)
+                                                                // Only visit the spoke of the current time
+    p_tmr = OSTmrWheelTbl[OSTmrTickCtr & (OS_CFG_TMR_WHEEL_SIZE - 1u)].FirstPtr;
+    while (p_tmr != DEF_NULL) {
+      OSSchedLock(&err);
+      (void)&err;
+      p_tmr_next = p_tmr->NextPtr;
+      if (p_tmr->Match == OSTmrTickCtr) {                       // Skip timers due on a later turn of the wheel
+        OS_TmrUnlink(p_tmr);                                    // Remove from spoke
+        if (p_tmr->Opt == OS_OPT_TMR_PERIODIC) {
+          OS_TmrLink(p_tmr, OS_OPT_LINK_PERIODIC);              // Re-hash on the next expiration time
+        } else {
+          p_tmr->State = OS_TMR_STATE_COMPLETED;                // Indicate that the timer has completed
+        }
+        OS_TRACE_TMR_EXPIRED(p_tmr);
+        p_fnct = p_tmr->CallbackPtr;                            // Execute callback function if available
+        if (p_fnct != 0u) {
+          (*p_fnct)((void *)p_tmr,
+                    p_tmr->CallbackPtrArg);
+        }
+      }
+      p_tmr = p_tmr_next;
+      OSSchedUnlock(&err);
+      (void)&err;
+    }
+#else
     p_tmr = OSTmrListPtr;
     while (p_tmr != DEF_NULL) {                                 // Update all the timers in the list
       OSSchedLock(&err);
@@ -915,6 +1023,7 @@ void OS_TmrTask(void *p_arg)
           OS_TmrUnlink(p_tmr);                                  // Remove from list
           p_tmr->State = OS_TMR_STATE_COMPLETED;                // Indicate that the timer has completed
         }
+        OS_TRACE_TMR_EXPIRED(p_tmr);
         p_fnct = p_tmr->CallbackPtr;                            // Execute callback function if available
         if (p_fnct != 0u) {
           (*p_fnct)((void *)p_tmr,
@@ -925,6 +1034,7 @@ void OS_TmrTask(void *p_arg)
       OSSchedUnlock(&err);
       (void)&err;
     }
+#endif
 
 #if (OS_CFG_TS_EN == DEF_ENABLED)
     ts_delta = OS_TS_GET() - ts_start;                          // Measure execution time of timer task
@@ -0,0 +1,238 @@
+/***************************************************************************//**
+ * @file
+ * @brief Kernel - Trace Ring Recorder
+ *******************************************************************************
+ * # License
+ * <b>Copyright 2018 Silicon Laboratories Inc. www.silabs.com</b>
+ *******************************************************************************
+ *
+ * The licensor of this software is Silicon Laboratories Inc.  Your use of this
+ * software is governed by the terms of Silicon Labs Master Software License
+ * Agreement (MSLA) available at
+ * www.silabs.com/about-us/legal/master-software-license-agreement.  This
+ * software is distributed to you in Source Code format and is governed by the
+ * sections of the MSLA applicable to Source Code.
+ *
+ ******************************************************************************/
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                       DEPENDENCIES & AVAIL CHECK(S)
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#include  <rtos_description.h>
+
+#if (defined(RTOS_MODULE_KERNEL_AVAIL))
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               INCLUDE FILES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#define  MICRIUM_SOURCE
+#include "../include/os.h"
+#include "os_priv.h"
+
+#include  <em_core.h>
+
+#ifdef VSC_INCLUDE_SOURCE_FILE_NAMES
+const CPU_CHAR *os_trace__c = "$Id: $";
+#endif
+
+#if (OS_CFG_TRACE_RING_EN == DEF_ENABLED)
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           GLOBAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                           OSTraceRingStart()
+ *
+ * @brief    Starts recording the kernel events in the trace ring.
+ *
+ * @note     (1) Recording is started by OSInit().
+ *******************************************************************************************************/
+void OSTraceRingStart(void)
+{
+  OSTraceRingEn = DEF_TRUE;
+}
+
+/****************************************************************************************************//**
+ *                                           OSTraceRingStop()
+ *
+ * @brief    Stops recording the kernel events in the trace ring. The records already in the ring are
+ *           kept and can still be read using OSTraceRingRd().
+ *******************************************************************************************************/
+void OSTraceRingStop(void)
+{
+  OSTraceRingEn = DEF_FALSE;
+}
+
+/****************************************************************************************************//**
+ *                                               OSTraceRingRd()
+ *
+ * @brief    Copies the oldest unread records of the trace ring to a buffer.
+ *
+ * @param    p_rec_tbl       Pointer to the buffer that will receive the records.
+ *
+ * @param    rec_nbr_max     Maximum number of records to copy to 'p_rec_tbl'.
+ *
+ * @param    p_err           Pointer to the variable that will receive one of the following error
+ *                           code(s) from this function:
+ *                               - RTOS_ERR_NONE
+ *
+ * @return   Number of records copied to 'p_rec_tbl', from the oldest to the most recent.
+ *
+ * @note     (1) Records that were overwritten before being read are lost. Their number is accumulated
+ *               in OSTraceRingLostCtr.
+ *
+ * @note     (2) A record that is being written by an ISR or a higher priority task while it is copied
+ *               is detected by its sequence number, read before & after the copy (see 'os.h  TRACE RING
+ *               RECORD  Note #2'). It is dropped & counted as lost. Stop the recorder with
+ *               OSTraceRingStop() to get a complete dump.
+ *******************************************************************************************************/
+CPU_INT32U OSTraceRingRd(OS_TRACE_REC *p_rec_tbl,
+                         CPU_INT32U   rec_nbr_max,
+                         RTOS_ERR     *p_err)
+{
+  OS_TRACE_REC *p_rec;
+  CPU_INT32U   wr_ix;
+  CPU_INT32U   rd_ix;
+  CPU_INT32U   rec_nbr;
+  CPU_INT32U   rec_cnt;
+  CPU_INT32U   seq;
+  CPU_INT32U   i;
+  CORE_DECLARE_IRQ_STATE;
+
+  OS_ASSERT_DBG_ERR_PTR_VALIDATE(p_err, 0u);
+
+  OS_ASSERT_DBG_ERR_SET((p_rec_tbl != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, 0u);
+
+  CORE_ENTER_ATOMIC();
+  wr_ix = OSTraceRingWrIx;
+  rd_ix = OSTraceRingRdIx;
+  if ((wr_ix - rd_ix) > OS_CFG_TRACE_RING_SIZE) {               // Skip the records that were overwritten
+    OSTraceRingLostCtr += (wr_ix - rd_ix) - OS_CFG_TRACE_RING_SIZE;
+    rd_ix = wr_ix - OS_CFG_TRACE_RING_SIZE;
+  }
+  rec_nbr = DEF_MIN(wr_ix - rd_ix, rec_nbr_max);
+  OSTraceRingRdIx = rd_ix + rec_nbr;
+  CORE_EXIT_ATOMIC();
+
+  rec_cnt = 0u;
+  for (i = 0u; i < rec_nbr; i++) {                              // See Note #2.
+    p_rec = &OSTraceRingTbl[(rd_ix + i) & (OS_CFG_TRACE_RING_SIZE - 1u)];
+    seq = rd_ix + i + 1u;
+    if (*(volatile CPU_INT32U *)&p_rec->Seq == seq) {
+      CPU_RMB();
+      p_rec_tbl[rec_cnt] = *p_rec;
+      CPU_RMB();
+      if (*(volatile CPU_INT32U *)&p_rec->Seq == seq) {
+        rec_cnt++;
+        continue;
+      }
+    }
+    CORE_ENTER_ATOMIC();
+    OSTraceRingLostCtr++;
+    CORE_EXIT_ATOMIC();
+  }
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+
+  return (rec_cnt);
+}
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           INTERNAL FUNCTIONS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+/****************************************************************************************************//**
+ *                                           OS_TraceRingInit()
+ *
+ * @brief    This function is called by OSInit() to empty the trace ring and start recording.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *******************************************************************************************************/
+void OS_TraceRingInit(void)
+{
+  CPU_INT32U i;
+
+  for (i = 0u; i < OS_CFG_TRACE_RING_SIZE; i++) {
+    OSTraceRingTbl[i].Seq = 0u;
+    OSTraceRingTbl[i].Ts = 0u;
+    OSTraceRingTbl[i].Evt = OS_TRACE_RING_EVT_NONE;
+    OSTraceRingTbl[i].Val = 0u;
+    OSTraceRingTbl[i].ObjPtr = DEF_NULL;
+    OSTraceRingTbl[i].TCBPtr = DEF_NULL;
+  }
+  OSTraceRingWrIx = 0u;
+  OSTraceRingRdIx = 0u;
+  OSTraceRingLostCtr = 0u;
+  OSTraceRingEn = DEF_TRUE;
+}
+
+/****************************************************************************************************//**
+ *                                           OS_TraceRingPut()
+ *
+ * @brief    This function is called by the trace event macros to record an event in the trace ring.
+ *
+ * @param    evt     Event type (see OS_TRACE_RING_EVT_xxx).
+ *
+ * @param    p_obj   Pointer to the kernel object or task the event relates to, if any.
+ *
+ * @param    val     Event specific value. Only the 16 least significant bits are recorded.
+ *
+ * @note     (1) This function is INTERNAL to the Kernel and your application MUST NOT call it.
+ *
+ * @note     (2) Interrupts are only disabled while the slot of the record is reserved, by incrementing
+ *               the free running write index. The record is then filled without any lock: an ISR or
+ *               another task recording an event in the meantime uses the next slot. When the ring is
+ *               full, the oldest records are overwritten.
+ *
+ * @note     (3) The record's sequence number is cleared first & set last, so that readers can tell a
+ *               complete record from one being written (see 'os.h  TRACE RING RECORD  Note #2').
+ *******************************************************************************************************/
+void OS_TraceRingPut(CPU_INT16U evt,
+                     void       *p_obj,
+                     CPU_INT32U val)
+{
+  OS_TRACE_REC *p_rec;
+  CPU_INT32U   ix;
+  CORE_DECLARE_IRQ_STATE;
+
+  if (OSTraceRingEn == DEF_FALSE) {
+    return;
+  }
+
+  CORE_ENTER_ATOMIC();                                          // Reserve a slot, see Note #2.
+  ix = OSTraceRingWrIx;
+  OSTraceRingWrIx = ix + 1u;
+  CORE_EXIT_ATOMIC();
+
+  p_rec = &OSTraceRingTbl[ix & (OS_CFG_TRACE_RING_SIZE - 1u)];
+  *(volatile CPU_INT32U *)&p_rec->Seq = 0u;                     // Invalidate the record, see Note #3.
+  CPU_WMB();
+  p_rec->Ts = OS_TS_GET();
+  p_rec->Evt = evt;
+  p_rec->Val = (CPU_INT16U)val;
+  p_rec->ObjPtr = p_obj;
+  p_rec->TCBPtr = OSTCBCurPtr;
+  CPU_WMB();
+  *(volatile CPU_INT32U *)&p_rec->Seq = ix + 1u;                // Validate the record.
+}
+
+#endif
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                   DEPENDENCIES & AVAIL CHECK(S) END
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#endif // (defined(RTOS_MODULE_KERNEL_AVAIL))
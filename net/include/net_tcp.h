@@ -30,8 +30,8 @@
  *                                                                          'The Communication of
  *                                                                            Urgent Information'
  *             - (c) The following TCP options NOT supported :
- *                 - (1) Window Scale                                      RFC #1072, Section 2
- *                                                                         RFC #1323, Section 2
+ *                 - (1) Window Scale, if NET_TCP_CFG_WIN_SCALE_EN         RFC #1072, Section 2
+ *                          is DEF_DISABLED                                RFC #7323, Section 2
  *                 - (2) Selective Acknowledgement (SACK)                  RFC #1072, Section 3
  *                                                                         RFC #2018
  *                                                                         RFC #2883
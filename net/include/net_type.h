@@ -195,9 +195,15 @@ typedef  CPU_INT16S NET_CONN_ID;
  *
  * Note(s) : (1) 'NET_TCP_WIN_SIZE' pre-defined in 'net_type.h' PRIOR to all other network modules that
  *                require TCP window size data type(s).
+ *
+ *           (2) 'NET_TCP_WIN_SIZE' holds the unscaled window size, which may exceed the 16-bit TCP header
+ *                window field when window scaling is negotiated (see 'net_tcp_priv.h  TCP WINDOW SIZE
+ *                DEFINES  Note #2'). The NET_SOCK_OPT_SOCK_TX_BUF_SIZE & NET_SOCK_OPT_SOCK_RX_BUF_SIZE
+ *                socket options still accept & return 16-bit values (see 'net_sock.c  NetSock_OptGet()
+ *                Note #3' & 'NetSock_OptSet() Note #4').
  *******************************************************************************************************/
-// See Note #1.
-typedef  CPU_INT16U NET_TCP_WIN_SIZE;
+// See Notes #1 & #2.
+typedef  CPU_INT32U NET_TCP_WIN_SIZE;
 
 /********************************************************************************************************
  *                                     TCP SEGMENT SIZE DATA TYPE
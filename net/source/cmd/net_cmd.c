@@ -46,6 +46,7 @@
 #include  <net/include/net_sock.h>
 #include  <net/include/net_app.h>
 #include  <net/include/net_icmp.h>
+#include  <net/include/net_util.h>
 
 #ifdef  NET_IF_ETHER_MODULE_EN
 #include  <net/include/net_if_ether.h>
@@ -58,6 +59,11 @@
 #include  <net/source/cmd/net_cmd_priv.h>
 #include  <net/source/cmd/net_cmd_output_priv.h>
 #include  <net/source/tcpip/net_if_priv.h>
+#include  <net/source/tcpip/net_priv.h>
+#include  <net/source/tcpip/net_sock_priv.h>
+#include  <net/source/tcpip/net_conn_priv.h>
+#include  <net/source/tcpip/net_task_priv.h>
+#include  <net/source/tcpip/net_util_priv.h>
 #include  <net/source/cmd/net_cmd_args_parser_priv.h>
 
 #ifdef  NET_IPv4_MODULE_EN
@@ -75,6 +81,7 @@
 #include  <common/include/lib_ascii.h>
 #include  <common/include/lib_str.h>
 #include  <common/include/lib_utils.h>
+#include  <common/source/lib/lib_str_priv.h>
 #include  <common/include/lib_mem.h>
 #include  <common/include/toolchains.h>
 #include  <common/include/rtos_err.h>
@@ -86,6 +93,84 @@
 #include  <net/include/net_stat.h>
 #include  <net/include/net_buf.h>
 
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                             LOCAL DEFINES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+#define  NET_CMD_CONN_BENCH_QTY_MAX                        64u
+#define  NET_CMD_CONN_BENCH_ROW_NBR                         7u  // Conn qty 1, 2, 4, ... up to NET_CMD_CONN_BENCH_QTY_MAX.
+#define  NET_CMD_CONN_BENCH_ITER_DFLT                     100u
+#define  NET_CMD_CONN_BENCH_ADDR_LOCAL             0xC6120001u  // 198.18.0.1, RFC 2544 benchmarking range.
+#define  NET_CMD_CONN_BENCH_ADDR_REMOTE            0xC6120101u  // 198.18.1.1.
+#define  NET_CMD_CONN_BENCH_PORT_LOCAL                      9u
+#define  NET_CMD_CONN_BENCH_PORT_REMOTE                 10000u
+
+#define  NET_CMD_CONN_BENCH_USAGE               "Usage: net_conn_bench [-n ITER]\r\n"                                   \
+                                                "    -n ITER   number of searches of each connection per measure\r\n" \
+                                                "Results are printed as CSV: conn_qty,ts_per_hit,ts_per_miss"
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+#define  NET_CMD_BENCH_VAL_NBR_MAX                          4u  // Max nbr of vals per CSV row.
+#define  NET_CMD_BENCH_LINE_LEN                  (NET_CMD_BENCH_VAL_NBR_MAX * (DEF_INT_32U_NBR_DIG_MAX + 1u))
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+#define  NET_CMD_BENCH_ADDR                        0x7F000001u  // 127.0.0.1.
+#define  NET_CMD_BENCH_TIMEOUT_MS                         100u  // Datagram sockets rx timeout.
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+#define  NET_CMD_RX_BENCH_PKTS_DFLT                     1000u
+#define  NET_CMD_RX_BENCH_BURST_DFLT                       8u
+#define  NET_CMD_RX_BENCH_DATA_LEN                        64u
+#define  NET_CMD_RX_BENCH_PORT                          10000u
+
+#define  NET_CMD_RX_BENCH_USAGE                 "Usage: net_rx_bench [-n PKTS] [-b BURST]\r\n"                            \
+                                                "    -n PKTS   number of datagrams sent over loopback per measure\r\n"   \
+                                                "    -b BURST  number of datagrams sent before receiving them\r\n"       \
+                                                "Results are printed as CSV: rx_budget,pkts_rx,pkts_per_sec"
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_TCP_MODULE_EN)       \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+#define  NET_CMD_TCP_BENCH_OCTETS_DFLT                1048576u
+#define  NET_CMD_TCP_BENCH_DLY_MS_DFLT                     10u
+#define  NET_CMD_TCP_BENCH_WIN_SIZE_DFLT               131072u
+#define  NET_CMD_TCP_BENCH_DATA_LEN                       512u
+#define  NET_CMD_TCP_BENCH_PORT                         10001u
+#define  NET_CMD_TCP_BENCH_IDLE_MAX                        10u
+
+#define  NET_CMD_TCP_BENCH_USAGE                "Usage: net_tcp_bench [-n OCTETS] [-d DLY_MS] [-w WIN]\r\n"             \
+                                                "    -n OCTETS  number of octets sent over loopback per measure\r\n"   \
+                                                "    -d DLY_MS  delay applied by the receiver before each read\r\n"    \
+                                                "    -w WIN     receive window size configured on the receiver\r\n"    \
+                                                "Results are printed as CSV: rx_win_size,dly_ms,octets_rx,octets_per_sec"
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+#define  NET_CMD_UDP_BENCH_PKTS_DFLT                    1000u
+#define  NET_CMD_UDP_BENCH_DATA_LEN_MAX                  512u
+#define  NET_CMD_UDP_BENCH_PORT                         10002u
+
+#define  NET_CMD_UDP_BENCH_USAGE                "Usage: net_udp_bench [-n PKTS]\r\n"                                   \
+                                                "    -n PKTS   number of datagrams sent over loopback per measure\r\n" \
+                                                "Results are printed as CSV: copy_unlocked,data_len,pkts_rx,pkts_per_sec"
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                            LOCAL TABLES
@@ -130,6 +215,26 @@ static SHELL_CMD NetCmdTbl[] =
   { "net_sock_opt_set_child", NetCmd_SockOptSetChild },
   { "net_sock_mcast_join", NetCmd_SockMcastJoin },
   { "net_sock_mcast_leave", NetCmd_SockMcastLeave },
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+  { "net_conn_bench", NetCmd_ConnBench },
+#endif
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+  { "net_rx_bench", NetCmd_RxBench },
+#endif
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_TCP_MODULE_EN)       \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+  { "net_tcp_bench", NetCmd_TCP_Bench },
+#endif
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+  { "net_udp_bench", NetCmd_UDP_Bench },
+#endif
   //                                                               {"net_sock_sel",     NetCmd_Sock_Sel},
   { 0, 0 }
 };
@@ -182,6 +287,27 @@ static CPU_INT16S NetCmd_Ping6(NET_IPv6_ADDR   *p_addr_remote,
                                SHELL_OUT_FNCT  out_fnct,
                                SHELL_CMD_PARAM *p_cmd_param);
 
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+static CPU_INT16S NetCmd_BenchOutputRow(const CPU_INT32U *p_val_tbl,
+                                        CPU_INT08U       val_nbr,
+                                        SHELL_OUT_FNCT   out_fnct,
+                                        SHELL_CMD_PARAM  *p_cmd_param);
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+static NET_SOCK_ID NetCmd_BenchSockOpen(NET_SOCK_TYPE sock_type,
+                                        NET_PORT_NBR  port,
+                                        NET_SOCK_ADDR *p_sock_addr,
+                                        RTOS_ERR      *p_err);
+
+static CPU_INT32U NetCmd_BenchRateGet(CPU_INT32U      ctr,
+                                      CPU_TS32        ts,
+                                      CPU_TS_TMR_FREQ ts_freq);
+#endif
+
 #if 0
 #ifdef  NET_IPv6_ADDR_AUTO_CFG_MODULE_EN
 static void NetCmd_IPv6AddrCfgResult(NET_IF_NBR               if_nbr,
@@ -2040,6 +2166,154 @@ exit: return;
 #endif
 #endif
 
+/****************************************************************************************************//**
+ *                                           NetCmd_BenchOutputRow()
+ *
+ * @brief    Outputs a row of benchmark results as CSV.
+ *
+ * @param    p_val_tbl       Pointer to the values of the row.
+ *
+ * @param    val_nbr         Number of values in the row (at most NET_CMD_BENCH_VAL_NBR_MAX).
+ *
+ * @param    out_fnct        is a callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     is a pointer to additional information to pass to the command.
+ *
+ * @return   The number of positive data octets transmitted, if NO errors
+ *
+ *           SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+ *
+ *           SHELL_OUT_ERR,                                  otherwise
+ *******************************************************************************************************/
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+static CPU_INT16S NetCmd_BenchOutputRow(const CPU_INT32U *p_val_tbl,
+                                        CPU_INT08U       val_nbr,
+                                        SHELL_OUT_FNCT   out_fnct,
+                                        SHELL_CMD_PARAM  *p_cmd_param)
+{
+  CPU_CHAR   line[NET_CMD_BENCH_LINE_LEN];
+  CPU_INT16U len;
+  CPU_INT08U ix;
+
+  line[0] = ASCII_CHAR_NULL;
+  len = 0u;
+  for (ix = 0u; ix < DEF_MIN(val_nbr, NET_CMD_BENCH_VAL_NBR_MAX); ix++) {
+    len += Str_Sprintf(&line[len], (ix == 0u) ? "%u" : ",%u", p_val_tbl[ix]);
+  }
+
+  return (NetCmd_OutputMsg(line, DEF_NO, DEF_YES, DEF_NO, out_fnct, p_cmd_param));
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           NetCmd_BenchSockOpen()
+ *
+ * @brief    Opens a benchmark socket bound to the loopback address.
+ *
+ * @param    sock_type       Type of socket to open :
+ *                               NET_SOCK_TYPE_DATAGRAM      UDP socket, with a receive timeout.
+ *                               NET_SOCK_TYPE_STREAM        TCP socket, listening for one connection.
+ *
+ * @param    port            Port to bind the socket to.
+ *
+ * @param    p_sock_addr     Pointer to a variable that will receive the address the socket is bound to.
+ *
+ * @param    p_err           Pointer to variable that will receive the return error code from this function.
+ *
+ * @return   Socket descriptor/handle identifier, if NO error(s).
+ *
+ *           NET_SOCK_ID_NONE,                    otherwise.
+ *******************************************************************************************************/
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+static NET_SOCK_ID NetCmd_BenchSockOpen(NET_SOCK_TYPE sock_type,
+                                        NET_PORT_NBR  port,
+                                        NET_SOCK_ADDR *p_sock_addr,
+                                        RTOS_ERR      *p_err)
+{
+  CPU_INT08U        addr[NET_IPv4_ADDR_SIZE];
+  NET_SOCK_PROTOCOL protocol;
+  NET_SOCK_ID       sock_id;
+  RTOS_ERR          local_err;
+
+  NET_UTIL_VAL_SET_NET_32(&addr[0], NET_CMD_BENCH_ADDR);
+
+  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+  NetApp_SetSockAddr(p_sock_addr,
+                     NET_SOCK_ADDR_FAMILY_IP_V4,
+                     port,
+                     &addr[0],
+                     NET_IPv4_ADDR_SIZE,
+                     p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (NET_SOCK_ID_NONE);
+  }
+
+  protocol = (sock_type == NET_SOCK_TYPE_STREAM) ? NET_SOCK_PROTOCOL_TCP : NET_SOCK_PROTOCOL_UDP;
+  sock_id = NetSock_Open(NET_SOCK_PROTOCOL_FAMILY_IP_V4,
+                         sock_type,
+                         protocol,
+                         p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return (NET_SOCK_ID_NONE);
+  }
+
+  (void)NetSock_Bind(sock_id, p_sock_addr, NET_SOCK_ADDR_SIZE, p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) == RTOS_ERR_NONE) {
+    switch (sock_type) {
+      case NET_SOCK_TYPE_DATAGRAM:
+        (void)NetSock_CfgTimeoutRxQ_Set(sock_id, NET_CMD_BENCH_TIMEOUT_MS, p_err);
+        break;
+
+#ifdef  NET_TCP_MODULE_EN
+      case NET_SOCK_TYPE_STREAM:
+        (void)NetSock_Listen(sock_id, 1u, p_err);
+        break;
+#endif
+
+      default:
+        RTOS_ERR_SET(*p_err, RTOS_ERR_INVALID_ARG);
+        break;
+    }
+  }
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    (void)NetSock_Close(sock_id, &local_err);
+    return (NET_SOCK_ID_NONE);
+  }
+
+  return (sock_id);
+}
+
+/****************************************************************************************************//**
+ *                                           NetCmd_BenchRateGet()
+ *
+ * @brief    Computes a benchmark rate, per second.
+ *
+ * @param    ctr         Number of items (datagrams or octets) handled.
+ *
+ * @param    ts          Number of timestamp counts taken to handle them.
+ *
+ * @param    ts_freq     Timestamp timer frequency.
+ *
+ * @return   Number of items per second, or 0 if no time elapsed.
+ *******************************************************************************************************/
+static CPU_INT32U NetCmd_BenchRateGet(CPU_INT32U      ctr,
+                                      CPU_TS32        ts,
+                                      CPU_TS_TMR_FREQ ts_freq)
+{
+  CPU_INT32U rate;
+
+  rate = 0u;
+  if (ts != 0u) {
+    rate = (CPU_INT32U)(((CPU_INT64U)ctr * ts_freq) / ts);
+  }
+
+  return (rate);
+}
+#endif
+
 /****************************************************************************************************//**
  *                                       NetCmd_IF_BufRxLargeStat()
  *
@@ -2244,6 +2518,688 @@ CPU_INT16S NetCmd_IF_BufTxSmallStat(CPU_INT16U      argc,
   return (ret_val);
 }
 
+/****************************************************************************************************//**
+ *                                           NetCmd_ConnBench()
+ *
+ * @brief    Measures network connection searches for increasing numbers of connections.
+ *
+ * @param    argc            is a count of the arguments supplied.
+ *
+ * @param    p_argv          an array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        is a callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     is a pointer to additional information to pass to the command.
+ *
+ * @return   The number of positive data octets transmitted, if NO errors
+ *
+ *           SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+ *
+ *           SHELL_OUT_ERR,                                  otherwise
+ *
+ * @note     (1) The connections are UDP connections from the same local address & port to different
+ *               remote ports, so that they all share a single connection chain.  Addresses are taken
+ *               from the benchmarking range, which is never configured on an interface.
+ *
+ * @note     (2) 'ts_per_hit'  is the average search time of each connection in turn.
+ *               'ts_per_miss' is the search time of a remote port with NO connection.
+ *
+ * @note     (3) The network lock is held while measuring. Interrupts are NOT disabled. The results are
+ *               output only once the lock is released, since the shell output path (e.g. Telnet) may
+ *               itself acquire the network lock.
+ *******************************************************************************************************/
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+CPU_INT16S NetCmd_ConnBench(CPU_INT16U      argc,
+                            CPU_CHAR        *p_argv[],
+                            SHELL_OUT_FNCT  out_fnct,
+                            SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_INT32U     val_tbl[3u];
+  CPU_INT08U     addr_local[NET_CONN_ADDR_LEN_MAX];
+  CPU_INT08U     addr_remote[NET_CONN_ADDR_LEN_MAX];
+  NET_CONN_ID    conn_id_tbl[NET_CMD_CONN_BENCH_QTY_MAX];
+  CPU_INT16U     row_conn_qty[NET_CMD_CONN_BENCH_ROW_NBR];
+  CPU_TS32       row_ts_hit[NET_CMD_CONN_BENCH_ROW_NBR];
+  CPU_TS32       row_ts_miss[NET_CMD_CONN_BENCH_ROW_NBR];
+  CPU_INT16U     row_nbr;
+  CPU_INT16U     row_ix;
+  NET_CONN_STATE conn_state;
+  CPU_INT32U     iter;
+  CPU_INT32U     i;
+  CPU_INT16U     conn_qty;
+  CPU_INT16U     conn_qty_measure;
+  CPU_INT16U     conn_ix;
+  CPU_TS32       ts_start;
+  CPU_TS32       ts_hit;
+  CPU_TS32       ts_miss;
+  CPU_INT16S     ret_val;
+  RTOS_ERR       local_err;
+
+  iter = NET_CMD_CONN_BENCH_ITER_DFLT;
+  if (argc == 3u) {
+    if (Str_Cmp(p_argv[1], "-n") == 0) {
+      iter = Str_ParseNbr_Int32U(p_argv[2], DEF_NULL, 10u);
+    } else {
+      iter = 0u;
+    }
+  } else if (argc != 1u) {
+    iter = 0u;
+  }
+
+  if (iter == 0u) {
+    ret_val = NetCmd_OutputMsg(NET_CMD_CONN_BENCH_USAGE,
+                               DEF_YES,
+                               DEF_YES,
+                               DEF_NO,
+                               out_fnct,
+                               p_cmd_param);
+    return (ret_val);
+  }
+
+  Mem_Clr(&addr_local[0], sizeof(addr_local));                  // See Note #1.
+  NET_UTIL_VAL_SET_NET_16(&addr_local[NET_CONN_ADDR_IP_IX_PORT], NET_CMD_CONN_BENCH_PORT_LOCAL);
+  NET_UTIL_VAL_SET_NET_32(&addr_local[NET_CONN_ADDR_IP_V4_IX_ADDR], NET_CMD_CONN_BENCH_ADDR_LOCAL);
+  Mem_Clr(&addr_remote[0], sizeof(addr_remote));
+  NET_UTIL_VAL_SET_NET_32(&addr_remote[NET_CONN_ADDR_IP_V4_IX_ADDR], NET_CMD_CONN_BENCH_ADDR_REMOTE);
+
+  ret_val = 0;
+  conn_qty = 0u;
+  conn_qty_measure = 1u;
+  row_nbr = 0u;
+
+  Net_GlobalLockAcquire((void *)NetCmd_ConnBench);
+
+  while ((conn_qty_measure <= NET_CMD_CONN_BENCH_QTY_MAX)
+         && (row_nbr < NET_CMD_CONN_BENCH_ROW_NBR)) {
+    //                                                             ------------ ADD CONNS UP TO MEASURE QTY -----------
+    while (conn_qty < conn_qty_measure) {
+      RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+      conn_id_tbl[conn_qty] = NetConn_Get(NET_CONN_FAMILY_IP_V4_SOCK,
+                                          NET_CONN_PROTOCOL_IX_IP_V4_UDP,
+                                          &local_err);
+      if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {      // Conn pool exhausted.
+        break;
+      }
+
+      NET_UTIL_VAL_SET_NET_16(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CMD_CONN_BENCH_PORT_REMOTE + conn_qty);
+      NetConn_AddrLocalSet(conn_id_tbl[conn_qty], NET_IF_NBR_NONE, &addr_local[0], NET_SOCK_ADDR_LEN_IP_V4, DEF_YES, &local_err);
+      NetConn_AddrRemoteSet(conn_id_tbl[conn_qty], &addr_remote[0], NET_SOCK_ADDR_LEN_IP_V4, DEF_YES, &local_err);
+      NetConn_ListAdd(conn_id_tbl[conn_qty]);
+      conn_qty++;
+    }
+
+    if (conn_qty < conn_qty_measure) {
+      break;
+    }
+
+    //                                                             ------------------ MEASURE SRCH'S ------------------
+    ts_start = CPU_TS_Get32();
+    for (i = 0u; i < iter; i++) {
+      for (conn_ix = 0u; conn_ix < conn_qty; conn_ix++) {
+        NET_UTIL_VAL_SET_NET_16(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CMD_CONN_BENCH_PORT_REMOTE + conn_ix);
+        (void)NetConn_Srch(NET_CONN_FAMILY_IP_V4_SOCK,
+                           NET_CONN_PROTOCOL_IX_IP_V4_UDP,
+                           &addr_local[0],
+                           &addr_remote[0],
+                           NET_SOCK_ADDR_LEN_IP_V4,
+                           DEF_NULL,
+                           DEF_NULL,
+                           &conn_state);
+      }
+    }
+    ts_hit = CPU_TS_Get32() - ts_start;
+
+    NET_UTIL_VAL_SET_NET_16(&addr_remote[NET_CONN_ADDR_IP_IX_PORT], NET_CMD_CONN_BENCH_PORT_REMOTE - 1u);
+    ts_start = CPU_TS_Get32();
+    for (i = 0u; i < iter; i++) {
+      (void)NetConn_Srch(NET_CONN_FAMILY_IP_V4_SOCK,
+                         NET_CONN_PROTOCOL_IX_IP_V4_UDP,
+                         &addr_local[0],
+                         &addr_remote[0],
+                         NET_SOCK_ADDR_LEN_IP_V4,
+                         DEF_NULL,
+                         DEF_NULL,
+                         &conn_state);
+    }
+    ts_miss = CPU_TS_Get32() - ts_start;
+
+    row_conn_qty[row_nbr] = conn_qty;                           // See Note #2.
+    row_ts_hit[row_nbr] = (ts_hit / iter) / conn_qty;
+    row_ts_miss[row_nbr] = ts_miss / iter;
+    row_nbr++;
+
+    conn_qty_measure *= 2u;
+  }
+
+  //                                                               ------------------- FREE CONNS --------------------
+  for (conn_ix = 0u; conn_ix < conn_qty; conn_ix++) {
+    NetConn_CloseFromApp(conn_id_tbl[conn_ix], DEF_NO);
+  }
+
+  Net_GlobalLockRelease();
+
+  //                                                               ------------------ OUTPUT RESULTS ------------------
+  for (row_ix = 0u; row_ix < row_nbr; row_ix++) {               // See Note #3.
+    val_tbl[0u] = row_conn_qty[row_ix];
+    val_tbl[1u] = row_ts_hit[row_ix];
+    val_tbl[2u] = row_ts_miss[row_ix];
+    ret_val = NetCmd_BenchOutputRow(&val_tbl[0], 3u, out_fnct, p_cmd_param);
+    if (ret_val == SHELL_EXEC_ERR) {
+      break;
+    }
+  }
+
+  return (ret_val);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           NetCmd_RxBench()
+ *
+ * @brief    Measures loopback UDP throughput with a single & with the configured Network Task rx budget.
+ *
+ * @param    argc            is a count of the arguments supplied.
+ *
+ * @param    p_argv          an array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        is a callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     is a pointer to additional information to pass to the command.
+ *
+ * @return   The number of positive data octets transmitted, if NO errors
+ *
+ *           SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+ *
+ *           SHELL_OUT_ERR,                                  otherwise
+ *
+ * @note     (1) Datagrams are sent to a socket bound to the loopback interface in bursts, then received
+ *               back.  Each burst queues one rx event per datagram; the Network Task handles them one per
+ *               wake-up with a budget of 1, & in batches with NET_TASK_CFG_RX_BUDGET.
+ *
+ * @note     (2) The Network Task handles a datagram as soon as it is sent if it preempts the calling
+ *               task.  Run the shell from a task of higher priority than the Network Task to measure the
+ *               batching gain.
+ *
+ * @note     (3) 'pkts_rx' may be lower than the number of datagrams sent if the loopback interface runs
+ *               out of buffers; use a smaller burst.  The configured budget is restored on exit.
+ *******************************************************************************************************/
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+CPU_INT16S NetCmd_RxBench(CPU_INT16U      argc,
+                          CPU_CHAR        *p_argv[],
+                          SHELL_OUT_FNCT  out_fnct,
+                          SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_INT32U        val_tbl[3u];
+  CPU_INT08U        data[NET_CMD_RX_BENCH_DATA_LEN];
+  NET_SOCK_ADDR     sock_addr;
+  NET_SOCK_ADDR     sock_addr_rx;
+  NET_SOCK_ADDR_LEN sock_addr_len;
+  NET_SOCK_ID       sock_id;
+  CPU_INT16U        budget_tbl[2u];
+  CPU_INT08U        budget_ix;
+  CPU_INT16U        arg_ix;
+  CPU_INT32U        pkt_qty;
+  CPU_INT32U        burst;
+  CPU_INT32U        burst_tx;
+  CPU_INT32U        tx_ctr;
+  CPU_INT32U        rx_ctr;
+  CPU_TS32          ts_start;
+  CPU_TS32          ts;
+  CPU_TS_TMR_FREQ   ts_freq;
+  CPU_INT16S        ret_val;
+  RTOS_ERR          local_err;
+
+  pkt_qty = NET_CMD_RX_BENCH_PKTS_DFLT;
+  burst = NET_CMD_RX_BENCH_BURST_DFLT;
+  for (arg_ix = 1u; arg_ix < argc; arg_ix += 2u) {
+    if (arg_ix + 1u >= argc) {
+      pkt_qty = 0u;
+    } else if (Str_Cmp(p_argv[arg_ix], "-n") == 0) {
+      pkt_qty = Str_ParseNbr_Int32U(p_argv[arg_ix + 1u], DEF_NULL, 10u);
+    } else if (Str_Cmp(p_argv[arg_ix], "-b") == 0) {
+      burst = Str_ParseNbr_Int32U(p_argv[arg_ix + 1u], DEF_NULL, 10u);
+    } else {
+      pkt_qty = 0u;
+    }
+  }
+
+  RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+  ts_freq = CPU_TS_TmrFreqGet(&local_err);
+
+  if ((pkt_qty == 0u)
+      || (burst == 0u)
+      || (ts_freq == 0u)) {
+    ret_val = NetCmd_OutputMsg(NET_CMD_RX_BENCH_USAGE,
+                               DEF_YES,
+                               DEF_YES,
+                               DEF_NO,
+                               out_fnct,
+                               p_cmd_param);
+    return (ret_val);
+  }
+
+  //                                                               --------------- OPEN LOOPBACK SOCKET ---------------
+  Mem_Clr(&data[0], sizeof(data));
+
+  sock_id = NetCmd_BenchSockOpen(NET_SOCK_TYPE_DATAGRAM, NET_CMD_RX_BENCH_PORT, &sock_addr, &local_err);
+  if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+    return (NetCmd_OutputError("Socket open failed", out_fnct, p_cmd_param));
+  }
+
+  budget_tbl[0u] = 1u;
+  budget_tbl[1u] = NET_TASK_CFG_RX_BUDGET;
+  ret_val = 0;
+
+  for (budget_ix = 0u; budget_ix < 2u; budget_ix++) {
+    NetTask_RxBudgetSet(budget_tbl[budget_ix]);
+
+    //                                                             ------------ TX & RX DATAGRAMS IN BURSTS -----------
+    tx_ctr = 0u;
+    rx_ctr = 0u;
+    ts_start = CPU_TS_Get32();
+    while (tx_ctr < pkt_qty) {
+      burst_tx = 0u;
+      while ((burst_tx < burst)
+             && (tx_ctr < pkt_qty)) {
+        RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+        (void)NetSock_TxDataTo(sock_id,
+                               &data[0],
+                               sizeof(data),
+                               NET_SOCK_FLAG_NONE,
+                               &sock_addr,
+                               NET_SOCK_ADDR_SIZE,
+                               &local_err);
+        tx_ctr++;
+        if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+          break;
+        }
+        burst_tx++;
+      }
+
+      while (burst_tx > 0u) {
+        RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+        sock_addr_len = sizeof(sock_addr_rx);
+        (void)NetSock_RxDataFrom(sock_id,
+                                 &data[0],
+                                 sizeof(data),
+                                 NET_SOCK_FLAG_NONE,
+                                 &sock_addr_rx,
+                                 &sock_addr_len,
+                                 DEF_NULL,
+                                 0u,
+                                 DEF_NULL,
+                                 &local_err);
+        if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+          break;
+        }
+        rx_ctr++;
+        burst_tx--;
+      }
+    }
+    ts = CPU_TS_Get32() - ts_start;
+
+    val_tbl[0u] = budget_tbl[budget_ix];
+    val_tbl[1u] = rx_ctr;
+    val_tbl[2u] = NetCmd_BenchRateGet(rx_ctr, ts, ts_freq);
+    ret_val = NetCmd_BenchOutputRow(&val_tbl[0], 3u, out_fnct, p_cmd_param);
+    if (ret_val == SHELL_EXEC_ERR) {
+      break;
+    }
+  }
+
+  NetTask_RxBudgetSet(NET_TASK_CFG_RX_BUDGET);                  // See Note #3.
+
+  (void)NetSock_Close(sock_id, &local_err);
+
+  return (ret_val);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           NetCmd_TCP_Bench()
+ *
+ * @brief    Measures loopback TCP throughput with a delayed receiver.
+ *
+ * @param    argc            is a count of the arguments supplied.
+ *
+ * @param    p_argv          an array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        is a callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     is a pointer to additional information to pass to the command.
+ *
+ * @return   The number of positive data octets transmitted, if NO errors
+ *
+ *           SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+ *
+ *           SHELL_OUT_ERR,                                  otherwise
+ *
+ * @note     (1) A connection is opened over the loopback interface & both of its sockets are serviced
+ *               from the calling task, in non-blocking mode.  Each round, the sender transmits until
+ *               its transmit queue is full, then the receiver waits for the delay before reading all
+ *               the data received.  At most one receive window is thus delivered per delay, emulating
+ *               a link with a bandwidth-delay product of the window size.
+ *
+ * @note     (2) The receive window size is configured on the connecting socket, before the connection
+ *               is requested, so that its window scale is chosen from it.  Windows larger than 65535
+ *               octets require NET_TCP_CFG_WIN_SCALE_EN; compare the throughput with '-w 65535'.
+ *
+ * @note     (3) The loopback interface must have enough receive buffers to hold a full window, or
+ *               the measured throughput is bounded by the buffers instead.
+ *******************************************************************************************************/
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_TCP_MODULE_EN)       \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+CPU_INT16S NetCmd_TCP_Bench(CPU_INT16U      argc,
+                            CPU_CHAR        *p_argv[],
+                            SHELL_OUT_FNCT  out_fnct,
+                            SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_INT32U        val_tbl[4u];
+  CPU_INT08U        data[NET_CMD_TCP_BENCH_DATA_LEN];
+  NET_SOCK_ADDR     sock_addr;
+  NET_SOCK_ADDR     sock_addr_remote;
+  NET_SOCK_ADDR_LEN sock_addr_len;
+  NET_SOCK_ID       sock_id_listen;
+  NET_SOCK_ID       sock_id_rx;
+  NET_SOCK_ID       sock_id_tx;
+  NET_SOCK_RTN_CODE len;
+  CPU_INT16U        arg_ix;
+  CPU_INT32U        octet_qty;
+  CPU_INT32U        dly_ms;
+  CPU_INT32U        win_size;
+  CPU_INT32U        tx_ctr;
+  CPU_INT32U        rx_ctr;
+  CPU_INT32U        rx_ctr_prev;
+  CPU_INT32U        idle_ctr;
+  CPU_TS32          ts_start;
+  CPU_TS32          ts;
+  CPU_TS_TMR_FREQ   ts_freq;
+  CPU_INT16S        ret_val;
+  RTOS_ERR          local_err;
+
+  octet_qty = NET_CMD_TCP_BENCH_OCTETS_DFLT;
+  dly_ms = NET_CMD_TCP_BENCH_DLY_MS_DFLT;
+  win_size = NET_CMD_TCP_BENCH_WIN_SIZE_DFLT;
+  for (arg_ix = 1u; arg_ix < argc; arg_ix += 2u) {
+    if (arg_ix + 1u >= argc) {
+      octet_qty = 0u;
+    } else if (Str_Cmp(p_argv[arg_ix], "-n") == 0) {
+      octet_qty = Str_ParseNbr_Int32U(p_argv[arg_ix + 1u], DEF_NULL, 10u);
+    } else if (Str_Cmp(p_argv[arg_ix], "-d") == 0) {
+      dly_ms = Str_ParseNbr_Int32U(p_argv[arg_ix + 1u], DEF_NULL, 10u);
+    } else if (Str_Cmp(p_argv[arg_ix], "-w") == 0) {
+      win_size = Str_ParseNbr_Int32U(p_argv[arg_ix + 1u], DEF_NULL, 10u);
+    } else {
+      octet_qty = 0u;
+    }
+  }
+
+  RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+  ts_freq = CPU_TS_TmrFreqGet(&local_err);
+
+  if ((octet_qty == 0u)
+      || (win_size == 0u)
+      || (ts_freq == 0u)) {
+    ret_val = NetCmd_OutputMsg(NET_CMD_TCP_BENCH_USAGE,
+                               DEF_YES,
+                               DEF_YES,
+                               DEF_NO,
+                               out_fnct,
+                               p_cmd_param);
+    return (ret_val);
+  }
+
+  //                                                               --------------- OPEN LOOPBACK SOCKETS --------------
+  Mem_Clr(&data[0], sizeof(data));
+
+  sock_id_tx = NET_SOCK_ID_NONE;
+  sock_id_rx = NET_SOCK_ID_NONE;
+  sock_id_listen = NetCmd_BenchSockOpen(NET_SOCK_TYPE_STREAM, NET_CMD_TCP_BENCH_PORT, &sock_addr, &local_err);
+  if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+    return (NetCmd_OutputError("Socket listen failed", out_fnct, p_cmd_param));
+  }
+
+  sock_id_rx = NetSock_Open(NET_SOCK_PROTOCOL_FAMILY_IP_V4,
+                            NET_SOCK_TYPE_STREAM,
+                            NET_SOCK_PROTOCOL_TCP,
+                            &local_err);
+  if (RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE) {
+    (void)NetSock_CfgRxQ_Size(sock_id_rx, (NET_SOCK_DATA_SIZE)win_size, &local_err);
+  }
+  if (RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE) {          // See Note #2.
+    (void)NetSock_Conn(sock_id_rx, &sock_addr, NET_SOCK_ADDR_SIZE, &local_err);
+  }
+  if (RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE) {
+    sock_addr_len = sizeof(sock_addr_remote);
+    sock_id_tx = NetSock_Accept(sock_id_listen, &sock_addr_remote, &sock_addr_len, &local_err);
+  }
+  if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+    ret_val = NetCmd_OutputError("Socket connect failed", out_fnct, p_cmd_param);
+    goto exit_close;
+  }
+
+  (void)NetSock_CfgBlock(sock_id_tx, NET_SOCK_BLOCK_SEL_NO_BLOCK, &local_err);
+  if (RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE) {
+    (void)NetSock_CfgBlock(sock_id_rx, NET_SOCK_BLOCK_SEL_NO_BLOCK, &local_err);
+  }
+  if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+    ret_val = NetCmd_OutputError("Socket cfg failed", out_fnct, p_cmd_param);
+    goto exit_close;
+  }
+
+  //                                                               ---------- TX & RX DATA WITH DELAYED READS ---------
+  tx_ctr = 0u;
+  rx_ctr = 0u;
+  idle_ctr = 0u;
+  ts_start = CPU_TS_Get32();
+  while ((rx_ctr < octet_qty)
+         && (idle_ctr < NET_CMD_TCP_BENCH_IDLE_MAX)) {
+    while (tx_ctr < octet_qty) {                                // See Note #1.
+      RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+      len = NetSock_TxData(sock_id_tx,
+                           &data[0],
+                           (CPU_INT16U)DEF_MIN(sizeof(data), octet_qty - tx_ctr),
+                           NET_SOCK_FLAG_NONE,
+                           &local_err);
+      if ((RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE)
+          || (len <= 0)) {
+        break;
+      }
+      tx_ctr += (CPU_INT32U)len;
+    }
+
+    KAL_Dly(dly_ms);
+
+    rx_ctr_prev = rx_ctr;
+    while (rx_ctr < octet_qty) {
+      RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+      len = NetSock_RxData(sock_id_rx,
+                           &data[0],
+                           sizeof(data),
+                           NET_SOCK_FLAG_NONE,
+                           &local_err);
+      if ((RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE)
+          || (len <= 0)) {
+        break;
+      }
+      rx_ctr += (CPU_INT32U)len;
+    }
+
+    if (rx_ctr == rx_ctr_prev) {                                // Abort if no data rx'd for several rounds.
+      idle_ctr++;
+    } else {
+      idle_ctr = 0u;
+    }
+  }
+  ts = CPU_TS_Get32() - ts_start;
+
+  val_tbl[0u] = win_size;
+  val_tbl[1u] = dly_ms;
+  val_tbl[2u] = rx_ctr;
+  val_tbl[3u] = NetCmd_BenchRateGet(rx_ctr, ts, ts_freq);
+  ret_val = NetCmd_BenchOutputRow(&val_tbl[0], 4u, out_fnct, p_cmd_param);
+
+exit_close:
+  if (sock_id_tx != NET_SOCK_ID_NONE) {
+    (void)NetSock_Close(sock_id_tx, &local_err);
+  }
+  if (sock_id_rx != NET_SOCK_ID_NONE) {
+    (void)NetSock_Close(sock_id_rx, &local_err);
+  }
+  (void)NetSock_Close(sock_id_listen, &local_err);
+
+  return (ret_val);
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                           NetCmd_UDP_Bench()
+ *
+ * @brief    Measures loopback UDP throughput for several datagram sizes.
+ *
+ * @param    argc            is a count of the arguments supplied.
+ *
+ * @param    p_argv          an array of pointers to the strings which are those arguments.
+ *
+ * @param    out_fnct        is a callback to a respond to the requester.
+ *
+ * @param    p_cmd_param     is a pointer to additional information to pass to the command.
+ *
+ * @return   The number of positive data octets transmitted, if NO errors
+ *
+ *           SHELL_OUT_RTN_CODE_CONN_CLOSED,                 if implemented connection closed
+ *
+ *           SHELL_OUT_ERR,                                  otherwise
+ *
+ * @note     (1) Each datagram is sent to a socket bound to the loopback interface, then received back,
+ *               so that each measure includes one datagram transmit & receive copy.
+ *
+ * @note     (2) Run this command once with NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN enabled & once with
+ *               it disabled to measure the cost of the extra lock release & acquire for each size (see
+ *               'net_sock_priv.h  NETWORK SOCKET DATAGRAM COPY DEFINES  Note #4'). Running it while
+ *               other tasks use the network shows the gain of releasing the lock during the copy.
+ *******************************************************************************************************/
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+CPU_INT16S NetCmd_UDP_Bench(CPU_INT16U      argc,
+                            CPU_CHAR        *p_argv[],
+                            SHELL_OUT_FNCT  out_fnct,
+                            SHELL_CMD_PARAM *p_cmd_param)
+{
+  CPU_INT32U        val_tbl[4u];
+  CPU_INT08U        data[NET_CMD_UDP_BENCH_DATA_LEN_MAX];
+  NET_SOCK_ADDR     sock_addr;
+  NET_SOCK_ADDR     sock_addr_rx;
+  NET_SOCK_ADDR_LEN sock_addr_len;
+  NET_SOCK_ID       sock_id;
+  CPU_INT16U        data_len_tbl[3u];
+  CPU_INT08U        data_len_ix;
+  CPU_INT32U        pkt_qty;
+  CPU_INT32U        tx_ctr;
+  CPU_INT32U        rx_ctr;
+  CPU_TS32          ts_start;
+  CPU_TS32          ts;
+  CPU_TS_TMR_FREQ   ts_freq;
+  CPU_INT16S        ret_val;
+  RTOS_ERR          local_err;
+
+  pkt_qty = NET_CMD_UDP_BENCH_PKTS_DFLT;
+  if (argc == 3u) {
+    if (Str_Cmp(p_argv[1u], "-n") == 0) {
+      pkt_qty = Str_ParseNbr_Int32U(p_argv[2u], DEF_NULL, 10u);
+    } else {
+      pkt_qty = 0u;
+    }
+  } else if (argc != 1u) {
+    pkt_qty = 0u;
+  }
+
+  RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+  ts_freq = CPU_TS_TmrFreqGet(&local_err);
+
+  if ((pkt_qty == 0u)
+      || (ts_freq == 0u)) {
+    ret_val = NetCmd_OutputMsg(NET_CMD_UDP_BENCH_USAGE,
+                               DEF_YES,
+                               DEF_YES,
+                               DEF_NO,
+                               out_fnct,
+                               p_cmd_param);
+    return (ret_val);
+  }
+
+  //                                                               --------------- OPEN LOOPBACK SOCKET ---------------
+  Mem_Clr(&data[0], sizeof(data));
+
+  sock_id = NetCmd_BenchSockOpen(NET_SOCK_TYPE_DATAGRAM, NET_CMD_UDP_BENCH_PORT, &sock_addr, &local_err);
+  if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+    return (NetCmd_OutputError("Socket open failed", out_fnct, p_cmd_param));
+  }
+
+  data_len_tbl[0u] = 32u;
+  data_len_tbl[1u] = 256u;
+  data_len_tbl[2u] = NET_CMD_UDP_BENCH_DATA_LEN_MAX;
+  ret_val = 0;
+
+  for (data_len_ix = 0u; data_len_ix < 3u; data_len_ix++) {
+    //                                                             ---------------- TX & RX DATAGRAMS -----------------
+    tx_ctr = 0u;
+    rx_ctr = 0u;
+    ts_start = CPU_TS_Get32();
+    while (tx_ctr < pkt_qty) {
+      RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+      (void)NetSock_TxDataTo(sock_id,
+                             &data[0],
+                             data_len_tbl[data_len_ix],
+                             NET_SOCK_FLAG_NONE,
+                             &sock_addr,
+                             NET_SOCK_ADDR_SIZE,
+                             &local_err);
+      tx_ctr++;
+      if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+        break;
+      }
+
+      sock_addr_len = sizeof(sock_addr_rx);
+      (void)NetSock_RxDataFrom(sock_id,
+                               &data[0],
+                               sizeof(data),
+                               NET_SOCK_FLAG_NONE,
+                               &sock_addr_rx,
+                               &sock_addr_len,
+                               DEF_NULL,
+                               0u,
+                               DEF_NULL,
+                               &local_err);
+      if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+        break;
+      }
+      rx_ctr++;
+    }
+    ts = CPU_TS_Get32() - ts_start;
+
+    val_tbl[0u] = (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED) ? 1u : 0u;
+    val_tbl[1u] = data_len_tbl[data_len_ix];
+    val_tbl[2u] = rx_ctr;
+    val_tbl[3u] = NetCmd_BenchRateGet(rx_ctr, ts, ts_freq);
+    ret_val = NetCmd_BenchOutputRow(&val_tbl[0], 4u, out_fnct, p_cmd_param);
+    if (ret_val == SHELL_EXEC_ERR) {
+      break;
+    }
+  }
+
+  (void)NetSock_Close(sock_id, &local_err);
+
+  return (ret_val);
+}
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                   DEPENDENCIES & AVAIL CHECK(S) END
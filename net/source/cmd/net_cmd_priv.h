@@ -503,6 +503,42 @@ CPU_INT16S NetCmd_IF_BufTxSmallStat(CPU_INT16U      argc,
                                     SHELL_OUT_FNCT  out_fnct,
                                     SHELL_CMD_PARAM *p_cmd_param);
 
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN))
+CPU_INT16S NetCmd_ConnBench(CPU_INT16U      argc,
+                            CPU_CHAR        *p_argv[],
+                            SHELL_OUT_FNCT  out_fnct,
+                            SHELL_CMD_PARAM *p_cmd_param);
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+CPU_INT16S NetCmd_RxBench(CPU_INT16U      argc,
+                          CPU_CHAR        *p_argv[],
+                          SHELL_OUT_FNCT  out_fnct,
+                          SHELL_CMD_PARAM *p_cmd_param);
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_TCP_MODULE_EN)       \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+CPU_INT16S NetCmd_TCP_Bench(CPU_INT16U      argc,
+                            CPU_CHAR        *p_argv[],
+                            SHELL_OUT_FNCT  out_fnct,
+                            SHELL_CMD_PARAM *p_cmd_param);
+#endif
+
+#if ((CPU_CFG_TS_32_EN == DEF_ENABLED) \
+  && defined(NET_IPv4_MODULE_EN)      \
+  && defined(NET_IF_LOOPBACK_MODULE_EN))
+CPU_INT16S NetCmd_UDP_Bench(CPU_INT16U      argc,
+                            CPU_CHAR        *p_argv[],
+                            SHELL_OUT_FNCT  out_fnct,
+                            SHELL_CMD_PARAM *p_cmd_param);
+#endif
+
 #ifdef  NET_IF_WIFI_MODULE_EN
 CPU_INT16S NetCmd_WiFi_Scan(CPU_INT16U      argc,
                             CPU_CHAR        *p_argv[],
@@ -519,8 +519,11 @@ CPU_BOOLEAN NetARP_CfgCacheTxQ_MaxTh(NET_BUF_QTY nbr_buf_max)
  * @return   DEF_OK,   ARP cache access promotion threshold configured.
  *           DEF_FAIL, otherwise.
  *
+ * @note     (1) ARP caches are promoted ONLY when NET_CACHE_CFG_HASH_TBL_SIZE is 0. Otherwise, ARP
+ *               caches are hashed & evicted least recently used first, and the threshold is NOT used.
+ *
  * @internal
- * @note     (1) [INTERNAL] 'NetARP_CacheAccessedTh_nbr' MUST ALWAYS be accessed exclusively in
+ * @note     (2) [INTERNAL] 'NetARP_CacheAccessedTh_nbr' MUST ALWAYS be accessed exclusively in
  *               critical sections.
  * @endinternal
  *******************************************************************************************************/
@@ -1160,6 +1163,10 @@ void NetARP_Init(RTOS_ERR *p_err)
   //                                                               ------------- INIT ARP CACHE LIST PTRS -------------
   NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_ARP] = DEF_NULL;
   NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_ARP] = DEF_NULL;
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  Mem_Clr(&NetCache_AddrHashTbl[NET_CACHE_ADDR_LIST_IX_ARP][0],
+          sizeof(NetCache_AddrHashTbl[NET_CACHE_ADDR_LIST_IX_ARP]));
+#endif
 }
 
 /****************************************************************************************************//**
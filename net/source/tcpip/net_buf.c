@@ -2288,6 +2288,7 @@ static void NetBuf_ClrHdr(NET_BUF_HDR *p_buf_hdr)
   p_buf_hdr->TCP_MaxSegSize = NET_TCP_MAX_SEG_SIZE_NONE;
   p_buf_hdr->TCP_WinSize = NET_TCP_WIN_SIZE_NONE;
   p_buf_hdr->TCP_WinSizeLast = NET_TCP_WIN_SIZE_NONE;
+  p_buf_hdr->TCP_WinScale = NET_TCP_WIN_SCALE_NONE;
   p_buf_hdr->TCP_RTT_TS_Rxd_ms = NET_TCP_TX_RTT_TS_NONE;
   p_buf_hdr->TCP_RTT_TS_Txd_ms = NET_TCP_TX_RTT_TS_NONE;
   p_buf_hdr->TCP_Flags = NET_TCP_FLAG_NONE;
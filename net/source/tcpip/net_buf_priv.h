@@ -481,6 +481,7 @@ typedef  struct  net_buf_hdr {
   NET_TCP_SEG_SIZE     TCP_MaxSegSize;                  // TCP max   seg size.
   NET_TCP_WIN_SIZE     TCP_WinSize;                     // TCP       win size.
   NET_TCP_WIN_SIZE     TCP_WinSizeLast;                 // TCP last  win size.
+  CPU_INT08U           TCP_WinScale;                    // TCP       win scale shift cnt.
 
   NET_TCP_TX_RTT_TS_MS TCP_RTT_TS_Rxd_ms;               // TCP RTT TS @ seg rx'd (in ms).
   NET_TCP_TX_RTT_TS_MS TCP_RTT_TS_Txd_ms;               // TCP RTT TS @ seg tx'd (in ms).
@@ -93,8 +93,22 @@ NET_STAT_POOL NetCache_AddrNDP_PoolStat;
 NET_CACHE_ADDR *NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_MAX];
 NET_CACHE_ADDR *NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_MAX];
 
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+NET_CACHE_ADDR *NetCache_AddrHashTbl[NET_CACHE_ADDR_LIST_IX_MAX][NET_CACHE_CFG_HASH_TBL_SIZE];
+#endif
+
 extern CPU_INT16U NetARP_CacheAccessedTh_nbr;
 
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                       LOCAL GLOBAL VARIABLES
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+static CPU_INT32U NetCache_AddrAccessSeq[NET_CACHE_ADDR_LIST_IX_MAX];  // Last access seq nbr of each Cache List.
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                       LOCAL FUNCTION PROTOTYPES
@@ -109,6 +123,26 @@ static void NetCache_AddrFree(NET_CACHE_ADDR *pcache,
 
 static void NetCache_Unlink(NET_CACHE_ADDR *pcache);
 
+static NET_CACHE_ADDR *NetCache_AddrEvictGet(CPU_INT08U list_ix);
+
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+static NET_CACHE_ADDR *NetCache_HashSrch(NET_CACHE_TYPE cache_type,
+                                         NET_IF_NBR     if_nbr,
+                                         CPU_INT08U     *p_addr_protocol);
+
+static CPU_INT16U NetCache_HashIxGet(NET_CACHE_TYPE cache_type,
+                                     NET_IF_NBR     if_nbr,
+                                     CPU_INT08U     *p_addr_protocol);
+
+static CPU_INT08U NetCache_HashListIxGet(NET_CACHE_TYPE cache_type);
+
+static CPU_INT08U *NetCache_HashAddrGet(NET_CACHE_ADDR *pcache);
+
+static void NetCache_HashInsert(NET_CACHE_ADDR *pcache);
+
+static void NetCache_HashRemove(NET_CACHE_ADDR *pcache);
+#endif
+
 static void NetCache_Clr(NET_CACHE_ADDR *pcache);
 
 /********************************************************************************************************
@@ -222,6 +256,10 @@ exit:
  *
  * @note     (1) 'NetARP_CacheAccessedTh_nbr' & 'NetNDP_CacheAccessedTh_nbr'  MUST ALWAYS be accessed
  *               exclusively in critical sections.
+ *
+ * @note     (2) Caches are promoted ONLY when the Cache Lists are searched linearly.  When caches are
+ *               hashed, the threshold is validated & stored but NOT used
+ *               (see 'net_cache_priv.h  NETWORK CACHE HASH TABLE DEFINES  Note #1').
  *******************************************************************************************************/
 CPU_BOOLEAN NetCache_CfgAccessedTh(NET_CACHE_TYPE cache_type,
                                    CPU_INT16U     nbr_access)
@@ -614,28 +652,39 @@ exit:
  *
  * @note     (3) The hardware address is returned in network-order; i.e. the pointer to the hardware
  *               address points to the highest-order octet.
+ *
+ * @note     (4) When caches are hashed, the search walks a single hash bucket & caches are NOT promoted
+ *               (see Note #1b3B).  Instead, a found cache records the list's next access sequence number
+ *               so that NetCache_AddrGet() can evict the least recently used cache.
  *******************************************************************************************************/
 NET_CACHE_ADDR *NetCache_AddrSrch(NET_CACHE_TYPE     cache_type,
                                   NET_IF_NBR         if_nbr,
                                   CPU_INT08U         *p_addr_protocol,
                                   NET_CACHE_ADDR_LEN addr_protocol_len)
 {
+  NET_CACHE_ADDR *p_cache = DEF_NULL;
+#if (NET_CACHE_CFG_HASH_TBL_SIZE == 0u)
 #ifdef  NET_ARP_MODULE_EN
   NET_CACHE_ADDR_ARP *p_cache_addr_arp = DEF_NULL;
 #endif
 #ifdef  NET_NDP_MODULE_EN
   NET_CACHE_ADDR_NDP *p_cache_addr_ndp = DEF_NULL;
 #endif
-  NET_CACHE_ADDR *p_cache = DEF_NULL;
   NET_CACHE_ADDR *p_cache_next = DEF_NULL;
   CPU_INT08U     *p_cache_addr = DEF_NULL;
   CPU_INT16U     th = 0;
   CPU_BOOLEAN    found = DEF_NO;
   CORE_DECLARE_IRQ_STATE;
+#endif
 
   PP_UNUSED_PARAM(addr_protocol_len);                           // Prevent 'variable unused' compiler warning.
   PP_UNUSED_PARAM(if_nbr);
 
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  p_cache = NetCache_HashSrch(cache_type,                       // Srch cache's hash bucket (see Note #4).
+                              if_nbr,
+                              p_addr_protocol);
+#else
   switch (cache_type) {
 #ifdef  NET_ARP_MODULE_EN
     case NET_CACHE_TYPE_ARP:
@@ -716,6 +765,32 @@ NET_CACHE_ADDR *NetCache_AddrSrch(NET_CACHE_TYPE     cache_type,
     default:
       RTOS_CRITICAL_FAIL_EXEC(RTOS_ERR_INVALID_TYPE, DEF_NULL);
   }
+#endif
+
+  switch (cache_type) {                                         // ---------------- UPDATE SRCH STATS -----------------
+#ifdef  NET_ARP_MODULE_EN
+    case NET_CACHE_TYPE_ARP:
+      if (p_cache != DEF_NULL) {
+        NET_CTR_STAT_INC(Net_StatCtrs.ARP.CacheSrchHitCtr);
+      } else {
+        NET_CTR_STAT_INC(Net_StatCtrs.ARP.CacheSrchMissCtr);
+      }
+      break;
+#endif
+
+#ifdef  NET_NDP_MODULE_EN
+    case NET_CACHE_TYPE_NDP:
+      if (p_cache != DEF_NULL) {
+        NET_CTR_STAT_INC(Net_StatCtrs.NDP.CacheSrchHitCtr);
+      } else {
+        NET_CTR_STAT_INC(Net_StatCtrs.NDP.CacheSrchMissCtr);
+      }
+      break;
+#endif
+
+    default:
+      break;
+  }
 
   return (p_cache);
 }
@@ -875,6 +950,10 @@ void NetCache_Insert(NET_CACHE_ADDR *p_cache)
     default:
       return;
   }
+
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  NetCache_HashInsert(p_cache);
+#endif
 }
 
 /****************************************************************************************************//**
@@ -1195,16 +1274,8 @@ static NET_CACHE_ADDR *NetCache_AddrGet(NET_CACHE_TYPE cache_type,
         p_cache_addr_arp = NetCache_AddrARP_PoolPtr;
         NetCache_AddrARP_PoolPtr = (NET_CACHE_ADDR_ARP *)p_cache_addr_arp->NextPtr;
       } else {                                                          // If ARP Cache List NOT empty, ...
-                                                                        // ... get ARP cache from list tail.
-        NET_CACHE_ADDR *p_entry = NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_ARP];
-
-        while (p_entry != DEF_NULL) {
-          if (p_entry->AddrHW_Valid == DEF_YES) {                       // Make sure to remove only a resolved entry.
-            break;
-          }
-
-          p_entry = p_entry->NextPtr;
-        }
+                                                                        // ... evict oldest resolved ARP cache.
+        NET_CACHE_ADDR *p_entry = NetCache_AddrEvictGet(NET_CACHE_ADDR_LIST_IX_ARP);
 
         if (p_entry == DEF_NULL) {
           NET_CTR_ERR_INC(Net_ErrCtrs.ARP.NoneAvailCtr);
@@ -1212,6 +1283,7 @@ static NET_CACHE_ADDR *NetCache_AddrGet(NET_CACHE_TYPE cache_type,
           goto exit;
         }
 
+        NET_CTR_STAT_INC(Net_StatCtrs.ARP.CacheEvictCtr);
         NetCache_Remove(p_entry, DEF_YES);
         p_entry = (NET_CACHE_ADDR *)NetCache_AddrARP_PoolPtr;
         NetCache_AddrARP_PoolPtr = (NET_CACHE_ADDR_ARP *)p_entry->NextPtr;
@@ -1240,17 +1312,9 @@ static NET_CACHE_ADDR *NetCache_AddrGet(NET_CACHE_TYPE cache_type,
                                                                         // ...  get cache from pool.
         p_cache_addr_ndp = NetCache_AddrNDP_PoolPtr;
         NetCache_AddrNDP_PoolPtr = (NET_CACHE_ADDR_NDP *)p_cache_addr_ndp->NextPtr;
-      } else {                                                          // If ARP Cache List NOT empty, ...
-                                                                        // ... get ARP cache from list tail.
-        NET_CACHE_ADDR *p_entry = NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_NDP];
-
-        while (p_entry != DEF_NULL) {
-          if (p_entry->AddrHW_Valid == DEF_YES) {                       // Make sure to remove only a resolved entry.
-            break;
-          }
-
-          p_entry = p_entry->NextPtr;
-        }
+      } else {                                                          // If NDP Cache List NOT empty, ...
+                                                                        // ... evict oldest resolved NDP cache.
+        NET_CACHE_ADDR *p_entry = NetCache_AddrEvictGet(NET_CACHE_ADDR_LIST_IX_NDP);
 
         if (p_entry == DEF_NULL) {
           NET_CTR_ERR_INC(Net_ErrCtrs.NDP.NoneAvailCtr);
@@ -1258,6 +1322,7 @@ static NET_CACHE_ADDR *NetCache_AddrGet(NET_CACHE_TYPE cache_type,
           goto exit;
         }
 
+        NET_CTR_STAT_INC(Net_StatCtrs.NDP.CacheEvictCtr);
         NetCache_Remove(p_entry, DEF_YES);
         p_cache_addr_ndp = NetCache_AddrNDP_PoolPtr;
         NetCache_AddrNDP_PoolPtr = (NET_CACHE_ADDR_NDP *)p_entry->NextPtr;
@@ -1512,8 +1577,340 @@ static void NetCache_Unlink(NET_CACHE_ADDR *p_cache)
     default:
       return;
   }
+
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  NetCache_HashRemove(p_cache);
+#endif
+}
+
+/****************************************************************************************************//**
+ *                                           NetCache_AddrEvictGet()
+ *
+ * @brief    Get the cache to evict from a Cache List when NO cache is available in the cache pool.
+ *
+ * @param    list_ix     Cache List index :
+ *                           - NET_CACHE_ADDR_LIST_IX_ARP     ARP          Cache List
+ *                           - NET_CACHE_ADDR_LIST_IX_NDP     NDP neighbor Cache List
+ *
+ * @return   Pointer to cache to evict, if any.
+ *           Pointer to NULL,           otherwise.
+ *
+ * @note     (1) ONLY resolved caches are evicted.  Caches pending resolution hold queued transmit
+ *               packet buffers.
+ *
+ * @note     (2) When caches are hashed, the resolved cache with the oldest access sequence number is the
+ *               least recently used cache.  Otherwise, the resolved cache closest to the Cache List tail
+ *               is evicted (see 'NetCache_AddrSrch()  Note #1b3B2b').
+ *******************************************************************************************************/
+static NET_CACHE_ADDR *NetCache_AddrEvictGet(CPU_INT08U list_ix)
+{
+  NET_CACHE_ADDR *p_cache;
+  NET_CACHE_ADDR *p_cache_evict;
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  CPU_INT32U age;
+  CPU_INT32U age_max;
+#endif
+
+  p_cache_evict = DEF_NULL;
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  age_max = 0u;
+#endif
+
+  p_cache = NetCache_AddrListTail[list_ix];
+  while (p_cache != DEF_NULL) {
+    if (p_cache->AddrHW_Valid == DEF_YES) {                     // See Note #1.
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+      //                                                           Seq nbrs wrap, cmp ages instead (see Note #2).
+      age = NetCache_AddrAccessSeq[list_ix] - p_cache->AccessSeq;
+      if ((p_cache_evict == DEF_NULL)
+          || (age > age_max)) {
+        p_cache_evict = p_cache;
+        age_max = age;
+      }
+#else
+      p_cache_evict = p_cache;
+      break;
+#endif
+    }
+
+    p_cache = p_cache->PrevPtr;
+  }
+
+  return (p_cache_evict);
+}
+
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+/****************************************************************************************************//**
+ *                                           NetCache_HashSrch()
+ *
+ * @brief    Search a Cache List's hash table for cache with specific protocol address.
+ *
+ * @param    cache_type          Cache type:
+ *                                   - NET_CACHE_TYPE_ARP     ARP          cache type
+ *                                   - NET_CACHE_TYPE_NDP     NDP neighbor cache type
+ *
+ * @param    if_nbr              Interface number of cache (NDP caches only).
+ *
+ * @param    p_addr_protocol     Pointer to protocol address, in network-order.
+ *
+ * @return   Pointer to cache with specific protocol address, if found.
+ *           Pointer to NULL, otherwise.
+ *
+ * @note     (1) A found cache records the Cache List's next access sequence number
+ *               (see 'net_cache_priv.h  NETWORK CACHE HASH TABLE DEFINES  Note #2').
+ *******************************************************************************************************/
+static NET_CACHE_ADDR *NetCache_HashSrch(NET_CACHE_TYPE cache_type,
+                                         NET_IF_NBR     if_nbr,
+                                         CPU_INT08U     *p_addr_protocol)
+{
+  NET_CACHE_ADDR *p_cache;
+  CPU_INT08U     list_ix = 0u;
+  CPU_INT16U     hash_ix;
+  CPU_SIZE_T     addr_len = 0u;
+  CPU_BOOLEAN    if_cmp = DEF_NO;
+  CPU_BOOLEAN    found;
+
+  switch (cache_type) {
+#ifdef  NET_ARP_MODULE_EN
+    case NET_CACHE_TYPE_ARP:                                    // ARP caches are NOT searched by IF.
+      list_ix = NET_CACHE_ADDR_LIST_IX_ARP;
+      addr_len = NET_IPv4_ADDR_SIZE;
+      if_cmp = DEF_NO;
+      break;
+#endif
+
+#ifdef  NET_NDP_MODULE_EN
+    case NET_CACHE_TYPE_NDP:
+      list_ix = NET_CACHE_ADDR_LIST_IX_NDP;
+      addr_len = NET_IPv6_ADDR_SIZE;
+      if_cmp = DEF_YES;
+      break;
+#endif
+
+    default:
+      RTOS_CRITICAL_FAIL_EXEC(RTOS_ERR_INVALID_TYPE, DEF_NULL);
+  }
+
+  hash_ix = NetCache_HashIxGet(cache_type, if_nbr, p_addr_protocol);
+  p_cache = NetCache_AddrHashTbl[list_ix][hash_ix];
+  found = DEF_NO;
+
+  while ((p_cache != DEF_NULL)                                  // Srch hash bucket ...
+         && (found == DEF_NO)) {                                // ... until cache found.
+    if ((p_cache->Type == cache_type)
+        && ((if_cmp == DEF_NO) || (p_cache->IF_Nbr == if_nbr))) {
+      found = Mem_Cmp(p_addr_protocol,
+                      NetCache_HashAddrGet(p_cache),
+                      addr_len);
+    }
+
+    if (found != DEF_YES) {
+      p_cache = p_cache->HashNextPtr;
+    }
+  }
+
+  if (p_cache != DEF_NULL) {
+    p_cache->AccessedCtr++;
+    NetCache_AddrAccessSeq[list_ix]++;                          // See Note #1.
+    p_cache->AccessSeq = NetCache_AddrAccessSeq[list_ix];
+  }
+
+  return (p_cache);
 }
 
+/****************************************************************************************************//**
+ *                                           NetCache_HashIxGet()
+ *
+ * @brief    Get the hash table index of a protocol address.
+ *
+ * @param    cache_type          Cache type:
+ *                                   - NET_CACHE_TYPE_ARP     ARP          cache type
+ *                                   - NET_CACHE_TYPE_NDP     NDP neighbor cache type
+ *
+ * @param    if_nbr              Interface number of cache (NDP caches only).
+ *
+ * @param    p_addr_protocol     Pointer to protocol address, in network-order.
+ *
+ * @return   Hash table index.
+ *
+ * @note     (1) Addresses are hashed with 32-bit FNV-1a, folded to the table size.  NDP caches are also
+ *               keyed on their interface number, since NetCache_AddrSrch() matches it.
+ *******************************************************************************************************/
+static CPU_INT16U NetCache_HashIxGet(NET_CACHE_TYPE cache_type,
+                                     NET_IF_NBR     if_nbr,
+                                     CPU_INT08U     *p_addr_protocol)
+{
+  CPU_INT32U hash;
+  CPU_SIZE_T addr_len;
+  CPU_SIZE_T ix;
+
+  PP_UNUSED_PARAM(if_nbr);                                      // Prevent 'variable unused' compiler warning.
+
+  hash = 2166136261u;                                           // See Note #1.
+
+  switch (cache_type) {
+#ifdef  NET_ARP_MODULE_EN
+    case NET_CACHE_TYPE_ARP:
+      addr_len = NET_IPv4_ADDR_SIZE;
+      break;
+#endif
+
+#ifdef  NET_NDP_MODULE_EN
+    case NET_CACHE_TYPE_NDP:
+      addr_len = NET_IPv6_ADDR_SIZE;
+      hash = (hash ^ (CPU_INT32U)if_nbr) * 16777619u;
+      break;
+#endif
+
+    default:
+      return (0u);
+  }
+
+  for (ix = 0u; ix < addr_len; ix++) {
+    hash = (hash ^ p_addr_protocol[ix]) * 16777619u;
+  }
+
+  hash ^= hash >> 16u;
+
+  return ((CPU_INT16U)(hash & (NET_CACHE_CFG_HASH_TBL_SIZE - 1u)));
+}
+
+/****************************************************************************************************//**
+ *                                           NetCache_HashListIxGet()
+ *
+ * @brief    Get the Cache List index of a cache type.
+ *
+ * @param    cache_type  Cache type:
+ *                           - NET_CACHE_TYPE_ARP     ARP          cache type
+ *                           - NET_CACHE_TYPE_NDP     NDP neighbor cache type
+ *
+ * @return   Cache List index.
+ *******************************************************************************************************/
+static CPU_INT08U NetCache_HashListIxGet(NET_CACHE_TYPE cache_type)
+{
+  CPU_INT08U list_ix = 0u;
+
+  switch (cache_type) {
+#ifdef  NET_ARP_MODULE_EN
+    case NET_CACHE_TYPE_ARP:
+      list_ix = NET_CACHE_ADDR_LIST_IX_ARP;
+      break;
+#endif
+
+#ifdef  NET_NDP_MODULE_EN
+    case NET_CACHE_TYPE_NDP:
+      list_ix = NET_CACHE_ADDR_LIST_IX_NDP;
+      break;
+#endif
+
+    default:
+      RTOS_CRITICAL_FAIL_EXEC(RTOS_ERR_INVALID_TYPE, 0u);
+  }
+
+  return (list_ix);
+}
+
+/****************************************************************************************************//**
+ *                                           NetCache_HashAddrGet()
+ *
+ * @brief    Get a cache's protocol address.
+ *
+ * @param    p_cache     Pointer to a cache.
+ *
+ * @return   Pointer to cache's protocol address.
+ *******************************************************************************************************/
+static CPU_INT08U *NetCache_HashAddrGet(NET_CACHE_ADDR *p_cache)
+{
+  CPU_INT08U *p_addr = DEF_NULL;
+
+  switch (p_cache->Type) {
+#ifdef  NET_ARP_MODULE_EN
+    case NET_CACHE_TYPE_ARP:
+      p_addr = &((NET_CACHE_ADDR_ARP *)p_cache)->AddrProtocol[0];
+      break;
+#endif
+
+#ifdef  NET_NDP_MODULE_EN
+    case NET_CACHE_TYPE_NDP:
+      p_addr = &((NET_CACHE_ADDR_NDP *)p_cache)->AddrProtocol[0];
+      break;
+#endif
+
+    default:
+      RTOS_CRITICAL_FAIL_EXEC(RTOS_ERR_INVALID_TYPE, DEF_NULL);
+  }
+
+  return (p_addr);
+}
+
+/****************************************************************************************************//**
+ *                                           NetCache_HashInsert()
+ *
+ * @brief    Insert a cache at the head of its hash table bucket.
+ *
+ * @param    p_cache     Pointer to a cache.
+ *
+ * @note     (1) A cache's protocol address & interface number MUST NOT change while it is inserted.
+ *
+ * @note     (2) An inserted cache counts as accessed, so that a new cache is NOT evicted before caches
+ *               that have NOT been searched since.
+ *******************************************************************************************************/
+static void NetCache_HashInsert(NET_CACHE_ADDR *p_cache)
+{
+  NET_CACHE_ADDR **p_bucket;
+  CPU_INT08U     list_ix;
+  CPU_INT16U     hash_ix;
+
+  list_ix = NetCache_HashListIxGet(p_cache->Type);
+  hash_ix = NetCache_HashIxGet(p_cache->Type,
+                               p_cache->IF_Nbr,
+                               NetCache_HashAddrGet(p_cache));
+  p_bucket = &NetCache_AddrHashTbl[list_ix][hash_ix];
+
+  p_cache->HashPrevPtr = DEF_NULL;
+  p_cache->HashNextPtr = *p_bucket;
+  if (*p_bucket != DEF_NULL) {
+    (*p_bucket)->HashPrevPtr = p_cache;
+  }
+  *p_bucket = p_cache;
+
+  NetCache_AddrAccessSeq[list_ix]++;                            // See Note #2.
+  p_cache->AccessSeq = NetCache_AddrAccessSeq[list_ix];
+}
+
+/****************************************************************************************************//**
+ *                                           NetCache_HashRemove()
+ *
+ * @brief    Remove a cache from its hash table bucket.
+ *
+ * @param    p_cache     Pointer to a cache.
+ *******************************************************************************************************/
+static void NetCache_HashRemove(NET_CACHE_ADDR *p_cache)
+{
+  NET_CACHE_ADDR **p_bucket;
+  CPU_INT16U     hash_ix;
+
+  if (p_cache->HashPrevPtr != DEF_NULL) {
+    p_cache->HashPrevPtr->HashNextPtr = p_cache->HashNextPtr;
+  } else {
+    hash_ix = NetCache_HashIxGet(p_cache->Type,
+                                 p_cache->IF_Nbr,
+                                 NetCache_HashAddrGet(p_cache));
+    p_bucket = &NetCache_AddrHashTbl[NetCache_HashListIxGet(p_cache->Type)][hash_ix];
+    if (*p_bucket == p_cache) {
+      *p_bucket = p_cache->HashNextPtr;
+    }
+  }
+
+  if (p_cache->HashNextPtr != DEF_NULL) {
+    p_cache->HashNextPtr->HashPrevPtr = p_cache->HashPrevPtr;
+  }
+
+  p_cache->HashPrevPtr = DEF_NULL;
+  p_cache->HashNextPtr = DEF_NULL;
+}
+#endif
+
 /****************************************************************************************************//**
  *                                               NetCache_Clr()
  *
@@ -1538,6 +1935,11 @@ static void NetCache_Clr(NET_CACHE_ADDR *p_cache)
   p_cache->IF_Nbr = NET_IF_NBR_NONE;
   p_cache->AccessedCtr = 0u;
   p_cache->Flags = NET_CACHE_FLAG_NONE;
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  p_cache->HashPrevPtr = DEF_NULL;
+  p_cache->HashNextPtr = DEF_NULL;
+  p_cache->AccessSeq = 0u;
+#endif
 
   p_cache->AddrHW_Valid = DEF_NO;
   p_cache->AddrProtocolValid = DEF_NO;
@@ -59,6 +59,24 @@
 
 #define  NET_CACHE_ADDR_LIST_IX_MAX                        2u
 
+/********************************************************************************************************
+ *                                   NETWORK CACHE HASH TABLE DEFINES
+ *
+ * Note(s) : (1) Caches in each Cache List are also indexed in a hash table keyed on their protocol
+ *               address, and on their interface number for NDP.  NetCache_AddrSrch() then walks a single
+ *               hash bucket instead of the Cache List, & accessed caches are NOT promoted in the list.
+ *
+ *           (2) Instead, each cache records the access sequence number of its last successful search.
+ *               When no cache is free, the resolved cache with the oldest access is evicted.
+ *
+ *           (3) NET_CACHE_CFG_HASH_TBL_SIZE MUST be a power of 2.  Set to 0 to search the Cache Lists
+ *               linearly & promote caches after 'NetCache_CfgAccessedTh()' accesses.
+ *******************************************************************************************************/
+
+#ifndef  NET_CACHE_CFG_HASH_TBL_SIZE
+#define  NET_CACHE_CFG_HASH_TBL_SIZE                      16u   // See Note #3.
+#endif
+
 /********************************************************************************************************
  *                                       NETWORK CACHE FLAG DEFINES
  *******************************************************************************************************/
@@ -142,6 +160,12 @@ struct  net_cache_addr {
 
   CPU_INT16U          Flags;                                            // Cache flags.
 
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  NET_CACHE_ADDR      *HashPrevPtr;                                     // Ptr to PREV addr cache in hash bucket.
+  NET_CACHE_ADDR      *HashNextPtr;                                     // Ptr to NEXT addr cache in hash bucket.
+  CPU_INT32U          AccessSeq;                                        // Seq nbr of last srch hit.
+#endif
+
   NET_CACHE_ADDR_TYPE AddrHW_Type;                                      // Remote hw       type     (see Note #2).
   CPU_INT08U          AddrHW_Len;                                       // Remote hw       addr len (see Note #2).
   CPU_BOOLEAN         AddrHW_Valid;                                     // Remote hw       addr        valid flag.
@@ -174,6 +198,12 @@ struct  net_cache_addr_arp {
 
   CPU_INT16U          Flags;                                            // Cache flags.
 
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  NET_CACHE_ADDR      *HashPrevPtr;                                     // Ptr to PREV addr cache in hash bucket.
+  NET_CACHE_ADDR      *HashNextPtr;                                     // Ptr to NEXT addr cache in hash bucket.
+  CPU_INT32U          AccessSeq;                                        // Seq nbr of last srch hit.
+#endif
+
   NET_CACHE_ADDR_TYPE AddrHW_Type;                                      // Remote hw       type     (see Note #2).
   CPU_INT08U          AddrHW_Len;                                       // Remote hw       addr len (see Note #2).
   CPU_BOOLEAN         AddrHW_Valid;                                     // Remote hw       addr        valid flag.
@@ -215,6 +245,12 @@ struct  net_cache_addr_ndp {
 
   CPU_INT16U          Flags;                                            // Cache flags.
 
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  NET_CACHE_ADDR      *HashPrevPtr;                                     // Ptr to PREV addr cache in hash bucket.
+  NET_CACHE_ADDR      *HashNextPtr;                                     // Ptr to NEXT addr cache in hash bucket.
+  CPU_INT32U          AccessSeq;                                        // Seq nbr of last srch hit.
+#endif
+
   NET_CACHE_ADDR_TYPE AddrHW_Type;                                      // Remote hw       type     (see Note #2).
   CPU_INT08U          AddrHW_Len;                                       // Remote hw       addr len (see Note #2).
   CPU_BOOLEAN         AddrHW_Valid;                                     // Remote hw       addr        valid flag.
@@ -261,6 +297,10 @@ extern NET_STAT_POOL NetCache_AddrNDP_PoolStat;
 extern NET_CACHE_ADDR *NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_MAX];
 extern NET_CACHE_ADDR *NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_MAX];
 
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+extern NET_CACHE_ADDR *NetCache_AddrHashTbl[NET_CACHE_ADDR_LIST_IX_MAX][NET_CACHE_CFG_HASH_TBL_SIZE];
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           FUNCTION PROTOTYPES
@@ -313,6 +353,18 @@ void NetCache_TxPktHandler(NET_PROTOCOL_TYPE proto_type,
                            NET_BUF           *p_buf_q,
                            CPU_INT08U        *p_addr_hw);
 
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           CONFIGURATION ERRORS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if    ((NET_CACHE_CFG_HASH_TBL_SIZE > 0u) \
+  && ((NET_CACHE_CFG_HASH_TBL_SIZE & (NET_CACHE_CFG_HASH_TBL_SIZE - 1u)) != 0u))
+#error  "NET_CACHE_CFG_HASH_TBL_SIZE  illegally #define'd in 'net_cfg.h'"
+#error  "                            [MUST be  a power of 2, or 0]     "
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               MODULE END
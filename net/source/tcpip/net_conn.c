@@ -63,12 +63,31 @@ static NET_CONN *NetConn_ListSrch(NET_CONN_FAMILY family,
                                   NET_CONN        **p_conn_list,
                                   CPU_INT08U      *p_addr_local);
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE == 0u)
 static NET_CONN *NetConn_ChainSrch(NET_CONN       **p_conn_list,
                                    NET_CONN       *p_conn_chain,
                                    CPU_INT08U     *p_addr_local,
                                    CPU_INT08U     *p_addr_wildcard,
                                    CPU_INT08U     *p_addr_remote,
                                    NET_CONN_STATE *p_conn_state);
+#else
+static NET_CONN *NetConn_HashSrch(NET_CONN_FAMILY      family,
+                                  NET_CONN_PROTOCOL_IX protocol_ix,
+                                  CPU_INT08U           *p_addr_local,
+                                  CPU_INT08U           *p_addr_remote,
+                                  CPU_SIZE_T           addr_len);
+
+static CPU_INT16U NetConn_HashIxGet(NET_CONN_PROTOCOL_IX protocol_ix,
+                                    CPU_INT08U           *p_addr_local,
+                                    CPU_INT08U           *p_addr_remote,
+                                    CPU_SIZE_T           addr_len);
+
+static void NetConn_HashInsert(NET_CONN *p_conn);
+
+static void NetConn_HashRemove(NET_CONN *p_conn);
+
+static CPU_SIZE_T NetConn_AddrLenGet(NET_CONN_FAMILY family);
+#endif
 
 static void NetConn_ChainInsert(NET_CONN **p_conn_list,
                                 NET_CONN *p_conn_chain);
@@ -118,6 +137,10 @@ NET_STAT_POOL NetConn_PoolStat;
 //                                                                 Array of ptrs to net conn lists.
 NET_CONN *NetConn_ConnListHead[NET_CONN_PROTOCOL_NBR_MAX];
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)                               // Hash tbl of listed net conns.
+NET_CONN **NetConn_HashTbl;
+#endif
+
 NET_CONN *NetConn_ConnListChainPtr;                                 // Ptr to cur  conn list chain to update.
 NET_CONN *NetConn_ConnListConnPtr;                                  // Ptr to cur  conn list conn  to update.
 NET_CONN *NetConn_ConnListNextChainPtr;                             // Ptr to next conn list chain to update.
@@ -250,7 +273,7 @@ void NetConn_PoolStatResetMaxUsed(void)
  * @brief    (1) Initialize Network Connection Management Module :
  *               - (a) Initialize network connection pool
  *               - (b) Initialize network connection table
- *               - (c) Initialize network connection lists
+ *               - (c) Initialize network connection lists & hash table
  *               - (d) Initialize network connection wildcard address(s)
  *
  * @note     (2) Network connection pool MUST be initialized PRIOR to initializing the pool with
@@ -278,6 +301,16 @@ void NetConn_Init(MEM_SEG  *p_mem_seg,
     return;
   }
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  NetConn_HashTbl = (NET_CONN **)Mem_SegAlloc("Net Connection hash table",
+                                              p_mem_seg,
+                                              sizeof(NET_CONN *) * NET_CONN_CFG_HASH_TBL_SIZE,
+                                              p_err);
+  if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+    return;
+  }
+#endif
+
   //                                                               ------------- INIT NET CONN POOL/STATS -------------
   NetConn_PoolPtr = DEF_NULL;                                   // Init-clr net conn pool (see Note #2).
 
@@ -309,6 +342,12 @@ void NetConn_Init(MEM_SEG  *p_mem_seg,
     p_conn_list++;
   }
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)                           // Init net conn hash tbl.
+  for (i = 0u; i < NET_CONN_CFG_HASH_TBL_SIZE; i++) {
+    NetConn_HashTbl[i] = DEF_NULL;
+  }
+#endif
+
   //                                                               Init net conn list ptrs.
   NetConn_ConnListChainPtr = DEF_NULL;
   NetConn_ConnListConnPtr = DEF_NULL;
@@ -1169,6 +1208,12 @@ void NetConn_AddrLocalSet(NET_CONN_ID       conn_id,
   }
 
   //                                                               ------------ SET NET CONN'S LOCAL ADDR -------------
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  if (p_conn->ConnList != DEF_NULL) {                           // If conn listed, re-hash on new addr.
+    NetConn_HashRemove(p_conn);
+  }
+#endif
+
   Mem_Clr(&p_conn->AddrLocal[0],
           NET_CONN_ADDR_LEN_MAX);
 
@@ -1179,6 +1224,12 @@ void NetConn_AddrLocalSet(NET_CONN_ID       conn_id,
   p_conn->AddrLocalValid = DEF_YES;
   p_conn->IF_Nbr = if_nbr;                                      // Set IF nbr.
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  if (p_conn->ConnList != DEF_NULL) {
+    NetConn_HashInsert(p_conn);
+  }
+#endif
+
   PP_UNUSED_PARAM(addr_len);
 
 exit:
@@ -1296,12 +1347,24 @@ void NetConn_AddrRemoteSet(NET_CONN_ID       conn_id,
   }
 
   //                                                               ------------ GET NET CONN'S REMOTE ADDR ------------
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  if (p_conn->ConnList != DEF_NULL) {                           // If conn listed, re-hash on new addr.
+    NetConn_HashRemove(p_conn);
+  }
+#endif
+
   NET_UTIL_VAL_COPY(&p_conn->AddrRemote[0],                     // Copy remote addr to net conn addr.
                     p_addr_remote,
                     NET_CONN_ADDR_LEN_MAX);
 
   p_conn->AddrRemoteValid = DEF_YES;
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  if (p_conn->ConnList != DEF_NULL) {
+    NetConn_HashInsert(p_conn);
+  }
+#endif
+
   PP_UNUSED_PARAM(addr_len);
 
 exit:
@@ -1847,6 +1910,9 @@ exit:
  *               - (a) Get    network connection list  head pointer
  *               - (b) Search network connection list  for best-match  network connection chain
  *               - (c) Search network connection chain for best-match  network connection
+ *                     OR
+ *                     Search network connection hash table for best-match network connection
+ *                     (see Note #5)
  *               - (d) Return network connection handle identifier, if network connection     found
  *                     OR
  *                     Null identifier,                             if network connection NOT found
@@ -1957,6 +2023,16 @@ exit:
  *
  * @note     (4) Pointers to variables that return values MUST be initialized PRIOR to all other
  *               validation or function handling in case of any error(s).
+ *
+ * @note     (5) When NET_CONN_CFG_HASH_TBL_SIZE is not 0, the connection chain is not walked.  Instead,
+ *               the hash table is looked up for each connection state, in the order of Note #2b2,
+ *               until a connection is found :
+ *               - (a) Local          address & remote address     NET_CONN_STATE_FULL
+ *               - (b) Local wildcard address & remote address     NET_CONN_STATE_FULL_WILDCARD
+ *               - (c) Local          address & NO remote address  NET_CONN_STATE_HALF
+ *               - (d) Local wildcard address & NO remote address  NET_CONN_STATE_HALF_WILDCARD
+ *
+ *               Wildcard lookups are skipped when the local address is itself the wildcard address.
  *******************************************************************************************************/
 NET_CONN_ID NetConn_Srch(NET_CONN_FAMILY      family,
                          NET_CONN_PROTOCOL_IX protocol_ix,
@@ -1967,8 +2043,13 @@ NET_CONN_ID NetConn_Srch(NET_CONN_FAMILY      family,
                          NET_CONN_ID          *p_conn_id_app,
                          NET_CONN_STATE       *p_conn_state)
 {
+#if (NET_CONN_CFG_HASH_TBL_SIZE == 0u)
   NET_CONN    **p_conn_list;
   NET_CONN    *p_conn_chain;
+#else
+  CPU_SIZE_T  addr_len_srch;
+  CPU_BOOLEAN addr_local_wildcard;
+#endif
   NET_CONN    *p_conn;
   NET_CONN_ID conn_id = NET_CONN_ID_NONE;
   CPU_INT08U  addr_wildcard[NET_CONN_ADDR_LEN_MAX];
@@ -2007,6 +2088,8 @@ NET_CONN_ID NetConn_Srch(NET_CONN_FAMILY      family,
         Mem_Copy(&addr_wildcard[NET_CONN_ADDR_IP_V4_IX_ADDR],
                  &NetConn_AddrWildCardv4[0],
                  NET_CONN_ADDR_IP_V4_LEN_ADDR);
+
+        p_addr_wildcard = &addr_wildcard[0];
       }
 #endif
     }
@@ -2023,11 +2106,11 @@ NET_CONN_ID NetConn_Srch(NET_CONN_FAMILY      family,
         Mem_Copy(&addr_wildcard[NET_CONN_ADDR_IP_V6_IX_ADDR],
                  &NetConn_AddrWildCardv6[0],
                  NET_CONN_ADDR_IP_V6_LEN_ADDR);
+
+        p_addr_wildcard = &addr_wildcard[0];
       }
 #endif
     }
-
-    p_addr_wildcard = &addr_wildcard[0];
     break;
 
     default:
@@ -2036,6 +2119,7 @@ NET_CONN_ID NetConn_Srch(NET_CONN_FAMILY      family,
       conn_id = NET_CONN_ID_NONE;
   }
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE == 0u)
   //                                                               ---------------- SRCH NET CONN LIST ----------------
   p_conn_list = &NetConn_ConnListHead[protocol_ix];
   p_conn_chain = NetConn_ListSrch(family,
@@ -2053,10 +2137,45 @@ NET_CONN_ID NetConn_Srch(NET_CONN_FAMILY      family,
                              p_addr_wildcard,
                              p_addr_remote,
                              p_conn_state);
+#else
+  //                                                               ------------- SRCH NET CONN HASH TBL --------------
+  addr_len_srch = NetConn_AddrLenGet(family);
+  addr_local_wildcard = DEF_YES;                                // Skip wildcard srch's if no wildcard addr ...
+  if (p_addr_wildcard != DEF_NULL) {                            // ... or if local addr is wildcard addr.
+    addr_local_wildcard = Mem_Cmp(p_addr_local,
+                                  p_addr_wildcard,
+                                  addr_len_srch);
+  }
+
+  p_conn = DEF_NULL;
+  if (p_addr_remote != DEF_NULL) {                              // Srch full conns (see Note #5).
+    p_conn = NetConn_HashSrch(family, protocol_ix, p_addr_local, p_addr_remote, addr_len_srch);
+    if (p_conn != DEF_NULL) {
+      *p_conn_state = NET_CONN_STATE_FULL;
+    } else if (addr_local_wildcard == DEF_NO) {
+      p_conn = NetConn_HashSrch(family, protocol_ix, p_addr_wildcard, p_addr_remote, addr_len_srch);
+      if (p_conn != DEF_NULL) {
+        *p_conn_state = NET_CONN_STATE_FULL_WILDCARD;
+      }
+    }
+  }
+
+  if (p_conn == DEF_NULL) {                                     // Srch half conns.
+    p_conn = NetConn_HashSrch(family, protocol_ix, p_addr_local, DEF_NULL, addr_len_srch);
+    if (p_conn != DEF_NULL) {
+      *p_conn_state = NET_CONN_STATE_HALF;
+    } else if (addr_local_wildcard == DEF_NO) {
+      p_conn = NetConn_HashSrch(family, protocol_ix, p_addr_wildcard, DEF_NULL, addr_len_srch);
+      if (p_conn != DEF_NULL) {
+        *p_conn_state = NET_CONN_STATE_HALF_WILDCARD;
+      }
+    }
+  }
+#endif
 
   if (p_conn == DEF_NULL) {                                     // NO net conn       found.
     conn_id = NET_CONN_ID_NONE;
-    goto exit;                                                  // Rtn err from NetConn_ChainSrch().
+    goto exit;
   }
 
   //                                                               If net conn       found, rtn conn id's.
@@ -2275,6 +2394,7 @@ static NET_CONN *NetConn_ListSrch(NET_CONN_FAMILY family,
   return (p_conn_chain);
 }
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE == 0u)
 /****************************************************************************************************//**
  *                                           NetConn_ChainSrch()
  *
@@ -2444,6 +2564,7 @@ static NET_CONN *NetConn_ChainSrch(NET_CONN       **p_conn_list,
 
   return (p_conn);
 }
+#endif
 
 /****************************************************************************************************//**
  *                                           NetConn_ChainInsert()
@@ -2542,6 +2663,7 @@ static void NetConn_ChainUnlink(NET_CONN **p_conn_list,
  *                   network connection list.
  *           - (b) Network connections       are added at (or promoted to) the head of a
  *                   network connection chain.
+ *           - (c) Network connections       are added to the network connection hash table, if enabled.
  *
  * @param    p_conn_list     Pointer to a network connection list.
  *
@@ -2595,6 +2717,10 @@ static void NetConn_Add(NET_CONN **p_conn_list,
   }
 
   p_conn->ConnList = p_conn_list;                                   // Mark conn's conn list ownership.
+
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  NetConn_HashInsert(p_conn);                                       // Index conn by its addrs.
+#endif
 }
 
 /****************************************************************************************************//**
@@ -2622,6 +2748,10 @@ static void NetConn_Unlink(NET_CONN *p_conn)
     return;                                                             // ... exit unlink.
   }
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  NetConn_HashRemove(p_conn);                                           // Remove conn from hash tbl.
+#endif
+
   //                                                               ----- UNLINK NET CONN FROM CONN CHAIN ------
   p_conn_prev = p_conn->PrevConnPtr;
   p_conn_next = p_conn->NextConnPtr;
@@ -2678,6 +2808,191 @@ static void NetConn_Unlink(NET_CONN *p_conn)
 #endif
 }
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+/****************************************************************************************************//**
+ *                                           NetConn_HashSrch()
+ *
+ * @brief    Search the network connection hash table for a network connection with specific local &
+ *           remote addresses.
+ *
+ * @param    family          Network connection family type.
+ *
+ * @param    protocol_ix     Network connection protocol index.
+ *
+ * @param    p_addr_local    Pointer to local  address.
+ *
+ * @param    p_addr_remote   Pointer to remote address, or DEF_NULL to search for a connection with NO
+ *                           valid remote address.
+ *
+ * @param    addr_len        Length of addresses to compare (in octets).
+ *
+ * @return   Pointer to connection with specific local & remote address, if found.
+ *           Pointer to NULL, otherwise.
+ *******************************************************************************************************/
+static NET_CONN *NetConn_HashSrch(NET_CONN_FAMILY      family,
+                                  NET_CONN_PROTOCOL_IX protocol_ix,
+                                  CPU_INT08U           *p_addr_local,
+                                  CPU_INT08U           *p_addr_remote,
+                                  CPU_SIZE_T           addr_len)
+{
+  NET_CONN    *p_conn;
+  CPU_INT16U  hash_ix;
+  CPU_BOOLEAN found;
+
+  hash_ix = NetConn_HashIxGet(protocol_ix, p_addr_local, p_addr_remote, addr_len);
+  p_conn = NetConn_HashTbl[hash_ix];
+  found = DEF_NO;
+
+  while ((p_conn != DEF_NULL)                                   // Srch ALL net conns in bucket ..
+         && (found == DEF_NO)) {                                // .. until net conn found.
+    if ((p_conn->ProtocolIx == protocol_ix)
+        && (p_conn->Family == family)) {
+      found = Mem_Cmp(p_addr_local,
+                      &p_conn->AddrLocal[0],
+                      addr_len);
+      if (found == DEF_YES) {                                   // If local addrs match, ...
+        if (p_addr_remote == DEF_NULL) {                        // ... & half conn srch'd, conn remote addr MUST NOT be valid.
+          found = (p_conn->AddrRemoteValid == DEF_NO) ? DEF_YES : DEF_NO;
+        } else if (p_conn->AddrRemoteValid == DEF_YES) {        // ... else cmp remote addrs.
+          found = Mem_Cmp(p_addr_remote,
+                          &p_conn->AddrRemote[0],
+                          addr_len);
+        } else {
+          found = DEF_NO;
+        }
+      }
+    }
+
+    if (found != DEF_YES) {
+      p_conn = p_conn->HashNextPtr;
+    }
+  }
+
+  return (p_conn);
+}
+
+/****************************************************************************************************//**
+ *                                           NetConn_HashIxGet()
+ *
+ * @brief    Get the network connection hash table index of a connection address tuple.
+ *
+ * @param    protocol_ix     Network connection protocol index.
+ *
+ * @param    p_addr_local    Pointer to local  address.
+ *
+ * @param    p_addr_remote   Pointer to remote address, or DEF_NULL if NO valid remote address.
+ *
+ * @param    addr_len        Length of addresses to hash (in octets).
+ *
+ * @return   Hash table index.
+ *
+ * @note     (1) Addresses are hashed with 32-bit FNV-1a, folded to the table size.
+ *******************************************************************************************************/
+static CPU_INT16U NetConn_HashIxGet(NET_CONN_PROTOCOL_IX protocol_ix,
+                                    CPU_INT08U           *p_addr_local,
+                                    CPU_INT08U           *p_addr_remote,
+                                    CPU_SIZE_T           addr_len)
+{
+  CPU_INT32U hash;
+  CPU_SIZE_T ix;
+
+  hash = (2166136261u ^ protocol_ix) * 16777619u;               // See Note #1.
+  for (ix = 0u; ix < addr_len; ix++) {
+    hash = (hash ^ p_addr_local[ix]) * 16777619u;
+  }
+  if (p_addr_remote != DEF_NULL) {
+    for (ix = 0u; ix < addr_len; ix++) {
+      hash = (hash ^ p_addr_remote[ix]) * 16777619u;
+    }
+  }
+
+  hash ^= hash >> 16u;
+
+  return ((CPU_INT16U)(hash & (NET_CONN_CFG_HASH_TBL_SIZE - 1u)));
+}
+
+/****************************************************************************************************//**
+ *                                           NetConn_HashInsert()
+ *
+ * @brief    Insert a network connection at the head of its hash table bucket.
+ *
+ * @param    p_conn  Pointer to a network connection.
+ *
+ * @note     (1) A connection is hashed on its remote address only while the remote address is valid.
+ *               Callers MUST remove & re-insert a listed connection whose addresses change.
+ *******************************************************************************************************/
+static void NetConn_HashInsert(NET_CONN *p_conn)
+{
+  CPU_INT08U *p_addr_remote;
+  CPU_INT16U hash_ix;
+
+  p_addr_remote = (p_conn->AddrRemoteValid == DEF_YES) ? &p_conn->AddrRemote[0] : DEF_NULL;
+  hash_ix = NetConn_HashIxGet(p_conn->ProtocolIx,
+                              &p_conn->AddrLocal[0],
+                              p_addr_remote,
+                              NetConn_AddrLenGet(p_conn->Family));
+
+  p_conn->HashIx = hash_ix;
+  p_conn->HashPrevPtr = DEF_NULL;
+  p_conn->HashNextPtr = NetConn_HashTbl[hash_ix];
+  if (p_conn->HashNextPtr != DEF_NULL) {
+    p_conn->HashNextPtr->HashPrevPtr = p_conn;
+  }
+  NetConn_HashTbl[hash_ix] = p_conn;
+}
+
+/****************************************************************************************************//**
+ *                                           NetConn_HashRemove()
+ *
+ * @brief    Remove a network connection from its hash table bucket.
+ *
+ * @param    p_conn  Pointer to a network connection.
+ *******************************************************************************************************/
+static void NetConn_HashRemove(NET_CONN *p_conn)
+{
+  if (p_conn->HashPrevPtr != DEF_NULL) {
+    p_conn->HashPrevPtr->HashNextPtr = p_conn->HashNextPtr;
+  } else {
+    NetConn_HashTbl[p_conn->HashIx] = p_conn->HashNextPtr;
+  }
+
+  if (p_conn->HashNextPtr != DEF_NULL) {
+    p_conn->HashNextPtr->HashPrevPtr = p_conn->HashPrevPtr;
+  }
+
+  p_conn->HashPrevPtr = DEF_NULL;
+  p_conn->HashNextPtr = DEF_NULL;
+}
+
+/****************************************************************************************************//**
+ *                                           NetConn_AddrLenGet()
+ *
+ * @brief    Get the length of the network connection addresses of a family.
+ *
+ * @param    family  Network connection family type.
+ *
+ * @return   Length of addresses (in octets), if family supported.
+ *           0, otherwise.
+ *******************************************************************************************************/
+static CPU_SIZE_T NetConn_AddrLenGet(NET_CONN_FAMILY family)
+{
+  switch (family) {
+#ifdef  NET_IPv4_MODULE_EN
+    case NET_CONN_FAMILY_IP_V4_SOCK:
+      return ((CPU_SIZE_T)NET_SOCK_ADDR_LEN_IP_V4);
+#endif
+
+#ifdef  NET_IPv6_MODULE_EN
+    case NET_CONN_FAMILY_IP_V6_SOCK:
+      return ((CPU_SIZE_T)NET_SOCK_ADDR_LEN_IP_V6);
+#endif
+
+    default:
+      return (0u);
+  }
+}
+#endif
+
 /****************************************************************************************************//**
  *                                               NetConn_Close()
  *
@@ -3038,6 +3353,11 @@ static void NetConn_Clr(NET_CONN *p_conn)
   p_conn->PrevConnPtr = DEF_NULL;
   p_conn->NextConnPtr = DEF_NULL;
   p_conn->ConnList = DEF_NULL;
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  p_conn->HashPrevPtr = DEF_NULL;
+  p_conn->HashNextPtr = DEF_NULL;
+  p_conn->HashIx = 0u;
+#endif
   p_conn->ID_AppClone = NET_CONN_ID_NONE;
   p_conn->ID_Transport = NET_CONN_ID_NONE;
   p_conn->IF_Nbr = NET_IF_NBR_NONE;
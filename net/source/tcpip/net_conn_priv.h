@@ -65,6 +65,21 @@
 #define  NET_CONN_ACCESSED_TH_MAX                      65000
 #define  NET_CONN_ACCESSED_TH_DFLT                       100
 
+/********************************************************************************************************
+ *                                   NETWORK CONNECTION HASH TABLE DEFINES
+ *
+ * Note(s) : (1) Connections in a connection list are also indexed in a hash table keyed on their protocol
+ *               index, local address & remote address, when valid.  NetConn_Srch() then resolves a search
+ *               with at most four table lookups instead of walking the connection chain.
+ *
+ *           (2) NET_CONN_CFG_HASH_TBL_SIZE MUST be a power of 2.  Set to 0 to search the connection lists
+ *               linearly & save the table's memory.
+ *******************************************************************************************************/
+
+#ifndef  NET_CONN_CFG_HASH_TBL_SIZE
+#define  NET_CONN_CFG_HASH_TBL_SIZE                       32u   // See Note #2.
+#endif
+
 /********************************************************************************************************
  *                               NETWORK CONNECTION PROTOCOL INDEX DEFINES
  *******************************************************************************************************/
@@ -367,6 +382,12 @@ struct  net_conn {
 
   NET_CONN             **ConnList;                              // Conn list.
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)
+  NET_CONN             *HashPrevPtr;                            // Ptr to PREV conn in hash bucket.
+  NET_CONN             *HashNextPtr;                            // Ptr to NEXT conn in hash bucket.
+  CPU_INT16U           HashIx;                                  // Ix of conn's hash bucket.
+#endif
+
   NET_CONN_ID          ID;                                      // Net             conn id.
   NET_CONN_ID          ID_App;                                  // App       layer conn id.
   NET_CONN_ID          ID_AppClone;                             // App       layer conn id clone.
@@ -421,6 +442,10 @@ extern NET_STAT_POOL NetConn_PoolStat;
 //                                                                 Array of ptrs to net conn lists.
 extern NET_CONN *NetConn_ConnListHead[NET_CONN_PROTOCOL_NBR_MAX];
 
+#if (NET_CONN_CFG_HASH_TBL_SIZE > 0u)                           // Hash tbl of listed net conns.
+extern NET_CONN **NetConn_HashTbl;
+#endif
+
 extern NET_CONN *NetConn_ConnListChainPtr;                      // Ptr to cur  conn list chain to update.
 extern NET_CONN *NetConn_ConnListConnPtr;                       // Ptr to cur  conn list conn  to update.
 extern NET_CONN *NetConn_ConnListNextChainPtr;                  // Ptr to next conn list chain to update.
@@ -596,6 +621,12 @@ void NetConn_ListUnlink(NET_CONN_ID conn_id);
 #error  "                           [     &&  <= NET_CONN_NBR_MAX]    "
 #endif
 
+#if    ((NET_CONN_CFG_HASH_TBL_SIZE > 0u) \
+  && ((NET_CONN_CFG_HASH_TBL_SIZE & (NET_CONN_CFG_HASH_TBL_SIZE - 1u)) != 0u))
+#error  "NET_CONN_CFG_HASH_TBL_SIZE  illegally #define'd in 'net_cfg.h'"
+#error  "                           [MUST be  a power of 2, or 0]     "
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               MODULE END
@@ -251,6 +251,10 @@ typedef  struct  net_ctr_arp_stats {
   NET_CTR TxMsgCtr;                                         // Nbr tx'd ARP       msgs.
   NET_CTR TxMsgReqCtr;                                      // Nbr tx'd ARP req   msgs.
   NET_CTR TxMsgReplyCtr;                                    // Nbr tx'd ARP reply msgs.
+
+  NET_CTR CacheSrchHitCtr;                                  // Nbr ARP cache srchs found.
+  NET_CTR CacheSrchMissCtr;                                 // Nbr ARP cache srchs NOT found.
+  NET_CTR CacheEvictCtr;                                    // Nbr resolved ARP caches evicted for new caches.
 } NET_CTR_ARP_STATS;
 
 /*--------------------------------------------------------------------------------------------------------
@@ -263,6 +267,10 @@ typedef  struct  net_ctr_ndp_stats {
   NET_CTR RxMsgAdvNborCtr;                                  // Nbr rx'd NDP neighbor advertisement msgs.
   NET_CTR RxMsgAdvRouterCtr;                                // Nbr rx'd NDP router   advertisement msgs.
   NET_CTR RxMsgRedirectCtr;                                 // Nbr rx'd NDP redirect               msgs.
+
+  NET_CTR CacheSrchHitCtr;                                  // Nbr NDP neighbor cache srchs found.
+  NET_CTR CacheSrchMissCtr;                                 // Nbr NDP neighbor cache srchs NOT found.
+  NET_CTR CacheEvictCtr;                                    // Nbr resolved NDP neighbor caches evicted for new caches.
 } NET_CTR_NDP_STATS;
 
 /*--------------------------------------------------------------------------------------------------------
@@ -3903,46 +3903,82 @@ exit:
 }
 
 /****************************************************************************************************//**
- *                                               NetIF_RxQPend()
+ *                                           NetIF_RxQHandler()
  *
- * @brief    Check for a received packet event in the Rx event list.
+ * @brief    Handle received packet events from the Rx event list, up to a budget.
  *
- * @param    p_err   Pointer to variable that will receive the return error code from this function.
+ * @param    budget  Maximum number of packets to handle.
  *
- * @return   Interface number on which packet was received, if NO error(s).
- *           NET_IF_NBR_NONE, otherwise.
+ * @param    quota   Maximum number of packets to handle per interface.
+ *
+ * @return   Number of packets handled.
+ *
+ * @note     (1) Events are handled in the order they were posted.  An event for an interface that used
+ *               its quota is moved to the tail of the Rx event list instead, to be handled by a later
+ *               call.  Received packets stay queued in their interface, so the events of an interface
+ *               are interchangeable & moving one does NOT reorder packets.
+ *
+ * @note     (2) Handling stops when the budget is used, when the list is empty, or when the first moved
+ *               event is back at the head of the list, i.e. when every remaining event belongs to an
+ *               interface that used its quota.
  *******************************************************************************************************/
-NET_IF_NBR NetIF_RxQPend(RTOS_ERR *p_err)
+CPU_INT16U NetIF_RxQHandler(CPU_INT16U budget,
+                            CPU_INT16U quota)
 {
-  NET_IF_EVENT_RX *p_event_rx = DEF_NULL;
-  SLIST_MEMBER    *p_node = DEF_NULL;
-  NET_IF_NBR      if_nbr = NET_IF_NBR_NONE;
+  CPU_INT16U      rx_ctr_tbl[NET_IF_NBR_IF_TOT];
+  NET_IF_EVENT_RX *p_event_rx;
+  SLIST_MEMBER    *p_node;
+  SLIST_MEMBER    *p_node_moved;
+  NET_IF_NBR      if_nbr;
+  CPU_INT16U      rx_ctr;
   CORE_DECLARE_IRQ_STATE;
 
-  CORE_ENTER_ATOMIC();
-  p_node = SList_Pop(&NetIF_DataPtr->ListEventRxHead);
-  if (NetIF_DataPtr->ListEventRxHead == DEF_NULL) {
-    NetIF_DataPtr->ListEventRxTail = DEF_NULL;
-  }
-  CORE_EXIT_ATOMIC();
+  Mem_Clr(&rx_ctr_tbl[0], sizeof(rx_ctr_tbl));
+  p_node_moved = DEF_NULL;
+  rx_ctr = 0u;
 
-  if (p_node == DEF_NULL) {
-    RTOS_ERR_SET(*p_err, RTOS_ERR_POOL_EMPTY);
-    goto exit;
-  }
+  while (rx_ctr < budget) {
+    CORE_ENTER_ATOMIC();
+    p_node = NetIF_DataPtr->ListEventRxHead;
+    if ((p_node == DEF_NULL)                                    // Stop if list empty or cycled (see Note #2).
+        || (p_node == p_node_moved)) {
+      CORE_EXIT_ATOMIC();
+      break;
+    }
 
-  p_event_rx = SLIST_ENTRY(p_node, NET_IF_EVENT_RX, ListNode);
+    (void)SList_Pop(&NetIF_DataPtr->ListEventRxHead);
+    if (NetIF_DataPtr->ListEventRxHead == DEF_NULL) {
+      NetIF_DataPtr->ListEventRxTail = DEF_NULL;
+    }
 
-  if_nbr = p_event_rx->IF_Nbr;
+    p_event_rx = SLIST_ENTRY(p_node, NET_IF_EVENT_RX, ListNode);
+    if_nbr = p_event_rx->IF_Nbr;
 
-  CORE_ENTER_ATOMIC();
-  SList_Push(&NetIF_DataPtr->ListFreeEventRxHead, p_node);
-  CORE_EXIT_ATOMIC();
+    if (rx_ctr_tbl[if_nbr] >= quota) {                          // If IF quota used, mv event to tail (see Note #1).
+      if (NetIF_DataPtr->ListEventRxHead == DEF_NULL) {
+        SList_PushBack(&NetIF_DataPtr->ListEventRxHead, p_node);
+      } else {
+        SList_Add(p_node, NetIF_DataPtr->ListEventRxTail);
+      }
+      NetIF_DataPtr->ListEventRxTail = p_node;
+      CORE_EXIT_ATOMIC();
 
-  RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
+      if (p_node_moved == DEF_NULL) {
+        p_node_moved = p_node;
+      }
+      continue;
+    }
 
-exit:
-  return (if_nbr);
+    SList_Push(&NetIF_DataPtr->ListFreeEventRxHead, p_node);
+    CORE_EXIT_ATOMIC();
+
+    NetIF_RxHandler(if_nbr);
+
+    rx_ctr_tbl[if_nbr]++;
+    rx_ctr++;
+  }
+
+  return (rx_ctr);
 }
 
 /******************************************************************************************************
@@ -415,7 +415,8 @@ typedef  struct  net_dev_api {
 void NetIF_RxQPost(NET_IF_NBR if_nbr,                          // Signal IF rx rdy    from dev rx ISR(s).
                    RTOS_ERR   *p_err);
 
-NET_IF_NBR NetIF_RxQPend(RTOS_ERR *p_err);
+CPU_INT16U NetIF_RxQHandler(CPU_INT16U budget,
+                            CPU_INT16U quota);
 
 void NetIF_RxHandler(NET_IF_NBR if_nbr);
 
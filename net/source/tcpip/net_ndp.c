@@ -654,6 +654,10 @@ void NetNDP_Init(MEM_SEG  *p_mem_seg,
   //                                                               ------------- INIT NDP CACHE LIST PTRS -------------
   NetCache_AddrListHead[NET_CACHE_ADDR_LIST_IX_NDP] = DEF_NULL;
   NetCache_AddrListTail[NET_CACHE_ADDR_LIST_IX_NDP] = DEF_NULL;
+#if (NET_CACHE_CFG_HASH_TBL_SIZE > 0u)
+  Mem_Clr(&NetCache_AddrHashTbl[NET_CACHE_ADDR_LIST_IX_NDP][0],
+          sizeof(NetCache_AddrHashTbl[NET_CACHE_ADDR_LIST_IX_NDP]));
+#endif
 
   NetNDP_DataPtr->DfltRouterTbl = (NET_NDP_ROUTER **)Mem_SegAlloc("Default Router Tbl",
                                                                   p_mem_seg,
@@ -227,6 +227,10 @@ static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_i
                                                        CPU_INT08U         *p_ip_opts_len,
                                                        RTOS_ERR           *p_err);
 
+static void NetSock_RxQ_DatagramRemove(NET_SOCK           *p_sock,
+                                       NET_BUF            *p_buf_head_next,
+                                       NET_SOCK_DATA_SIZE size);
+
 static NET_SOCK_RTN_CODE NetSock_TxDataHandler(NET_SOCK_ID        sock_id,
                                                void               *p_data,
                                                CPU_INT16U         data_len,
@@ -5767,8 +5771,8 @@ CPU_INT32U NetSock_CfgTimeoutConnCloseGet_ms(NET_SOCK_ID sock_id,
  *                                                                           DEF_YES
  *                                                                           DEF_NO
  *
- *                   NET_SOCK_OPT_SOCK_TX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection transmit windows size  value
- *                   NET_SOCK_OPT_SOCK_RX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection receive  windows size  value
+ *                   NET_SOCK_OPT_SOCK_TX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection transmit windows size  value (see Note #3)
+ *                   NET_SOCK_OPT_SOCK_RX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection receive  windows size  value (see Note #3)
  *                   NET_SOCK_OPT_SOCK_TX_TIMEOUT    CPU_INT32U            TCP connection transmit queue timeout value
  *                   NET_SOCK_OPT_SOCK_RX_TIMEOUT    CPU_INT32U            TCP connection receive  queue timeout value
  *
@@ -5792,6 +5796,10 @@ CPU_INT32U NetSock_CfgTimeoutConnCloseGet_ms(NET_SOCK_ID sock_id,
  *                   NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
  *                   NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
  *           @endverbatim                                                                                         value (in seconds)
+ *
+ * @note     (3) NET_SOCK_OPT_SOCK_TX_BUF_SIZE & NET_SOCK_OPT_SOCK_RX_BUF_SIZE are returned as a CPU_INT32U
+ *               if the option value buffer can hold one. Otherwise they are returned as a CPU_INT16U,
+ *               limited to DEF_INT_16U_MAX_VAL, as they were before NET_TCP_WIN_SIZE was widened.
  *******************************************************************************************************/
 NET_SOCK_RTN_CODE NetSock_OptGet(NET_SOCK_ID       sock_id,
                                  NET_SOCK_PROTOCOL level,
@@ -6136,8 +6144,8 @@ exit_release:
  *                                                                           DEF_ENABLED
  *                                                                           DEF_DISABLED
  *
- *                   NET_SOCK_OPT_SOCK_TX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection transmit windows size  value
- *                   NET_SOCK_OPT_SOCK_RX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection receive  windows size  value
+ *                   NET_SOCK_OPT_SOCK_TX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection transmit windows size  value (see Note #4)
+ *                   NET_SOCK_OPT_SOCK_RX_BUF_SIZE   NET_TCP_WIN_SIZE      TCP connection receive  windows size  value (see Note #4)
  *                   NET_SOCK_OPT_SOCK_TX_TIMEOUT    CPU_INT32U            TCP connection transmit queue timeout value
  *                   NET_SOCK_OPT_SOCK_RX_TIMEOUT    CPU_INT32U            TCP connection receive  queue timeout value
  *
@@ -6162,6 +6170,9 @@ exit_release:
  *                   NET_SOCK_OPT_TCP_KEEP_IDLE      NET_TCP_TIMEOUT_SEC   TCP keep alive timeout       value (in seconds)
  *                   NET_SOCK_OPT_TCP_KEEP_INTVL     NET_TCP_TIMEOUT_SEC   TCP keep alive probe re-transmit timeout
  *           @endverbatim                                                                                         value (in seconds)
+ *
+ * @note     (4) NET_SOCK_OPT_SOCK_TX_BUF_SIZE & NET_SOCK_OPT_SOCK_RX_BUF_SIZE accept either a CPU_INT32U or
+ *               a CPU_INT16U option value, as they did before NET_TCP_WIN_SIZE was widened.
  *******************************************************************************************************/
 NET_SOCK_RTN_CODE NetSock_OptSet(NET_SOCK_ID       sock_id,
                                  NET_SOCK_PROTOCOL level,
@@ -6183,10 +6194,11 @@ NET_SOCK_RTN_CODE NetSock_OptSet(NET_SOCK_ID       sock_id,
 #endif
 #endif
 #ifdef  NET_TCP_MODULE_EN
-  NET_CONN_ID conn_id_transport;
-  CPU_INT16U  *p_int16u_val;
-  CPU_INT32U  *p_int32u_val;
-  CPU_BOOLEAN *p_bool_val;
+  NET_CONN_ID      conn_id_transport;
+  NET_TCP_WIN_SIZE win_size;
+  CPU_INT16U       *p_int16u_val;
+  CPU_INT32U       *p_int32u_val;
+  CPU_BOOLEAN      *p_bool_val;
 #endif
 
   RTOS_ASSERT_DBG_ERR_SET((p_opt_val != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, NET_SOCK_BSD_ERR_OPT_SET);
@@ -6269,14 +6281,19 @@ NET_SOCK_RTN_CODE NetSock_OptSet(NET_SOCK_ID       sock_id,
                 (void)NetSock_CfgTxNagleEnHandler(sock_id, *p_bool_val, p_err);
                 break;
 
-              case NET_SOCK_OPT_SOCK_TX_BUF_SIZE:
-                if (opt_len != sizeof(NET_TCP_WIN_SIZE)) {
-                  Net_GlobalLockRelease();
-                  RTOS_DBG_FAIL_EXEC_ERR(*p_err, RTOS_ERR_INVALID_ARG, NET_SOCK_BSD_ERR_OPT_SET);
+              case NET_SOCK_OPT_SOCK_TX_BUF_SIZE:               // See Note #4.
+                if (opt_len == sizeof(CPU_INT32U)) {
+                  p_int32u_val = (CPU_INT32U *)p_opt_val;
+                  win_size = (NET_TCP_WIN_SIZE)*p_int32u_val;
+                } else if (opt_len == sizeof(CPU_INT16U)) {
+                  p_int16u_val = (CPU_INT16U *)p_opt_val;
+                  win_size = (NET_TCP_WIN_SIZE)*p_int16u_val;
+                } else {
+                  RTOS_ERR_SET(*p_err, RTOS_ERR_INVALID_ARG);
+                  goto exit_release;
                 }
 
-                p_int16u_val = (CPU_INT16U *)p_opt_val;
-                (void)NetTCP_ConnCfgTxWinSizeHandler(conn_id_transport, *p_int16u_val, p_err);
+                (void)NetTCP_ConnCfgTxWinSizeHandler(conn_id_transport, win_size, p_err);
                 break;
 
               case NET_SOCK_OPT_SOCK_TX_TIMEOUT:
@@ -6289,14 +6306,19 @@ NET_SOCK_RTN_CODE NetSock_OptSet(NET_SOCK_ID       sock_id,
                 NetTCP_TxQ_TimeoutSet(conn_id_transport, *p_int32u_val);
                 break;
 
-              case NET_SOCK_OPT_SOCK_RX_BUF_SIZE:
-                if (opt_len != sizeof(NET_TCP_WIN_SIZE)) {
-                  Net_GlobalLockRelease();
-                  RTOS_DBG_FAIL_EXEC_ERR(*p_err, RTOS_ERR_INVALID_ARG, NET_SOCK_BSD_ERR_OPT_SET);
+              case NET_SOCK_OPT_SOCK_RX_BUF_SIZE:               // See Note #4.
+                if (opt_len == sizeof(CPU_INT32U)) {
+                  p_int32u_val = (CPU_INT32U *)p_opt_val;
+                  win_size = (NET_TCP_WIN_SIZE)*p_int32u_val;
+                } else if (opt_len == sizeof(CPU_INT16U)) {
+                  p_int16u_val = (CPU_INT16U *)p_opt_val;
+                  win_size = (NET_TCP_WIN_SIZE)*p_int16u_val;
+                } else {
+                  RTOS_ERR_SET(*p_err, RTOS_ERR_INVALID_ARG);
+                  goto exit_release;
                 }
 
-                p_int16u_val = (CPU_INT16U *)p_opt_val;
-                (void)NetTCP_ConnCfgRxWinSizeHandler(conn_id_transport, *p_int16u_val, p_err);
+                (void)NetTCP_ConnCfgRxWinSizeHandler(conn_id_transport, win_size, p_err);
                 break;
 
               case NET_SOCK_OPT_SOCK_RX_TIMEOUT:
@@ -12195,6 +12217,13 @@ exit:
  *                       & 'NetSock_SelDescHandlerErrDatagram()  Note #3'.
  *
  *           14) IP options arguments may NOT be necessary (remove if unnecessary).
+ *
+ *           15) (a) If NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN is enabled & the datagram is consumed, it
+ *                   is removed from the socket receive queue & its data is copied with the global
+ *                   network lock released (see 'net_sock_priv.h  NETWORK SOCKET DATAGRAM COPY DEFINES  Note #1').
+ *
+ *           - (b) The packet buffer(s) are then freed once the lock is re-acquired, even if the
+ *                   application data could NOT be received (see also Note #11b).
  *******************************************************************************************************/
 static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_id,
                                                        NET_SOCK           *p_sock,
@@ -12217,10 +12246,10 @@ static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_i
   CPU_BOOLEAN       no_block;
   CPU_BOOLEAN       block;
   CPU_BOOLEAN       peek;
+  CPU_BOOLEAN       copy_unlocked;
   NET_BUF           *p_buf_head;
   NET_BUF           *p_buf_head_next;
   NET_BUF_HDR       *p_buf_head_hdr;
-  NET_BUF_HDR       *p_buf_head_next_hdr;
   NET_FLAGS         flags_transport;
   CPU_INT16U        data_len_tot;
   NET_SOCK_RTN_CODE rtn_code = NET_SOCK_BSD_ERR_RX;
@@ -12324,6 +12353,14 @@ static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_i
   //                                                               Cfg sock rx flags.
   peek = DEF_BIT_IS_SET((NET_SOCK_FLAGS)flags, NET_SOCK_FLAG_RX_DATA_PEEK);
 
+  copy_unlocked = DEF_NO;
+#if (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED)
+  if (peek != DEF_YES) {                                        // If pkt buf(s) consumed, rx w/o lock (see Note #15).
+    copy_unlocked = DEF_YES;
+    NetSock_RxQ_DatagramRemove(p_sock, p_buf_head_next, (NET_SOCK_DATA_SIZE)p_buf_head_hdr->DataLen);
+  }
+#endif
+
   //                                                               ------------------- RX SOCK DATA -------------------
   data_len_tot = 0u;
 
@@ -12331,10 +12368,15 @@ static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_i
     case NET_SOCK_PROTOCOL_UDP:
       //                                                           Cfg transport rx flags.
       flags_transport = NET_UDP_FLAG_NONE;
-      if (peek == DEF_YES) {
+      if ((peek == DEF_YES)
+          || (copy_unlocked == DEF_YES)) {                      // Pkt buf(s) freed under lock (see Note #15b).
         DEF_BIT_SET(flags_transport, NET_UDP_FLAG_RX_DATA_PEEK);
       }
 
+      if (copy_unlocked == DEF_YES) {
+        Net_GlobalLockRelease();
+      }
+
       data_len_tot = NetUDP_RxAppData(p_buf_head,
                                       p_data_buf,
                                       data_buf_len,
@@ -12343,6 +12385,13 @@ static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_i
                                       ip_opts_buf_len,
                                       p_ip_opts_len,
                                       p_err);
+
+      if (copy_unlocked == DEF_YES) {
+        Net_GlobalLockAcquire((void *)NetSock_RxDataHandlerDatagram);
+        p_buf_head_hdr->NextPrimListPtr = DEF_NULL;
+        (void)NetBuf_FreeBufList(p_buf_head, DEF_NULL);
+      }
+
       switch (RTOS_ERR_CODE_GET(*p_err)) {
         case RTOS_ERR_NONE:
         case RTOS_ERR_WOULD_OVF:
@@ -12366,23 +12415,9 @@ static NET_SOCK_RTN_CODE NetSock_RxDataHandlerDatagram(NET_SOCK_ID        sock_i
     NetSock_RxQ_Signal(p_sock);
   }
 
-  if (peek != DEF_YES) {                                        // If peek opt NOT req'd, pkt buf(s) consumed : ...
-    if (p_buf_head_next != DEF_NULL) {                          // ... if rem'ing rx Q non-empty,               ...
-                                                                // ... unlink from prev'ly q'd pkt buf(s);      ...
-      p_buf_head_next_hdr = &p_buf_head_next->Hdr;
-      p_buf_head_next_hdr->PrevPrimListPtr = DEF_NULL;
-    }
-    //                                                             ... & set new sock rx Q head.
-    p_sock->RxQ_Head = p_buf_head_next;
-    if (p_sock->RxQ_Head == DEF_NULL) {                         // If head now  points to NULL, ..
-      p_sock->RxQ_Tail = DEF_NULL;                              // .. tail also points to NULL.
-    }
-
-    if (p_sock->RxQ_SizeCur > (NET_SOCK_DATA_SIZE)data_len_tot) {      // If cur rx Q size >  tot data len, ..
-      p_sock->RxQ_SizeCur -= (NET_SOCK_DATA_SIZE)data_len_tot;       // .. dec rx Q size by tot data len.
-    } else {                                                    // Else lim to min rx Q size.
-      p_sock->RxQ_SizeCur = 0u;
-    }
+  if ((peek != DEF_YES)                                         // If peek opt NOT req'd, pkt buf(s) consumed : ...
+      && (copy_unlocked != DEF_YES)) {                          // ... unlink from sock rx Q.
+    NetSock_RxQ_DatagramRemove(p_sock, p_buf_head_next, (NET_SOCK_DATA_SIZE)data_len_tot);
   }
 
   rtn_code = (NET_SOCK_RTN_CODE)data_len_tot;
@@ -12393,6 +12428,45 @@ exit:
   return (rtn_code);
 }
 
+/****************************************************************************************************//**
+ *                                       NetSock_RxQ_DatagramRemove()
+ *
+ * @brief    Remove the datagram at the head of a socket's receive queue.
+ *
+ * @param    p_sock              Pointer to a socket.
+ *
+ * @param    p_buf_head_next     Pointer to the datagram queued after the head, if any (see Note #1).
+ *
+ * @param    size                Size to remove from the socket's current receive queue size (in octets).
+ *
+ * @note     (1) The removed packet buffer(s) are NOT freed, but MAY already have been freed by the
+ *               transport layer; the next datagram MUST therefore be read from the head before it
+ *               is received.
+ *******************************************************************************************************/
+static void NetSock_RxQ_DatagramRemove(NET_SOCK           *p_sock,
+                                       NET_BUF            *p_buf_head_next,
+                                       NET_SOCK_DATA_SIZE size)
+{
+  NET_BUF_HDR *p_buf_head_next_hdr;
+
+  if (p_buf_head_next != DEF_NULL) {                            // If rem'ing rx Q non-empty,              ...
+                                                                // ... unlink from prev'ly q'd pkt buf(s); ...
+    p_buf_head_next_hdr = &p_buf_head_next->Hdr;
+    p_buf_head_next_hdr->PrevPrimListPtr = DEF_NULL;
+  }
+  //                                                               ... & set new sock rx Q head.
+  p_sock->RxQ_Head = p_buf_head_next;
+  if (p_sock->RxQ_Head == DEF_NULL) {                           // If head now  points to NULL, ..
+    p_sock->RxQ_Tail = DEF_NULL;                                // .. tail also points to NULL.
+  }
+
+  if (p_sock->RxQ_SizeCur > size) {                             // If cur rx Q size >  size, ..
+    p_sock->RxQ_SizeCur -= size;                                // .. dec rx Q size by size.
+  } else {                                                      // Else lim to min rx Q size.
+    p_sock->RxQ_SizeCur = 0u;
+  }
+}
+
 /****************************************************************************************************//**
  *                                           NetSock_TxDataHandler()
  *
@@ -15397,12 +15471,14 @@ static NET_SOCK_RTN_CODE NetSock_OpGetSock(NET_SOCK          *p_sock,
                                            RTOS_ERR          *p_err)
 {
 #ifdef  NET_TCP_MODULE_EN
-  NET_TCP_CONN *p_conn;
-  NET_CONN_ID  conn_id;
-  NET_CONN_ID  conn_id_transport;
-  CPU_INT32U   timeout_ms;
-  CPU_BOOLEAN  sock_listen;
-  CPU_BOOLEAN  is_used;
+  NET_TCP_CONN     *p_conn;
+  NET_CONN_ID      conn_id;
+  NET_CONN_ID      conn_id_transport;
+  NET_TCP_WIN_SIZE win_size;
+  CPU_INT16U       win_size_16;
+  CPU_INT32U       timeout_ms;
+  CPU_BOOLEAN      sock_listen;
+  CPU_BOOLEAN      is_used;
 #endif
 
   switch (p_sock->SockType) {
@@ -15437,26 +15513,30 @@ static NET_SOCK_RTN_CODE NetSock_OpGetSock(NET_SOCK          *p_sock,
                        *p_opt_len);
               break;
 
-            case NET_SOCK_OPT_SOCK_TX_BUF_SIZE:
-              RTOS_ASSERT_DBG_ERR_SET((*p_opt_len >= (CPU_INT32S)sizeof(NET_TCP_WIN_SIZE)), *p_err, RTOS_ERR_INVALID_ARG, NET_SOCK_BSD_ERR_OPT_GET);
-
-              *p_opt_len = sizeof(NET_TCP_WIN_SIZE);
-              p_conn = &NetTCP_ConnTbl[conn_id_transport];
-
-              Mem_Copy(p_opt_val,
-                       &p_conn->TxWinSizeCfgd,
-                       *p_opt_len);
-              break;
-
+            case NET_SOCK_OPT_SOCK_TX_BUF_SIZE:                 // See 'NetSock_OptGet() Note #3'.
             case NET_SOCK_OPT_SOCK_RX_BUF_SIZE:
-              RTOS_ASSERT_DBG_ERR_SET((*p_opt_len >= (CPU_INT32S)sizeof(NET_TCP_WIN_SIZE)), *p_err, RTOS_ERR_INVALID_ARG, NET_SOCK_BSD_ERR_OPT_GET);
-
-              *p_opt_len = sizeof(NET_TCP_WIN_SIZE);
               p_conn = &NetTCP_ConnTbl[conn_id_transport];
+              if (opt_name == NET_SOCK_OPT_SOCK_TX_BUF_SIZE) {
+                win_size = p_conn->TxWinSizeCfgd;
+              } else {
+                win_size = p_conn->RxWinSizeCfgd;
+              }
 
-              Mem_Copy(p_opt_val,
-                       &p_conn->RxWinSizeCfgd,
-                       *p_opt_len);
+              if (*p_opt_len >= (CPU_INT32S)sizeof(CPU_INT32U)) {
+                *p_opt_len = sizeof(CPU_INT32U);
+                Mem_Copy(p_opt_val,
+                         &win_size,
+                         *p_opt_len);
+              } else if (*p_opt_len >= (CPU_INT32S)sizeof(CPU_INT16U)) {
+                win_size_16 = (CPU_INT16U)DEF_MIN(win_size, DEF_INT_16U_MAX_VAL);
+                *p_opt_len = sizeof(CPU_INT16U);
+                Mem_Copy(p_opt_val,
+                         &win_size_16,
+                         *p_opt_len);
+              } else {
+                RTOS_ERR_SET(*p_err, RTOS_ERR_INVALID_ARG);
+                return (NET_SOCK_BSD_ERR_OPT_GET);
+              }
               break;
 
             case NET_SOCK_OPT_SOCK_TX_TIMEOUT:
@@ -76,6 +76,35 @@
 #define  NET_SOCK_ADDR_LEN_MAX                      0
 #endif
 
+/********************************************************************************************************
+ *                                   NETWORK SOCKET DATAGRAM COPY DEFINES
+ *
+ * Note(s) : (1) When NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN is enabled, datagram socket receive &
+ *               transmit only hold the global network lock to dequeue or get the packet buffer & to free
+ *               or transmit it. Application data is copied from or into the packet buffer with the lock
+ *               released, so that the Network Task & other sockets are NOT blocked for the length of
+ *               the copy. The global network lock itself is NOT split.
+ *
+ *           (2) The packet buffer is owned by the calling task only while the lock is released :
+ *               - (a) A received datagram is removed from the socket receive queue before its data is
+ *                     copied; a datagram that the application fails to receive is therefore discarded.
+ *               - (b) A transmit buffer is NOT linked to any queue until it is transmitted. Since the
+ *                     source address may be removed meanwhile, its interface is checked again once the
+ *                     lock is re-acquired & the datagram is discarded if it changed.
+ *
+ *           (3) Stream socket receive copies application data with only a per-connection lock held
+ *               when NET_TCP_CFG_CONN_RX_LOCK_EN is enabled (see 'net_tcp_priv.h  TCP CONNECTION RECEIVE
+ *               LOCK DEFINES'). Stream socket transmit always copies under the global network lock.
+ *
+ *           (4) Each datagram pays one more lock release & acquire, which only pays off for large
+ *               datagrams or when several tasks use sockets concurrently. Compare the 'net_udp_bench'
+ *               shell command results with this option enabled & disabled before enabling it.
+ *******************************************************************************************************/
+
+#ifndef  NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN
+#define  NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN       DEF_DISABLED
+#endif
+
 /********************************************************************************************************
  *                                   NETWORK SOCKET PORT NUMBER DEFINES
  *
@@ -728,6 +757,13 @@ CPU_INT32U NetSock_ConnCloseTimeoutGet_ms(NET_SOCK *p_sock);
 
 #endif
 
+#if    ((NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN != DEF_DISABLED) \
+  && (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN != DEF_ENABLED))
+#error  "NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN illegally #define'd in 'net_cfg.h'"
+#error  "                                     [MUST be  DEF_DISABLED]           "
+#error  "                                     [     ||  DEF_ENABLED ]           "
+#endif
+
 #ifndef  NET_SOCK_CFG_RX_Q_SIZE_OCTET
 #error  "NET_SOCK_CFG_RX_Q_SIZE_OCTET               not #define'd in 'net_cfg.h'  "
 #error  "                                     [MUST be  >= NET_SOCK_DATA_SIZE_MIN]"
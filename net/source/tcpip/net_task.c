@@ -61,6 +61,8 @@ static KAL_SEM_HANDLE NetTask_SignalHandle;
 
 static KAL_TASK_HANDLE NetTask_Handle;
 
+static CPU_INT16U NetTask_RxBudget = NET_TASK_CFG_RX_BUDGET;
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                       LOCAL FUNCTION PROTOTYPES
@@ -70,6 +72,8 @@ static KAL_TASK_HANDLE NetTask_Handle;
 static void NetTask_SignalPend(CPU_INT32U timeout_ms,
                                RTOS_ERR   *p_err);
 
+static void NetTask_SignalClr(CPU_INT16U nbr_signal);
+
 static void NetTask_Handler(void *p_data);
 
 /********************************************************************************************************
@@ -172,6 +176,26 @@ void NetTask_SignalPost(void)
   RTOS_ASSERT_CRITICAL((RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE), RTOS_ERR_ASSERT_CRITICAL_FAIL,; );
 }
 
+/****************************************************************************************************//**
+ *                                           NetTask_RxBudgetSet()
+ *
+ * @brief    Set the maximum number of received packets handled per Network Task wake-up.
+ *
+ * @param    budget  Number of packets, 1 or more (see 'net_task_priv.h  DEFINES  Note #1').
+ *
+ * @note     (1) The per-interface quota is NET_TASK_CFG_RX_QUOTA_IF, limited to the budget.
+ *******************************************************************************************************/
+void NetTask_RxBudgetSet(CPU_INT16U budget)
+{
+  CORE_DECLARE_IRQ_STATE;
+
+  RTOS_ASSERT_DBG((budget >= 1u), RTOS_ERR_INVALID_ARG,; );
+
+  CORE_ENTER_ATOMIC();
+  NetTask_RxBudget = budget;
+  CORE_EXIT_ATOMIC();
+}
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           LOCAL FUNCTIONS
@@ -206,6 +230,35 @@ static void NetTask_SignalPend(CPU_INT32U timeout_ms,
   RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
 }
 
+/****************************************************************************************************//**
+ *                                           NetTask_SignalClr()
+ *
+ * @brief    Consume Task Signals already posted, without waiting.
+ *
+ * @param    nbr_signal  Maximum number of signals to consume.
+ *
+ * @note     (1) Each received packet posts one Task Signal.  Once a wake-up handled several packets, the
+ *               signals of all but one of them are consumed so that the task does NOT wake up again for
+ *               packets it already handled.  A signal posted later than its packet is simply left, and
+ *               costs one wake-up that finds no packet.
+ *******************************************************************************************************/
+static void NetTask_SignalClr(CPU_INT16U nbr_signal)
+{
+  RTOS_ERR local_err;
+
+  while (nbr_signal > 0u) {
+    RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
+    KAL_SemPend(NetTask_SignalHandle,
+                KAL_OPT_PEND_NON_BLOCKING,
+                0u,
+                &local_err);
+    if (RTOS_ERR_CODE_GET(local_err) != RTOS_ERR_NONE) {
+      break;
+    }
+    nbr_signal--;
+  }
+}
+
 /****************************************************************************************************//**
  *                                               NetTask_Handler()
  *
@@ -219,8 +272,8 @@ static void NetTask_SignalPend(CPU_INT32U timeout_ms,
  *                   - (3) The waiting time depends on the minimum timeout present in the Network Timer
  *                         List.
  *               - (b) Acquire network lock  (See Note #3)
- *               - (c) Handle received packet if any
- *               - (d) Handle the Network Timer List.
+ *               - (c) Handle the Network Timer List.
+ *               - (d) Handle received packets, up to the rx budget (See Note #4)
  *               - (e) Release network lock
  *
  * @param    p_data  Pointer to task initialization data.
@@ -229,13 +282,18 @@ static void NetTask_SignalPend(CPU_INT32U timeout_ms,
  *
  * @note     (3) NetTask_Handler() blocks ALL other network protocol tasks by pending on & acquiring
  *                   the global network lock (see 'net.h  Note #3').
+ *
+ * @note     (4) Received packets are handled in batches to amortize the lock, the timer list & the signal
+ *               pend over several packets (see 'net_task_priv.h  DEFINES  Note #1').
  *******************************************************************************************************/
 static void NetTask_Handler(void *p_data)
 {
   CPU_INT32U timeout_ms = 0;
-  NET_IF_NBR if_nbr = NET_IF_NBR_NONE;
-  RTOS_ERR   pend_err;
+  CPU_INT16U rx_budget;
+  CPU_INT16U rx_quota;
+  CPU_INT16U rx_ctr;
   RTOS_ERR   local_err;
+  CORE_DECLARE_IRQ_STATE;
 
   RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
 
@@ -243,14 +301,10 @@ static void NetTask_Handler(void *p_data)
 
   while (DEF_ON) {
     RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
-    RTOS_ERR_SET(pend_err, RTOS_ERR_NONE);
 
     //                                                             ----------- WAIT FOR SIGNAL TO WAKE TASK -----------
     NetTask_SignalPend(timeout_ms, &local_err);
 
-    //                                                             ------------------ CHECK FOR RX PKT ----------------
-    if_nbr = NetIF_RxQPend(&pend_err);
-
     //                                                             ----------------- ACQUIRE NET LOCK -----------------
     Net_GlobalLockAcquire((void *)NetTask_Handler);
 
@@ -268,9 +322,15 @@ static void NetTask_Handler(void *p_data)
       }
     } while (RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE);
 
-    //                                                             ------------------ HANDLE RX PKT -------------------
-    if (RTOS_ERR_CODE_GET(pend_err) == RTOS_ERR_NONE) {
-      NetIF_RxHandler(if_nbr);
+    //                                                             ------------------ HANDLE RX PKTS ------------------
+    CORE_ENTER_ATOMIC();
+    rx_budget = NetTask_RxBudget;
+    CORE_EXIT_ATOMIC();
+    rx_quota = DEF_MIN(rx_budget, NET_TASK_CFG_RX_QUOTA_IF);
+
+    rx_ctr = NetIF_RxQHandler(rx_budget, rx_quota);
+    if (rx_ctr > 1u) {
+      NetTask_SignalClr(rx_ctr - 1u);                           // Consume signals of batched pkts.
     }
 
     //                                                             ----- SET TIMEOUT VALUE TO PEND ON TASK SIGNAL -----
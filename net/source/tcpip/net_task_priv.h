@@ -34,6 +34,27 @@
 #include  <common/include/rtos_err.h>
 #include  <common/include/rtos_types.h>
 
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                               DEFINES
+ *
+ * Note(s) : (1) Each time it wakes up, the Network Task handles up to NET_TASK_CFG_RX_BUDGET received
+ *               packets under a single network lock hold, & at most NET_TASK_CFG_RX_QUOTA_IF packets per
+ *               interface so that a busy interface does NOT starve the others.  Remaining packets are
+ *               handled on the next wake-up, which follows immediately.
+ *
+ *           (2) A budget of 1 handles a single packet per wake-up.
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#ifndef  NET_TASK_CFG_RX_BUDGET
+#define  NET_TASK_CFG_RX_BUDGET                           16u   // See Note #1.
+#endif
+
+#ifndef  NET_TASK_CFG_RX_QUOTA_IF
+#define  NET_TASK_CFG_RX_QUOTA_IF                          8u   // See Note #1.
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                           FUNCTION PROTOTYPES
@@ -50,6 +71,25 @@ void NetTask_PrioSet(RTOS_TASK_PRIO prio,
 
 void NetTask_SignalPost(void);
 
+void NetTask_RxBudgetSet(CPU_INT16U budget);
+
+/********************************************************************************************************
+ ********************************************************************************************************
+ *                                           CONFIGURATION ERRORS
+ ********************************************************************************************************
+ *******************************************************************************************************/
+
+#if     (NET_TASK_CFG_RX_BUDGET < 1u)
+#error  "NET_TASK_CFG_RX_BUDGET      illegally #define'd in 'net_cfg.h'"
+#error  "                            [MUST be  >= 1]                  "
+
+#elif  ((NET_TASK_CFG_RX_QUOTA_IF < 1u) \
+  ||    (NET_TASK_CFG_RX_QUOTA_IF > NET_TASK_CFG_RX_BUDGET))
+#error  "NET_TASK_CFG_RX_QUOTA_IF    illegally #define'd in 'net_cfg.h'"
+#error  "                            [MUST be  >= 1                   ]"
+#error  "                            [     &&  <= NET_TASK_CFG_RX_BUDGET]"
+#endif
+
 /********************************************************************************************************
  ********************************************************************************************************
  *                                               MODULE END
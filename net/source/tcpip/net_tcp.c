@@ -68,6 +68,7 @@
 
 #define  NET_TCP_RX_Q_NAME               "Net TCP Rx Q signal"
 #define  NET_TCP_TX_Q_NAME               "Net TCP Tx Q signal"
+#define  NET_TCP_CONN_RX_LOCK_NAME       "Net TCP Conn Rx lock"
 
 /********************************************************************************************************
  *                               TCP CONNECTION CONFIGURATION CODE DEFINES
@@ -253,6 +254,13 @@ static CPU_BOOLEAN NetTCP_RxPktValidateOptMaxSegSize(NET_BUF_HDR *p_buf_hdr,
                                                      CPU_INT08U  *p_opt_len,
                                                      RTOS_ERR    *p_err);
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static CPU_BOOLEAN NetTCP_RxPktValidateOptWinScale(NET_BUF_HDR *p_buf_hdr,
+                                                   CPU_INT08U  *p_opt,
+                                                   CPU_INT08U  *p_opt_len,
+                                                   RTOS_ERR    *p_err);
+#endif
+
 static void NetTCP_RxPktDemuxSeg(NET_BUF     *p_buf,
                                  NET_BUF_HDR *p_buf_hdr,
                                  RTOS_ERR    *p_err);
@@ -369,8 +377,20 @@ static void NetTCP_RxConnWinSizeHandler(NET_TCP_CONN     *p_conn,
                                         CPU_INT16U       nbr_buf,
                                         NET_TCP_WIN_CODE win_update_code);
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static void NetTCP_RxConnWinScaleCfg(NET_TCP_CONN *p_conn);
+#endif
+
+static NET_TCP_WIN_SIZE NetTCP_RxConnWinSizeAdvertise(NET_TCP_CONN *p_conn,
+                                                      CPU_BOOLEAN  sync);
+
 //                                                                 --------------------- TX FNCTS ---------------------
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static void NetTCP_TxConnWinScaleCfg(NET_TCP_CONN *p_conn,
+                                     NET_BUF_HDR  *p_buf_hdr);
+#endif
+
 static void NetTCP_TxConnWinSizeCfg(NET_TCP_CONN *p_conn);
 
 static void NetTCP_TxConnWinSizeCfgCongCtrl(NET_TCP_CONN *p_conn);
@@ -417,6 +437,10 @@ static void NetTCP_TxConnSync(NET_TCP_CONN       *p_conn,
                               NET_TCP_CONN_STATE state,
                               RTOS_ERR           *p_err);
 
+static void NetTCP_TxConnSyncOptCfg(NET_TCP_CONN                 *p_conn,
+                                    NET_TCP_OPT_CFG_MAX_SEG_SIZE *p_opt_cfg_max_seg_size,
+                                    NET_TCP_OPT_CFG_WIN_SCALE    *p_opt_cfg_win_scale);
+
 static void NetTCP_TxConnClose(NET_TCP_CONN       *p_conn,
                                NET_TCP_CONN_STATE state,
                                RTOS_ERR           *p_err);
@@ -599,6 +623,13 @@ static void NetTCP_TxPktPrepareOptMaxSegSize(void       *p_opts_tcp,
                                              CPU_INT08U *p_opt_len,
                                              void       **p_opt_next);
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static void NetTCP_TxPktPrepareOptWinScale(void       *p_opts_tcp,
+                                           CPU_INT08U *p_opt_hdr,
+                                           CPU_INT08U *p_opt_len,
+                                           void       **p_opt_next);
+#endif
+
 static void NetTCP_TxPktPrepareHdr(NET_BUF          *p_buf,
                                    NET_BUF_HDR      *p_buf_hdr,
                                    CPU_INT16U       tcp_hdr_len_tot,
@@ -1695,6 +1726,16 @@ void NetTCP_Init(MEM_SEG  *p_mem_seg,
     //                                                             Initialize TCP connection transmit queue timeout values.
     NetTCP_TxQ_TimeoutDflt(i);
 
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+    //                                                             Create TCP connection receive lock.
+    p_conn->RxLock = KAL_LockCreate(NET_TCP_CONN_RX_LOCK_NAME,
+                                    DEF_NULL,
+                                    p_err);
+    if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+      goto exit;
+    }
+#endif
+
 #if (NET_DBG_CFG_MEM_CLR_EN == DEF_ENABLED)
     NetTCP_ConnClr(p_conn);
 #endif
@@ -2336,6 +2377,15 @@ exit:
  *                     application receive queue which also prevents the TCP connection from receiving
  *                     additional application data.  Thus exception handling code in the application layer
  *                     SHOULD eventually detect & close any TCP connection deadlocked due to internal errors.
+ *
+ * @note     (8) When NET_TCP_CFG_CONN_RX_LOCK_EN is enabled (see 'net_tcp_priv.h  TCP CONNECTION RECEIVE
+ *               LOCK DEFINES') :
+ *               - (a) The TCP connection receive lock is acquired with the global network lock released
+ *                     & is held until the function returns.
+ *               - (b) The queued segments are unlinked from the application receive queue & their data is
+ *                     read with the global network lock released.
+ *               - (c) If the TCP connection was freed meanwhile, the unlinked segments are freed & the
+ *                     data already read is returned.
  *******************************************************************************************************/
 CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
                             void            *p_data_buf,
@@ -2376,6 +2426,14 @@ CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
   NET_TCP_SEQ_NBR  seq_nbr_init = 0u;
   NET_TCP_SEQ_NBR  seq_nbr_ix = 0u;
   NET_BUF_QTY      buf_nbr_freed = 0u;
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  NET_BUF          *p_buf_tail = DEF_NULL;
+  NET_BUF          *p_buf_q_head = DEF_NULL;
+  NET_BUF          *p_buf_q_tail = DEF_NULL;
+  NET_BUF_HDR      *p_buf_q_tail_hdr = DEF_NULL;
+  CPU_BOOLEAN      rx_locked = DEF_NO;
+  RTOS_ERR         local_err;
+#endif
 
   RTOS_ERR_SET(*p_err, RTOS_ERR_NONE);
 
@@ -2386,8 +2444,18 @@ CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
     goto exit;
   }
 
-  //                                                               ---------------- VALIDATE TCP CONN -----------------
   p_conn = &NetTCP_ConnTbl[conn_id_tcp];
+
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  //                                                               ------------- ACQUIRE TCP CONN RX LOCK -------------
+  Net_GlobalLockRelease();                                      // See Note #8a.
+  KAL_LockAcquire(p_conn->RxLock, KAL_OPT_PEND_NONE, KAL_TIMEOUT_INFINITE, &local_err);
+  Net_GlobalLockAcquire((void *)NetTCP_RxAppData);
+  RTOS_ASSERT_CRITICAL((RTOS_ERR_CODE_GET(local_err) == RTOS_ERR_NONE), RTOS_ERR_ASSERT_CRITICAL_FAIL, 0u);
+  rx_locked = DEF_YES;                                          // Conn state re-validated below.
+#endif
+
+  //                                                               ---------------- VALIDATE TCP CONN -----------------
   q_closed = DEF_NO;
 
   switch (p_conn->ConnState) {
@@ -2489,6 +2557,15 @@ CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
   data_len_tot = 0u;
   p_buf_seg_next = DEF_NULL;
 
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  //                                                               ------------- UNLINK TCP CONN APP RX Q -------------
+  p_buf_tail = p_conn->RxQ_App_Tail;                            // See Note #8b.
+  p_conn->RxQ_App_Head = DEF_NULL;
+  p_conn->RxQ_App_Tail = DEF_NULL;
+  p_conn->RxQ_App_RdActive = DEF_YES;
+  Net_GlobalLockRelease();
+#endif
+
   while ((p_buf_seg != DEF_NULL)                                // Copy app rx data from TCP conn q'd seg(s).
          && (data_len_buf_rem > 0)       ) {
     p_buf_seg_hdr = &p_buf_seg->Hdr;
@@ -2568,6 +2645,22 @@ CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
     }
   }
 
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  //                                                               ------------- RELINK TCP CONN APP RX Q -------------
+  Net_GlobalLockAcquire((void *)NetTCP_RxAppData);
+  if (p_conn->RxQ_App_RdActive != DEF_YES) {                    // If TCP conn freed while unlocked, ...
+    if (p_buf_head != DEF_NULL) {
+      (void)NetTCP_RxPktFree(p_buf_head);                       // ... free unlinked seg(s) [see Note #8c].
+    }
+    goto exit;
+  }
+  p_conn->RxQ_App_RdActive = DEF_NO;
+  p_buf_q_head = p_conn->RxQ_App_Head;                          // Save seg(s) q'd while unlocked ...
+  p_buf_q_tail = p_conn->RxQ_App_Tail;
+  p_conn->RxQ_App_Head = p_buf_head;                            // ... & restore unlinked seg(s).
+  p_conn->RxQ_App_Tail = p_buf_tail;
+#endif
+
   q_closed_empty = ((q_closed == DEF_YES)                       // Chk rx q closed ...
                     && (data_len_tot < 1)) ? DEF_YES : DEF_NO;  // ... & empty (i.e. no rx'd data).
 
@@ -2631,6 +2724,19 @@ CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
 #endif
   }
 
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  if (p_buf_q_head != DEF_NULL) {                               // Append seg(s) q'd while unlocked to app rx Q.
+    if (p_conn->RxQ_App_Tail != DEF_NULL) {
+      p_buf_q_tail_hdr = &p_conn->RxQ_App_Tail->Hdr;
+      p_buf_q_tail_hdr->NextPrimListPtr = p_buf_q_head;
+      p_buf_q_head->Hdr.PrevPrimListPtr = p_conn->RxQ_App_Tail;
+    } else {
+      p_conn->RxQ_App_Head = p_buf_q_head;
+    }
+    p_conn->RxQ_App_Tail = p_buf_q_tail;
+  }
+#endif
+
   if (q_closed_empty == DEF_YES) {                              // If rx q closed & empty,                       ..
     if (p_conn->ConnState == NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL) {
       //                                                           .. close data-avail TCP conn (see Note #2e3A) ..
@@ -2647,6 +2753,11 @@ CPU_INT16U NetTCP_RxAppData(NET_TCP_CONN_ID conn_id_tcp,
 #endif
 
 exit:
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  if (rx_locked == DEF_YES) {
+    KAL_LockRelease(p_conn->RxLock, &local_err);
+  }
+#endif
   return (data_len_tot);
 }
 
@@ -3625,7 +3736,7 @@ CPU_BOOLEAN NetTCP_ConnIsAvailRx(NET_TCP_CONN_ID conn_id_tcp,
     case NET_TCP_CONN_STATE_FIN_WAIT_1:
     case NET_TCP_CONN_STATE_FIN_WAIT_2:
       //                                                           Chk TCP conn rx data avail (see Note #2c).
-      rx_avail = (p_conn->RxQ_App_Head != DEF_NULL) ? DEF_YES : DEF_NO;
+      rx_avail = (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_NO) ? DEF_YES : DEF_NO;
       break;
 
     case NET_TCP_CONN_STATE_CLOSE_WAIT:                         // See Note #2d.
@@ -3634,9 +3745,9 @@ CPU_BOOLEAN NetTCP_ConnIsAvailRx(NET_TCP_CONN_ID conn_id_tcp,
     case NET_TCP_CONN_STATE_LAST_ACK:
     case NET_TCP_CONN_STATE_CLOSING_DATA_AVAIL:
       //                                                           Chk TCP conn rx data avail (see Note #2d) OR ...
-      rx_avail = ((p_conn->RxQ_App_Head != DEF_NULL)
+      rx_avail = ((NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_NO)
                   ||                                            // ... TCP conn rx q closed   (see Note #2e2A).
-                  ((p_conn->RxQ_App_Head == DEF_NULL)
+                  ((NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES)
                    && (p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSED))) ? DEF_YES : DEF_NO;
       break;
 
@@ -5170,7 +5281,7 @@ static void NetTCP_RxPktValidate(NET_BUF     *p_buf,
   //                                                               See Notes #1c & #3.
   NET_UTIL_VAL_COPY_GET_NET_32(&p_buf_hdr->TCP_SeqNbr, &p_tcp_hdr->SeqNbr);
   NET_UTIL_VAL_COPY_GET_NET_32(&p_buf_hdr->TCP_AckNbr, &p_tcp_hdr->AckNbr);
-  NET_UTIL_VAL_COPY_GET_NET_16(&p_buf_hdr->TCP_WinSize, &p_tcp_hdr->WinSize);
+  p_buf_hdr->TCP_WinSize = NET_UTIL_VAL_GET_NET_16(&p_tcp_hdr->WinSize);
 
   p_buf_hdr->TransportHdrLen = tcp_hdr_len_tot;
   tcp_data_len = tcp_tot_len - p_buf_hdr->TransportHdrLen;
@@ -5276,6 +5387,9 @@ static void NetTCP_RxPktValidateOpt(NET_BUF_HDR *p_buf_hdr,
   CPU_INT08U  opt_list_len_rem;
   CPU_INT08U  opt_len;
   CPU_INT08U  opt_nbr_max_seg_size;
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  CPU_INT08U  opt_nbr_win_scale;
+#endif
   CPU_BOOLEAN opt_list_end;
 
   opt_list_len_size = tcp_hdr_len_size - NET_TCP_HDR_SIZE_MIN;  // Calc opt list len size.
@@ -5296,6 +5410,9 @@ static void NetTCP_RxPktValidateOpt(NET_BUF_HDR *p_buf_hdr,
   //                                                               ------------- DECODE/VALIDATE TCP OPTS -------------
   opt_list_end = DEF_NO;
   opt_nbr_max_seg_size = 0u;
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  opt_nbr_win_scale = 0u;
+#endif
 
   p_opts = (CPU_INT08U *)&p_tcp_hdr->Opts[0];
   opt_list_len_rem = opt_list_len_size;
@@ -5336,9 +5453,32 @@ static void NetTCP_RxPktValidateOpt(NET_BUF_HDR *p_buf_hdr,
           goto exit;
         }
         break;
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+      case NET_TCP_HDR_OPT_WIN_SCALE:                           // ------------------ WIN SCALE OPT -------------------
+        if (opt_list_end != DEF_NO) {                           // If opt found AFTER end of opt list, rtn err.
+          NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+          RTOS_ERR_SET(*p_err, RTOS_ERR_RX);
+          goto exit;
+        }
+        if (opt_nbr_win_scale > 0) {                            // If > 1 win scale opt,               rtn err.
+          NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+          RTOS_ERR_SET(*p_err, RTOS_ERR_RX);
+          goto exit;
+        }
+        opt_nbr_win_scale++;
+
+        (void)NetTCP_RxPktValidateOptWinScale(p_buf_hdr, p_opts, &opt_len, p_err);
+        if (RTOS_ERR_CODE_GET(*p_err) != RTOS_ERR_NONE) {
+          goto exit;
+        }
+        break;
+#endif
       //                                                           --------------- UNSUPPORTED TCP OPTS ---------------
       //                                                           See Notes #1b & #2b2.
+#if (NET_TCP_CFG_WIN_SCALE_EN != DEF_ENABLED)
       case NET_TCP_HDR_OPT_WIN_SCALE:
+#endif
       case NET_TCP_HDR_OPT_SACK_PERMIT:
       case NET_TCP_HDR_OPT_SACK:
       case NET_TCP_HDR_OPT_ECHO_REQ:
@@ -5432,6 +5572,67 @@ exit:
   return (rtn_val);
 }
 
+/****************************************************************************************************//**
+ *                                   NetTCP_RxPktValidateOptWinScale()
+ *
+ * @brief    Validate & process received TCP Window Scale option.
+ *
+ * @param    p_buf_hdr   Pointer to network buffer header that received TCP packet.
+ *
+ * @param    p_opt       Pointer to Window Scale option.
+ *
+ * @param    p_opt_len   Pointer to variable that will receive the TCP option length (in octets).
+ *
+ * @param    p_err       Pointer to variable that will receive the return error code from this function.
+ *
+ * @return   DEF_OK, If Window Scale option is validated sucessfully.
+ *           DEF_FAIL,  otherwise.
+ *
+ * @note     (1) See 'net_tcp_priv.h  TCP WINDOW SIZE DEFINES  Note #2' for TCP Window Scale option
+ *               summary.
+ *
+ * @note     (2) (a) RFC #7323, Section 2.2 states that a Window Scale option "in a segment without a
+ *                   SYN bit MUST be ignored".
+ *
+ *           - (b) RFC #7323, Section 2.3 states that if a shift count "greater than 14 is received,
+ *                   the TCP SHOULD log the error but MUST use 14 instead of the specified value".
+ *******************************************************************************************************/
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static CPU_BOOLEAN NetTCP_RxPktValidateOptWinScale(NET_BUF_HDR *p_buf_hdr,
+                                                   CPU_INT08U  *p_opt,
+                                                   CPU_INT08U  *p_opt_len,
+                                                   RTOS_ERR    *p_err)
+{
+  CPU_INT08U  win_scale;
+  CPU_BOOLEAN rtn_val = DEF_FAIL;
+
+  *p_opt_len = NET_TCP_HDR_OPT_LEN_WIN_SCALE;
+
+  p_opt++;
+  if (*p_opt != *p_opt_len) {                                   // If opt len != win scale opt len, rtn err.
+    NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+    RTOS_ERR_SET(*p_err, RTOS_ERR_RX);
+    goto exit;
+  }
+
+  if (p_buf_hdr->TCP_SegSync == DEF_YES) {                      // Ignore opt in non-sync segs (see Note #2a).
+    p_opt++;
+    win_scale = *p_opt;
+    if (win_scale > NET_TCP_WIN_SCALE_MAX) {                    // Lim shift cnt to max (see Note #2b).
+      NET_CTR_ERR_INC(Net_ErrCtrs.TCP.RxHdrOptsCtr);
+      win_scale = NET_TCP_WIN_SCALE_MAX;
+    }
+
+    p_buf_hdr->TCP_WinScale = win_scale;
+  }
+
+  rtn_val = DEF_OK;
+
+exit:
+  return (rtn_val);
+}
+#endif
+
 /****************************************************************************************************//**
  *                                           NetTCP_RxPktDemuxSeg()
  *
@@ -5617,6 +5818,12 @@ exit:
  *                           - (c) "Some systems have not implemented half-closed connections."
  *
  * @note     (4) Network buffer already freed by lower layer/handler function(s).
+ *
+ * @note     (5) RFC #7323, Section 2.3 states that "the Window field in a segment where the SYN bit is
+ *               set (i.e., a <SYN> or <SYN,ACK>) MUST NOT be scaled".  All other received window sizes
+ *               are scaled by the shift count advertised by the remote host, so that ALL connection
+ *               state handlers see unscaled window sizes (see 'net_tcp_priv.h  TCP WINDOW SIZE
+ *               DEFINES  Note #2').
  *******************************************************************************************************/
 static void NetTCP_RxPktConnHandler(NET_BUF     *p_buf,
                                     NET_BUF_HDR *p_buf_hdr,
@@ -5637,9 +5844,17 @@ static void NetTCP_RxPktConnHandler(NET_BUF     *p_buf,
     goto exit;
   }
 
-  //                                                               ------------ DEMUX TCP PKT TO TCP CONN -------------
   p_conn = &NetTCP_ConnTbl[conn_id_tcp];
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  //                                                               ---------------- SCALE RX'D WIN SIZE ---------------
+  if ((p_conn->WinScaleEn == DEF_YES)                           // If win scale negotiated ...
+      && (p_buf_hdr->TCP_SegSync == DEF_NO)) {                  // ... & NOT a sync seg,   ...
+    p_buf_hdr->TCP_WinSize <<= p_conn->TxWinScale;              // ... scale rx'd win size (see Note #5).
+  }
+#endif
+
+  //                                                               ------------ DEMUX TCP PKT TO TCP CONN -------------
   switch (p_conn->ConnState) {
     case NET_TCP_CONN_STATE_LISTEN:
       rx_status = NetTCP_RxPktConnHandlerListen(p_conn, p_buf, p_buf_hdr, p_err);
@@ -6051,6 +6266,9 @@ exit:
  *
  * @note     (8) TCP connection timeout for LISTEN state is implemented by TCP connection retransmission
  *                       function(s) (see 'NetTCP_TxConnReTxQ()  Note #3c').
+ *
+ * @note     (9) Window scaling is enabled for the connection ONLY if the received sync segment carries a
+ *               Window Scale option (see 'NetTCP_TxConnWinScaleCfg()  Note #1').
  *******************************************************************************************************/
 static NET_TCP_STATUS NetTCP_RxPktConnHandlerListen(NET_TCP_CONN *p_conn,
                                                     NET_BUF      *p_buf,
@@ -6304,6 +6522,10 @@ static NET_TCP_STATUS NetTCP_RxPktConnHandlerListen(NET_TCP_CONN *p_conn,
                                      ?  p_buf_hdr->TCP_MaxSegSize
                                      :  mss_dflt_tx;
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  NetTCP_TxConnWinScaleCfg(p_conn_tx_sync, p_buf_hdr);          // Cfg remote win scale (see Note #9).
+#endif
+
   state = p_conn_tx_sync->ConnState;
   p_conn_tx_sync->ConnState = NET_TCP_CONN_STATE_SYNC_RXD_PASSIVE;
 
@@ -6837,6 +7059,9 @@ exit:
  * @note     (5) Some  transitory errors were ignored &/or not returned from previous handler function(s).
  *                       These transitory errors are included for completeness & as an extra precaution in case
  *                       these transitory errors are returned by handler function(s).
+ *
+ * @note     (6) Window scaling remains enabled ONLY if the received sync segment also carries a Window
+ *               Scale option (see 'NetTCP_TxConnWinScaleCfg()  Note #1').
  *******************************************************************************************************/
 static NET_TCP_STATUS NetTCP_RxPktConnHandlerSyncTxd(NET_TCP_CONN *p_conn,
                                                      NET_BUF      *p_buf,
@@ -6924,6 +7149,10 @@ static NET_TCP_STATUS NetTCP_RxPktConnHandlerSyncTxd(NET_TCP_CONN *p_conn,
                              ?  p_buf_hdr->TCP_MaxSegSize
                              :  mss_dflt_tx;
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  NetTCP_TxConnWinScaleCfg(p_conn, p_buf_hdr);                  // Cfg remote win scale (see Note #6).
+#endif
+
   //                                                               ----------------- HANDLE RX'D SEG ------------------
   rtn_status = NetTCP_RxPktConnHandlerSeg(p_conn, ack_code, p_buf, p_buf_hdr, p_err);
   switch (RTOS_ERR_CODE_GET(*p_err)) {
@@ -7855,7 +8084,7 @@ static NET_TCP_STATUS NetTCP_RxPktConnHandlerFinWait1(NET_TCP_CONN *p_conn,
     //                                                             Closing data avail for half-closed conns ONLY.
     data_avail = ((p_conn->ConnCloseCode != NET_CONN_CLOSE_HALF)
                   || ((p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSED)
-                      && (p_conn->RxQ_App_Head == DEF_NULL))) ? DEF_NO : DEF_YES;
+                      && (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES))) ? DEF_NO : DEF_YES;
 
     //                                                             ... signal app conn close (see Note #2d2B2b1);   ...
     NetTCP_RxPktConnHandlerSignalClose(p_conn, data_avail, p_err);
@@ -8384,7 +8613,7 @@ static NET_TCP_STATUS NetTCP_RxPktConnHandlerFinWait2(NET_TCP_CONN *p_conn,
                                                                 // Closing data avail for half-closed conns ONLY.
     data_avail = ((p_conn->ConnCloseCode != NET_CONN_CLOSE_HALF)
                   || ((p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSED)
-                      && (p_conn->RxQ_App_Head == DEF_NULL))) ? DEF_NO : DEF_YES;
+                      && (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES))) ? DEF_NO : DEF_YES;
 
     if (data_avail != DEF_YES) {                                // ... & NO app data avail,                         ...
                                                                 // ... chng to time-wait state (see Note  #2f5B1);  ...
@@ -8852,7 +9081,7 @@ static NET_TCP_STATUS NetTCP_RxPktConnHandlerClosing(NET_TCP_CONN *p_conn,
     //                                                             Closing data avail for half-closed conns ONLY.
     data_avail = ((p_conn->ConnCloseCode != NET_CONN_CLOSE_HALF)
                   || ((p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSED)
-                      && (p_conn->RxQ_App_Head == DEF_NULL))) ? DEF_NO : DEF_YES;
+                      && (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES))) ? DEF_NO : DEF_YES;
 
     //                                                             .. signal app conn close (see Note #2d2B2a2B),    ..
     NetTCP_RxPktConnHandlerSignalClose(p_conn, data_avail, p_err);
@@ -9982,7 +10211,7 @@ static NET_TCP_STATUS NetTCP_RxPktConnHandlerLastAck(NET_TCP_CONN *p_conn,
     //                                                             Closing data avail for half-closed conns ONLY.
     data_avail = ((p_conn->ConnCloseCode != NET_CONN_CLOSE_HALF)
                   || ((p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSED)
-                      && (p_conn->RxQ_App_Head == DEF_NULL))) ? DEF_NO : DEF_YES;
+                      && (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES))) ? DEF_NO : DEF_YES;
     //                                                             ... signal app conn close (see Note #2d2A2b1);  ...
     //                                                             Ignore any app conn close err(s) [see Note #4].
     RTOS_ERR_SET(local_err, RTOS_ERR_NONE);
@@ -11201,7 +11430,7 @@ static void NetTCP_RxPktConnHandlerRxQ_AppData(NET_TCP_CONN *p_conn)
     }
   } else {                                                      // ----------------- CHK RX WIN SIZE ------------------
     if (p_conn->RxWinSizeActual < 1) {                          // If avail rx win size zero  (see Note #6b2A)  ...
-      if (p_conn->RxQ_App_Head == DEF_NULL) {                   // ... & NO avail app rx data (see Note #6b2B); ...
+      if (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES) {  // ... & NO avail app rx data (see Note #6b2B); ...
                                                                 // ... inc rx win size (see Note #6b).
         p_buf = p_conn->RxQ_Transport_Tail;
         if (p_buf != DEF_NULL) {                                // If transport rx Q NOT empty;              ...
@@ -13413,6 +13642,107 @@ static void NetTCP_RxConnWinSizeHandler(NET_TCP_CONN     *p_conn,
   }
 }
 
+/****************************************************************************************************//**
+ *                                       NetTCP_RxConnWinScaleCfg()
+ *
+ * @brief    Configure TCP connection's receive window scale shift count.
+ *
+ * @param    p_conn  Pointer to TCP connection.
+ *
+ * @note     (1) RFC #7323, Section 2.2 states that the shift count "is chosen ... based upon the
+ *               maximum receive buffer space", & Section 2.3 limits it to 14 (see 'net_tcp_priv.h
+ *               TCP WINDOW SIZE DEFINES  Note #2').
+ *
+ *               The smallest shift count able to advertise the configured receive window size is
+ *               chosen, so that window sizes lose as little precision as possible.
+ *******************************************************************************************************/
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static void NetTCP_RxConnWinScaleCfg(NET_TCP_CONN *p_conn)
+{
+  CPU_INT08U win_scale;
+
+  win_scale = 0u;
+  while ((win_scale < NET_TCP_WIN_SCALE_MAX)                    // Calc min shift cnt for cfg'd rx win (see Note #1).
+         && ((p_conn->RxWinSizeCfgd >> win_scale) > NET_TCP_WIN_SIZE_HDR_MAX)) {
+    win_scale++;
+  }
+
+  p_conn->RxWinScale = win_scale;
+}
+#endif
+
+/****************************************************************************************************//**
+ *                                       NetTCP_RxConnWinSizeAdvertise()
+ *
+ * @brief    Get TCP connection's receive window size to advertise in a transmitted TCP header.
+ *
+ * @param    p_conn  Pointer to TCP connection.
+ *
+ * @param    sync    Indicate whether the window size is for a sync segment :
+ *
+ *                       - DEF_YES   Window size for a sync segment (see Note #1a).
+ *                       - DEF_NO    Window size for any other segment.
+ *
+ * @return   Receive window size to advertise, in header window field units.
+ *
+ * @note     (1) RFC #7323, Section 2.3 states that :
+ *
+ *           - (a) "The Window field in a SYN (i.e., a <SYN> or <SYN,ACK>) segment itself is never
+ *                   scaled."
+ *
+ *           - (b) All other advertised window sizes are right-shifted by the local shift count.
+ *                   Shifted window sizes are rounded down so that the remote host is NEVER allowed
+ *                   to transmit beyond the actual receive window.
+ *******************************************************************************************************/
+static NET_TCP_WIN_SIZE NetTCP_RxConnWinSizeAdvertise(NET_TCP_CONN *p_conn,
+                                                      CPU_BOOLEAN  sync)
+{
+  NET_TCP_WIN_SIZE win_size;
+
+  win_size = p_conn->RxWinSizeActual;
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  if ((p_conn->WinScaleEn == DEF_YES)                           // If win scale negotiated ...
+      && (sync == DEF_NO)) {                                    // ... & NOT a sync seg,   ...
+    win_size >>= p_conn->RxWinScale;                            // ... scale win size (see Note #1b).
+  }
+#else
+  PP_UNUSED_PARAM(sync);
+#endif
+
+  win_size = DEF_MIN(win_size, NET_TCP_WIN_SIZE_HDR_MAX);       // Lim to hdr win field (see Note #1a).
+
+  return (win_size);
+}
+
+/****************************************************************************************************//**
+ *                                       NetTCP_TxConnWinScaleCfg()
+ *
+ * @brief    Configure TCP connection's transmit window scale shift count from a received sync segment.
+ *
+ * @param    p_conn      Pointer to TCP connection.
+ *
+ * @param    p_buf_hdr   Pointer to received sync segment's network buffer header.
+ *
+ * @note     (1) RFC #7323, Section 2.2 states that "if a Window Scale option is received with a
+ *               SYN ... but was not sent" ... "or if a Window Scale option was sent ... but not
+ *               received, then window scaling is disabled" in both directions & the connection
+ *               "MUST use shift counts of zero".
+ *******************************************************************************************************/
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static void NetTCP_TxConnWinScaleCfg(NET_TCP_CONN *p_conn,
+                                     NET_BUF_HDR  *p_buf_hdr)
+{
+  if ((p_conn->WinScaleEn == DEF_YES)                           // If win scale en'd        ...
+      && (p_buf_hdr->TCP_WinScale != NET_TCP_WIN_SCALE_NONE)) { // ... & rx'd from remote host, ...
+    p_conn->TxWinScale = p_buf_hdr->TCP_WinScale;               // ... cfg remote shift cnt.
+  } else {                                                      // Else dis win scale (see Note #1).
+    p_conn->WinScaleEn = DEF_NO;
+    p_conn->RxWinScale = 0u;
+    p_conn->TxWinScale = 0u;
+  }
+}
+#endif
+
 /****************************************************************************************************//**
  *                                           NetTCP_TxConnWinSizeCfg()
  *
@@ -14963,6 +15293,12 @@ static void NetTCP_TxConnWinSizeZeroWinTimeout(void *p_conn_timeout)
  *                       See also 'NetTCP_RxPktConnHandlerSyncTxd()  Note #2c3B2'.
  *
  * @note     (7) IP transmit options currently NOT implemented      See 'net_tcp.h  Note #1d'
+ *
+ * @note     (8) (a) The receive window scale shift count is chosen once, for the first synchronization
+ *                   segment transmitted on the connection (see 'NetTCP_RxConnWinScaleCfg()  Note #1').
+ *
+ *           - (b) A Window Scale option is transmitted in a <SYN,ACK> segment ONLY if one was received
+ *                   in the <SYN> segment (see 'net_tcp_priv.h  TCP WINDOW SIZE DEFINES  Note #2a').
  *******************************************************************************************************/
 static void NetTCP_TxConnSync(NET_TCP_CONN       *p_conn,
                               NET_BUF_HDR        *p_buf_hdr,
@@ -15000,6 +15336,7 @@ static void NetTCP_TxConnSync(NET_TCP_CONN       *p_conn,
   NET_PROTOCOL_TYPE            protocol;
   NET_TCP_OPT_CFG_MAX_SEG_SIZE *p_opt_cfg_max_seg_size;
   NET_TCP_OPT_CFG_MAX_SEG_SIZE opt_cfg_max_seg_size;
+  NET_TCP_OPT_CFG_WIN_SCALE    opt_cfg_win_scale;
   NET_TCP_FLAGS                flags_tcp;
   NET_PROTOCOL_TYPE            proto_type = NET_PROTOCOL_TYPE_NONE;
 
@@ -15033,7 +15370,7 @@ static void NetTCP_TxConnSync(NET_TCP_CONN       *p_conn,
 
   data_ix = 0u;
 
-  NetTCP_GetTxDataIx(if_nbr, proto_type, 4u, data_len, p_conn, &data_ix);
+  NetTCP_GetTxDataIx(if_nbr, proto_type, NET_TCP_HDR_OPT_LEN_SYNC, data_len, p_conn, &data_ix);
 
   p_seg_sync = NetBuf_Get(if_nbr,
                           NET_TRANSACTION_TX,
@@ -15121,8 +15458,14 @@ static void NetTCP_TxConnSync(NET_TCP_CONN       *p_conn,
     DEF_BIT_SET(flags_tcp, NET_TCP_FLAG_TX_ACK);                // ... tx ACK.
   }
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  if ((p_conn->WinScaleEn == DEF_YES)                           // If win scale en'd for first sync seg, ...
+      && (state != NET_TCP_CONN_STATE_SYNC_TXD)) {
+    NetTCP_RxConnWinScaleCfg(p_conn);                           // ... cfg rx win scale (see Note #8a).
+  }
+#endif
   //                                                               Prepare TCP rx win size.
-  win_size = p_conn->RxWinSizeActual;
+  win_size = NetTCP_RxConnWinSizeAdvertise(p_conn, DEF_YES);
 
   //                                                               Prepare TCP max seg size opt (see Note #4).
   //                                                               Get IF's MTU's.
@@ -15135,10 +15478,8 @@ static void NetTCP_TxConnSync(NET_TCP_CONN       *p_conn,
   //                                                               Calc TCP conn's local max seg size.
   p_conn->MaxSegSizeLocalActual = NetIF_GetPayloadRxMax(if_nbr, protocol);
 
-  p_opt_cfg_max_seg_size = &opt_cfg_max_seg_size;
-  p_opt_cfg_max_seg_size->Type = NET_TCP_OPT_TYPE_MAX_SEG_SIZE;
-  p_opt_cfg_max_seg_size->MaxSegSize = p_conn->MaxSegSizeLocalActual;
-  p_opt_cfg_max_seg_size->NextOptPtr = DEF_NULL;
+  p_opt_cfg_max_seg_size = &opt_cfg_max_seg_size;               // Prepare TCP win scale opt (see Note #8b).
+  NetTCP_TxConnSyncOptCfg(p_conn, p_opt_cfg_max_seg_size, &opt_cfg_win_scale);
 
   if (DEF_BIT_IS_CLR(p_seg_sync_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
 #ifdef  NET_IPv4_MODULE_EN
@@ -15276,6 +15617,38 @@ exit:
   return;
 }
 
+/****************************************************************************************************//**
+ *                                       NetTCP_TxConnSyncOptCfg()
+ *
+ * @brief    Configure TCP options for a TCP connection synchronization segment.
+ *
+ * @param    p_conn                  Pointer to a TCP connection.
+ *
+ * @param    p_opt_cfg_max_seg_size  Pointer to TCP Maximum Segment Size option configuration to prepare;
+ *                                   head of the returned TCP option configuration list.
+ *
+ * @param    p_opt_cfg_win_scale     Pointer to TCP Window Scale       option configuration to prepare.
+ *
+ * @note     (1) The Window Scale option is linked ONLY while window scaling is enabled for the
+ *               connection (see 'NetTCP_TxConnSync()  Note #8b').
+ *******************************************************************************************************/
+static void NetTCP_TxConnSyncOptCfg(NET_TCP_CONN                 *p_conn,
+                                    NET_TCP_OPT_CFG_MAX_SEG_SIZE *p_opt_cfg_max_seg_size,
+                                    NET_TCP_OPT_CFG_WIN_SCALE    *p_opt_cfg_win_scale)
+{
+  p_opt_cfg_max_seg_size->Type = NET_TCP_OPT_TYPE_MAX_SEG_SIZE;
+  p_opt_cfg_max_seg_size->MaxSegSize = p_conn->MaxSegSizeLocalActual;
+  p_opt_cfg_max_seg_size->NextOptPtr = DEF_NULL;
+
+  p_opt_cfg_win_scale->Type = NET_TCP_OPT_TYPE_WIN_SCALE;
+  p_opt_cfg_win_scale->WinScale = p_conn->RxWinScale;
+  p_opt_cfg_win_scale->NextOptPtr = DEF_NULL;
+
+  if (p_conn->WinScaleEn == DEF_YES) {                          // If win scale en'd, link win scale opt (see Note #1).
+    p_opt_cfg_max_seg_size->NextOptPtr = p_opt_cfg_win_scale;
+  }
+}
+
 /****************************************************************************************************//**
  *                                           NetTCP_TxConnClose()
  *
@@ -16262,7 +16635,7 @@ static NET_TCP_ACK_STATUS NetTCP_TxConnAck(NET_TCP_CONN       *p_conn,
               | NET_TCP_FLAG_TX_ACK;
 
   //                                                               Prepare TCP win size.
-  win_size = p_conn->RxWinSizeActual;
+  win_size = NetTCP_RxConnWinSizeAdvertise(p_conn, DEF_NO);
 
   //                                                               Prepare IP params (see Note #9).
   if (is_ipv6 == DEF_NO) {
@@ -17383,7 +17756,7 @@ static void NetTCP_TxConnProbe(NET_TCP_CONN       *p_conn,
               | NET_TCP_FLAG_TX_ACK;
 
   //                                                               Prepare TCP win size.
-  win_size = p_conn->RxWinSizeActual;
+  win_size = NetTCP_RxConnWinSizeAdvertise(p_conn, DEF_NO);
 
   //                                                               Prepare IP params.
   if (DEF_BIT_IS_CLR(p_seg_probe_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
@@ -18502,7 +18875,7 @@ static void NetTCP_TxConnTxQ(NET_TCP_CONN       *p_conn,
       flags_tcp = p_seg_hdr->TCP_Flags;
 
       //                                                           Prepare TCP win size.
-      win_size = p_conn->RxWinSizeActual;
+      win_size = NetTCP_RxConnWinSizeAdvertise(p_conn, DEF_NO);
 
       //                                                           Prepare IP params (see Note #9a).
 
@@ -19587,6 +19960,10 @@ exit:
  *
  *                               See also 'NetTCP_TxConnAppData()  Note #10'
  *                               & 'NetTCP_TxConnTxQ()      Note #14'.
+ *
+ * @note     (12) An updated synchronization segment is re-prepared with its synchronization options so
+ *                that the Maximum Segment Size & Window Scale options are NOT lost on re-transmit (see
+ *                'NetTCP_TxConnSync()  Note #8').
  *******************************************************************************************************/
 static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
                                CPU_BOOLEAN        re_tx_q_timeout,
@@ -19629,6 +20006,7 @@ static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
   NET_BUF_SIZE      data_ix_re_tx;
   NET_BUF_SIZE      data_len_cur;
   NET_TCP_FLAGS     flags_tcp;
+  void              *p_opts_tcp = DEF_NULL;
   CPU_INT08U        *pdata_re_tx;
   CPU_BOOLEAN       seg_chngd;
   CPU_BOOLEAN       seg_updated;
@@ -19637,6 +20015,9 @@ static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
   NET_PROTOCOL_TYPE proto_type = NET_PROTOCOL_TYPE_NONE;
   RTOS_ERR          local_err;
 
+  NET_TCP_OPT_CFG_MAX_SEG_SIZE opt_cfg_max_seg_size;
+  NET_TCP_OPT_CFG_WIN_SCALE    opt_cfg_win_scale;
+
   //                                                               ----------------- VALIDATE RE-TX Q -----------------
   if (p_conn->ReTxQ_Head == DEF_NULL) {
     goto exit;
@@ -19701,7 +20082,7 @@ static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
 
   seg_len = p_seg_hdr->TCP_SegLen;
   //                                                               Prepare TCP win size.
-  win_size = p_conn->RxWinSizeActual;
+  win_size = NetTCP_RxConnWinSizeAdvertise(p_conn, p_seg_hdr->TCP_SegSync);
 
   //                                                               Chk for re-tx seg update (see Note #7).
   seg_updated = ((p_seg_hdr->TCP_SeqNbrLast != seq_nbr)
@@ -19796,6 +20177,12 @@ static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
     //                                                             Prepare TCP tx flags.
     flags_tcp = p_seg_hdr->TCP_Flags;
 
+    //                                                             Prepare TCP opts (see Note #12).
+    if (p_seg_hdr->TCP_SegSync == DEF_YES) {
+      NetTCP_TxConnSyncOptCfg(p_conn, &opt_cfg_max_seg_size, &opt_cfg_win_scale);
+      p_opts_tcp = &opt_cfg_max_seg_size;
+    }
+
     //                                                             Prepare IP params.
     if (DEF_BIT_IS_CLR(p_seg_hdr->Flags, NET_BUF_FLAG_IPv6_FRAME)) {
 #ifdef  NET_IPv4_MODULE_EN
@@ -19848,7 +20235,7 @@ static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
                               TTL,
                               flags_tcp,
                               flags_ipv4,
-                              DEF_NULL,
+                              p_opts_tcp,
                               DEF_NULL,
                               p_err);
     }
@@ -19872,7 +20259,7 @@ static void NetTCP_TxConnReTxQ(NET_TCP_CONN       *p_conn,
                               flow_label,
                               hop_lim,
                               flags_tcp,
-                              DEF_NULL,
+                              p_opts_tcp,
                               p_err);
     }
 #endif
@@ -21507,6 +21894,7 @@ exit:
  *
  * @param    ---------   NULL                            NO  TCP transmit         options configuration.
  *                               NET_TCP_OPT_CFG_MAX_SEG_SIZE    TCP Maximum Segment Size options configuration.
+ *                               NET_TCP_OPT_CFG_WIN_SCALE       TCP Window Scale         options configuration.
  *
  * @param    p_opt_hdr   Pointer to TCP transmit option buffer to prepare TCP options.
  *
@@ -21546,9 +21934,17 @@ static CPU_INT08U NetTCP_TxPktPrepareOpt(void       *p_opts_tcp,
       case NET_TCP_OPT_TYPE_MAX_SEG_SIZE:
         NetTCP_TxPktPrepareOptMaxSegSize(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next);
         break;
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+      case NET_TCP_OPT_TYPE_WIN_SCALE:
+        NetTCP_TxPktPrepareOptWinScale(p_opt_cfg, p_opt_cfg_hdr, &tcp_opt_len, &p_opt_next);
+        break;
+#endif
       //                                                           --------------- UNSUPPORTED TCP OPTS ---------------
       //                                                           See Note #3b.
+#if (NET_TCP_CFG_WIN_SCALE_EN != DEF_ENABLED)
       case NET_TCP_OPT_TYPE_WIN_SCALE:
+#endif
       case NET_TCP_OPT_TYPE_SACK_PERMIT:
       case NET_TCP_OPT_TYPE_SACK:
       case NET_TCP_OPT_TYPE_ECHO_REQ:
@@ -21657,6 +22053,58 @@ static void NetTCP_TxPktPrepareOptMaxSegSize(void       *p_opts_tcp,
   *p_opt_next = p_opt_cfg_max_seg_size->NextOptPtr;
 }
 
+/****************************************************************************************************//**
+ *                                   NetTCP_TxPktPrepareOptWinScale()
+ *
+ * @brief    (1) Prepare TCP header with TCP Window Scale option :
+ *
+ *           - (a) Prepare TCP Window Scale option
+ *           - (b) Return option values
+ *
+ * @param    p_opts_tcp  Pointer to TCP Window Scale option configuration data structure.
+ *
+ * @param    p_opt_hdr   Pointer to TCP transmit option buffer to prepare TCP Window Scale option.
+ *
+ * @param    p_opt_len   Pointer to variable that will receive the returned TCP option length (in octets).
+ *
+ * @param    p_opt_next  Pointer to variable that will receive the pointer to the next TCP transmit option.
+ *
+ * @note     (2) See 'net_tcp_priv.h  TCP WINDOW SIZE DEFINES  Note #2' for TCP Window Scale option
+ *               summary.
+ *
+ * @note     (3) RFC #7323, Appendix A recommends preceding the 3-octet Window Scale option with a
+ *               No-Operation option so that the following options remain aligned on word boundaries.
+ *******************************************************************************************************/
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+static void NetTCP_TxPktPrepareOptWinScale(void       *p_opts_tcp,
+                                           CPU_INT08U *p_opt_hdr,
+                                           CPU_INT08U *p_opt_len,
+                                           void       **p_opt_next)
+{
+  NET_TCP_OPT_CFG_WIN_SCALE *p_opt_cfg_win_scale;
+  CPU_INT08U                *p_opt_cfg_hdr;
+
+  //                                                               --------------- PREPARE WIN SCALE OPT --------------
+  p_opt_cfg_win_scale = (NET_TCP_OPT_CFG_WIN_SCALE *)p_opts_tcp;
+  p_opt_cfg_hdr = p_opt_hdr;
+
+  *p_opt_cfg_hdr = NET_TCP_HDR_OPT_NOP;                         // Prepare NOP (see Note #3).
+  p_opt_cfg_hdr++;
+
+  *p_opt_cfg_hdr = NET_TCP_HDR_OPT_WIN_SCALE;                   // Prepare opt type.
+  p_opt_cfg_hdr++;
+
+  *p_opt_cfg_hdr = NET_TCP_HDR_OPT_LEN_WIN_SCALE;               // Prepare opt len.
+  p_opt_cfg_hdr++;
+
+  *p_opt_cfg_hdr = p_opt_cfg_win_scale->WinScale;               // Prepare win scale shift cnt.
+
+  //                                                               ------------------- RTN OPT VALS -------------------
+  *p_opt_len = NET_TCP_HDR_OPT_LEN_NOP + NET_TCP_HDR_OPT_LEN_WIN_SCALE;
+  *p_opt_next = p_opt_cfg_win_scale->NextOptPtr;
+}
+#endif
+
 /****************************************************************************************************//**
  *                                           NetTCP_TxPktPrepareHdr()
  *
@@ -21824,7 +22272,7 @@ static void NetTCP_TxPktPrepareHdr(NET_BUF          *p_buf,
   NET_UTIL_VAL_COPY_SET_NET_16(&p_tcp_hdr->HdrLen_Flags, &tcp_hdr_len_flags);
 
   //                                                               ----------------- PREPARE TCP WIN ------------------
-  NET_UTIL_VAL_COPY_SET_NET_16(&p_tcp_hdr->WinSize, &win_size);
+  NET_UTIL_VAL_SET_NET_16(&p_tcp_hdr->WinSize, (CPU_INT16U)win_size);
 
   //                                                               -------------- PREPARE TCP URGENT PTR --------------
   //                                                               See Note #2.
@@ -22529,7 +22977,7 @@ static void NetTCP_ConnClosingTimeoutDataAvail(void *p_conn_timeout)
   //                                                               Closing data avail for half-closed conns ONLY.
   data_avail = ((p_conn->ConnCloseCode != NET_CONN_CLOSE_HALF)
                 || ((p_conn->RxQ_State == NET_TCP_RX_Q_STATE_CLOSED)
-                    && (p_conn->RxQ_App_Head == DEF_NULL))) ? DEF_NO : DEF_YES;
+                    && (NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn) == DEF_YES))) ? DEF_NO : DEF_YES;
 
   if (data_avail != DEF_YES) {                                  // If NO app data avail, ...
                                                                 // ... close TCP conn  (see Note  #1a).
@@ -22807,11 +23255,22 @@ static void NetTCP_ConnClr(NET_TCP_CONN *p_conn)
   p_conn->RxWinSizeUpdateTh = NET_TCP_WIN_SIZE_NONE;               // See Note #1b1.
 #endif
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+  p_conn->WinScaleEn = DEF_YES;                                 // Win scale negotiated on conn sync.
+#else
+  p_conn->WinScaleEn = DEF_NO;
+#endif
+  p_conn->RxWinScale = 0u;
+  p_conn->TxWinScale = 0u;
+
   p_conn->RxQ_State = NET_TCP_RX_Q_STATE_CLOSED;
   p_conn->RxQ_Transport_Head = DEF_NULL;
   p_conn->RxQ_Transport_Tail = DEF_NULL;
   p_conn->RxQ_App_Head = DEF_NULL;
   p_conn->RxQ_App_Tail = DEF_NULL;
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  p_conn->RxQ_App_RdActive = DEF_NO;                            // Signals a pending app rd that conn was freed.
+#endif
 
   p_conn->TxSeqNbrSync = NET_TCP_SEQ_NBR_NONE;
   p_conn->TxSeqNbrNext = NET_TCP_SEQ_NBR_NONE;
@@ -76,6 +76,44 @@
 #define  NET_TCP_CFG_NBR_CONN                           0u
 #endif
 
+#ifndef  NET_TCP_CFG_WIN_SCALE_EN
+#define  NET_TCP_CFG_WIN_SCALE_EN                       DEF_ENABLED
+#endif
+
+/********************************************************************************************************
+ *                                   TCP CONNECTION RECEIVE LOCK DEFINES
+ *
+ * Note(s) : (1) When NET_TCP_CFG_CONN_RX_LOCK_EN is enabled, each TCP connection has its own receive
+ *               lock, held by the application task receiving from the connection. The global network
+ *               lock is then only held to validate the connection & unlink its queued segments, & again
+ *               to free the consumed segments & queue the remaining ones back. Data is copied to the
+ *               application with only the connection lock held, so the Network Task & the other
+ *               connections are NOT blocked for the length of the copy.
+ *
+ *           (2) A connection lock is always acquired with the global network lock released & the
+ *               Network Task never acquires one, so that the two locks cannot deadlock.
+ *
+ *           (3) While its segments are unlinked from the application receive queue :
+ *               - (a) Segments received meanwhile are queued to the emptied queue; the unlinked segments
+ *                     are queued back ahead of them.
+ *               - (b) The queue is NOT considered empty (see NET_TCP_CONN_RX_Q_APP_IS_EMPTY()), so that
+ *                     a received close keeps the data of a half-closed connection available.
+ *               - (c) If the connection is freed, the receiving task frees the unlinked segments.
+ *
+ *           (4) Transmit still copies application data under the global network lock.
+ *******************************************************************************************************/
+
+#ifndef  NET_TCP_CFG_CONN_RX_LOCK_EN
+#define  NET_TCP_CFG_CONN_RX_LOCK_EN                    DEF_DISABLED
+#endif
+
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)                // See Note #3b.
+#define  NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn)        (((p_conn)->RxQ_App_Head == DEF_NULL) \
+                                                        && ((p_conn)->RxQ_App_RdActive != DEF_YES))
+#else
+#define  NET_TCP_CONN_RX_Q_APP_IS_EMPTY(p_conn)         ((p_conn)->RxQ_App_Head == DEF_NULL)
+#endif
+
 #define  NET_TCP_NBR_CONN                              (NET_TCP_CFG_NBR_CONN         \
                                                         + NET_SOCK_CFG_SOCK_NBR_TCP  \
                                                         + (NET_SOCK_CFG_SOCK_NBR_TCP \
@@ -312,12 +350,33 @@
  *               RFC #793, Section 3.7 'Data Communication : Managing the Window' states that for "the
  *               window ... there is an assumption that this is related to the currently available data
  *               buffer space available for this connection".
+ *
+ *           (2) (a) RFC #7323, Section 2.2 states that the Window Scale option carries a shift count
+ *                   applied to the 16-bit window field of every segment EXCEPT <SYN> segments, & that
+ *                   the option "MAY be sent in an initial <SYN> segment" & "MAY be sent in a <SYN,ACK>
+ *                   segment only if a Window Scale option was received in the initial <SYN> segment".
+ *
+ *               (b) RFC #7323, Section 2.3 limits the shift count to 14, so the largest window that may
+ *                   be advertised is 65535 << 14 octets.
+ *
+ *               (c) When NET_TCP_CFG_WIN_SCALE_EN is DEF_DISABLED, window sizes remain limited to the
+ *                   16-bit header window field.
  *******************************************************************************************************/
 
 #define  NET_TCP_WIN_SIZE_NONE                             0
 
 #define  NET_TCP_WIN_SIZE_MIN                            NET_TCP_MAX_SEG_SIZE_MIN
-#define  NET_TCP_WIN_SIZE_MAX                            DEF_INT_16U_MAX_VAL
+
+#define  NET_TCP_WIN_SIZE_HDR_MAX                        DEF_INT_16U_MAX_VAL
+
+#define  NET_TCP_WIN_SCALE_NONE                          DEF_INT_08U_MAX_VAL
+#define  NET_TCP_WIN_SCALE_MAX                            14u            // See Note #2b.
+
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)
+#define  NET_TCP_WIN_SIZE_MAX                          (NET_TCP_WIN_SIZE_HDR_MAX << NET_TCP_WIN_SCALE_MAX)
+#else
+#define  NET_TCP_WIN_SIZE_MAX                            NET_TCP_WIN_SIZE_HDR_MAX
+#endif
 
 /********************************************************************************************************
  *                                       TCP HEADER OPTIONS DEFINES
@@ -363,7 +422,8 @@
  *                                                                   RFC #1122, Section 4.2.2.6;
  *                                                                   RFC # 879, Section 3
  *
- *                   (2) TYPE =  3   Window  Scale               See 'net_tcp.h  Note #1c1'
+ *                   (2) TYPE =  3   Window  Scale               See RFC #7323, Section 2.2;
+ *                                                                   'TCP WINDOW SIZE DEFINES  Note #2'
  *                   (3) TYPE =  4   SACK Allowed                See 'net_tcp.h  Note #1c2'
  *                   (4) TYPE =  5   SACK Option                 See 'net_tcp.h  Note #1c2'
  *                   (5) TYPE =  6   Echo Request                See 'net_tcp.h  Note #1c3'
@@ -406,6 +466,14 @@
 #define  NET_TCP_HDR_OPT_LEN_SACK_MIN                      6
 #define  NET_TCP_HDR_OPT_LEN_SACK_MAX                     38
 
+#if (NET_TCP_CFG_WIN_SCALE_EN == DEF_ENABLED)                   // Sync seg opts: max seg size & NOP + win scale.
+#define  NET_TCP_HDR_OPT_LEN_SYNC                        (NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE \
+                                                          + NET_TCP_HDR_OPT_LEN_NOP        \
+                                                          + NET_TCP_HDR_OPT_LEN_WIN_SCALE)
+#else                                                           // Sync seg opts: max seg size.
+#define  NET_TCP_HDR_OPT_LEN_SYNC                         NET_TCP_HDR_OPT_LEN_MAX_SEG_SIZE
+#endif
+
 #define  NET_TCP_HDR_OPT_LEN_MIN                           1
 #define  NET_TCP_HDR_OPT_LEN_MIN_LEN                       2
 #define  NET_TCP_HDR_OPT_LEN_MAX                          38
@@ -431,7 +499,7 @@ typedef  CPU_INT32U NET_TCP_OPT_SIZE;                           // TCP opt size
 typedef  enum  net_tcp_opt_type {
   NET_TCP_OPT_TYPE_NONE,
   NET_TCP_OPT_TYPE_MAX_SEG_SIZE,
-  NET_TCP_OPT_TYPE_WIN_SCALE,                               // See 'net_tcp.h  Note #1c1'.
+  NET_TCP_OPT_TYPE_WIN_SCALE,
   NET_TCP_OPT_TYPE_SACK_PERMIT,                             // See 'net_tcp.h  Note #1c2'.
   NET_TCP_OPT_TYPE_SACK,                                    // See 'net_tcp.h  Note #1c2'.
   NET_TCP_OPT_TYPE_ECHO_REQ,                                // See 'net_tcp.h  Note #1c3'.
@@ -1189,7 +1257,7 @@ typedef  CPU_INT16U NET_TCP_SEG_SIZE;
  *******************************************************************************************************/
 
 #if 0                                                           // See Note #1.
-typedef  CPU_INT16U NET_TCP_WIN_SIZE;
+typedef  CPU_INT32U NET_TCP_WIN_SIZE;
 #endif
 
 /********************************************************************************************************
@@ -1300,6 +1368,9 @@ typedef  CPU_INT16U NET_TCP_HDR_FLAGS;
  *                                           '1' - Connection Close               requested
  *
  *           (3) Urgent pointer & data NOT supported (see 'net_tcp.h  Note #1b').
+ *
+ *           (4) The header window field is ALWAYS 16 bits; 'NET_TCP_WIN_SIZE' values are scaled to & from
+ *               this field (see 'TCP WINDOW SIZE DEFINES  Note #2').
  *******************************************************************************************************/
 
 //                                                                 ------------------- NET TCP HDR --------------------
@@ -1309,7 +1380,7 @@ typedef  struct  net_tcp_hdr {
   NET_TCP_SEQ_NBR   SeqNbr;                                     // TCP seg  seq  nbr.
   NET_TCP_SEQ_NBR   AckNbr;                                     // TCP seg  ack  nbr.
   NET_TCP_HDR_FLAGS HdrLen_Flags;                               // TCP seg  hdr  len/flags (see Note #2).
-  NET_TCP_WIN_SIZE  WinSize;                                    // TCP conn win size.
+  CPU_INT16U        WinSize;                                    // TCP conn win size (see Note #4).
   NET_CHK_SUM       ChkSum;                                     // TCP seg  chk sum.
   CPU_INT16U        UrgentPtr;                                  // TCP seg  urgent ptr     (see Note #3).
   NET_TCP_OPT_SIZE  Opts[NET_TCP_HDR_OPT_NBR_MAX];              // TCP seg  opts (if any).
@@ -1344,6 +1415,16 @@ typedef  struct  net_tcp_opt_cfg_max_seg_size {
   void             *NextOptPtr;                                 // Ptr to next TCP opt cfg.
 } NET_TCP_OPT_CFG_MAX_SEG_SIZE;
 
+/********************************************************************************************************
+ *                           TCP WINDOW SCALE OPTION CONFIGURATION DATA TYPE
+ *******************************************************************************************************/
+
+typedef  struct  net_tcp_opt_cfg_win_scale {
+  NET_TCP_OPT_TYPE Type;
+  CPU_INT08U       WinScale;                                    // TCP win scale shift cnt.
+  void             *NextOptPtr;                                 // Ptr to next TCP opt cfg.
+} NET_TCP_OPT_CFG_WIN_SCALE;
+
 /********************************************************************************************************
  *                                   APP CALLBACK FUNCTION DATA TYPE
  *******************************************************************************************************/
@@ -1412,6 +1493,10 @@ struct  net_tcp_conn {
 
   NET_TCP_WIN_SIZE                   RxWinSizeUpdateTh;                 // Rx win size update th (rx silly win ctrl).
 
+  CPU_BOOLEAN                        WinScaleEn;                        // Win scale opt en'd/negotiated for conn.
+  CPU_INT08U                         RxWinScale;                        // Rx win scale shift cnt advertised to remote host.
+  CPU_INT08U                         TxWinScale;                        // Tx win scale shift cnt advertised by remote host.
+
   NET_TCP_RX_Q_STATE                 RxQ_State;                         // Rx Q state.
 
   KAL_SEM_HANDLE                     RxQ_SignalObj;
@@ -1422,6 +1507,10 @@ struct  net_tcp_conn {
 
   NET_BUF                            *RxQ_App_Head;                     // Head of app data  rx Q to q TCP pkts until app rd(s).
   NET_BUF                            *RxQ_App_Tail;                     // Tail of app data  rx Q to q TCP pkts until app rd(s).
+#if (NET_TCP_CFG_CONN_RX_LOCK_EN == DEF_ENABLED)
+  KAL_LOCK_HANDLE                    RxLock;                            // App rx lock.
+  CPU_BOOLEAN                        RxQ_App_RdActive;                  // App rx Q segs unlinked by an app rd.
+#endif
 
   NET_TCP_SEQ_NBR                    TxSeqNbrSync;                      // Sync  tx seq nbr.
   NET_TCP_SEQ_NBR                    TxSeqNbrNext;                      // Next  tx seq nbr.
@@ -1756,6 +1845,20 @@ CPU_INT32U NetTCP_TxQ_TimeoutGet_ms(NET_TCP_CONN_ID conn_id_tcp);
 #error  "                                         [     &&  <= NET_TCP_CONN_NBR_MAX]"
 #endif
 
+#if    ((NET_TCP_CFG_WIN_SCALE_EN != DEF_DISABLED) \
+  && (NET_TCP_CFG_WIN_SCALE_EN != DEF_ENABLED))
+#error  "NET_TCP_CFG_WIN_SCALE_EN             illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  DEF_DISABLED]"
+#error  "                                         [     ||  DEF_ENABLED ]"
+#endif
+
+#if    ((NET_TCP_CFG_CONN_RX_LOCK_EN != DEF_DISABLED) \
+  && (NET_TCP_CFG_CONN_RX_LOCK_EN != DEF_ENABLED))
+#error  "NET_TCP_CFG_CONN_RX_LOCK_EN          illegally #define'd in 'net_cfg.h'"
+#error  "                                         [MUST be  DEF_DISABLED]"
+#error  "                                         [     ||  DEF_ENABLED ]"
+#endif
+
 #ifndef  NET_TCP_DFLT_RX_WIN_SIZE_OCTET
 #error  "NET_TCP_DFLT_RX_WIN_SIZE_OCTET                  not #define'd in 'net_cfg.h'"
 #error  "                                         [MUST be  >= NET_TCP_WIN_SIZE_MIN]"
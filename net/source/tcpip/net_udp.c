@@ -298,7 +298,9 @@ exit:
  * @return   Total application data octets deframed into receive buffer, if NO error(s).
  *           0, otherwise.
  *
- * @note     (2) NetUDP_RxAppData() MUST be called with the global network lock already acquired.
+ * @note     (2) NetUDP_RxAppData() MUST be called with the global network lock already acquired, unless
+ *               the packet buffer(s) are no longer queued & NET_UDP_FLAG_RX_DATA_PEEK is set (see
+ *               'net_sock_priv.h  NETWORK SOCKET DATAGRAM COPY DEFINES  Note #2a').
  *
  * @note     (4) (a) Application data receive buffer should be large enough to receive either ...
  *               - (1) The maximum UDP datagram size (i.e. 65,507 octets)
@@ -562,6 +564,12 @@ CPU_INT16U NetUDP_RxAppData(NET_BUF       *p_buf,
  **           - (b) 'data_len' of 0 octets NOT allowed.
  *
  * @note     (6) On ANY transmit error, any remaining application data transmit is immediately aborted.
+ *
+ * @note     (7) If NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN is enabled, the global network lock is
+ *               released while the application data is copied into the transmit buffer (see
+ *               'net_sock_priv.h  NETWORK SOCKET DATAGRAM COPY DEFINES  Note #1'). The interface of
+ *               the source address is checked again once the lock is re-acquired (see 'net_sock_priv.h
+ *               NETWORK SOCKET DATAGRAM COPY DEFINES  Note #2b').
  *******************************************************************************************************/
 #ifdef  NET_IPv4_MODULE_EN
 CPU_INT16U NetUDP_TxAppDataHandlerIPv4(NET_IF_NBR     if_nbr,
@@ -588,6 +596,9 @@ CPU_INT16U NetUDP_TxAppDataHandlerIPv4(NET_IF_NBR     if_nbr,
   NET_BUF_SIZE data_len_pkt;
   CPU_INT16U   data_len_tot = 0u;
   CPU_INT08U   *p_data_pkt;
+#if (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED)
+  NET_IF_NBR   if_nbr_src;
+#endif
 
   //                                                               ---------------- VALIDATE ARGUMENTS ----------------
   RTOS_ASSERT_DBG_ERR_SET((p_data != DEF_NULL), *p_err, RTOS_ERR_NULL_PTR, 0u);
@@ -643,10 +654,21 @@ CPU_INT16U NetUDP_TxAppDataHandlerIPv4(NET_IF_NBR     if_nbr,
   }
 
   data_ix_pkt += data_ix_pkt_offset;
+#if (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED)
+  if_nbr_src = NetIPv4_GetAddrHostIF_Nbr(src_addr);
+  Net_GlobalLockRelease();                                      // Copy app data w/o lock (see Note #7).
+#endif
   NetBuf_DataWr(p_buf,                             // Wr app data into app data tx buf.
                 data_ix_pkt,
                 data_len_pkt,
                 p_data_pkt);
+#if (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED)
+  Net_GlobalLockAcquire((void *)NetUDP_TxAppDataHandlerIPv4);
+  if (NetIPv4_GetAddrHostIF_Nbr(src_addr) != if_nbr_src) {      // Discard if src addr changed meanwhile.
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NET_INVALID_ADDR_SRC);
+    goto exit_discard;
+  }
+#endif
 
   //                                                               Init app data tx buf ctrls.
   p_buf_hdr = &p_buf->Hdr;
@@ -744,6 +766,12 @@ exit:
  *           - (b) 'data_len' of 0 octets NOT allowed.
  *
  * @note     (5) On ANY transmit error, any remaining application data transmit is immediately aborted.
+ *
+ * @note     (6) If NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN is enabled, the global network lock is
+ *               released while the application data is copied into the transmit buffer (see
+ *               'net_sock_priv.h  NETWORK SOCKET DATAGRAM COPY DEFINES  Note #1'). The interface of
+ *               the source address is checked again once the lock is re-acquired (see 'net_sock_priv.h
+ *               NETWORK SOCKET DATAGRAM COPY DEFINES  Note #2b').
  *******************************************************************************************************/
 #ifdef  NET_IPv6_MODULE_EN
 CPU_INT16U NetUDP_TxAppDataHandlerIPv6(void                   *p_data,
@@ -816,10 +844,20 @@ CPU_INT16U NetUDP_TxAppDataHandlerIPv6(void                   *p_data,
   }
 
   data_ix_pkt += data_ix_pkt_offset;
+#if (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED)
+  Net_GlobalLockRelease();                                      // Copy app data w/o lock (see Note #6).
+#endif
   NetBuf_DataWr(p_buf,                                          // Wr app data into app data tx buf.
                 data_ix_pkt,
                 data_len_pkt,
                 p_data_pkt);
+#if (NET_SOCK_CFG_DATAGRAM_COPY_UNLOCKED_EN == DEF_ENABLED)
+  Net_GlobalLockAcquire((void *)NetUDP_TxAppDataHandlerIPv6);
+  if (NetIPv6_GetAddrHostIF_Nbr(p_src_addr) != if_nbr) {        // Discard if src addr changed meanwhile.
+    RTOS_ERR_SET(*p_err, RTOS_ERR_NET_INVALID_ADDR_SRC);
+    goto exit_discard;
+  }
+#endif
 
   //                                                               Init app data tx buf ctrls.
   p_buf_hdr = &p_buf->Hdr;
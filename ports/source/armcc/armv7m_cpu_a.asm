@@ -30,6 +30,7 @@
         EXPORT  CPU_CntLeadZeros
         EXPORT  CPU_CntTrailZeros
         EXPORT  CPU_RevBits
+        EXPORT  CPU_CmpSwap
 
 
 ;********************************************************************************************************
@@ -173,6 +174,57 @@ CPU_RevBits
         BX      LR
 
 
+;********************************************************************************************************
+;                                           CPU_CmpSwap()
+;                                         COMPARE AND SWAP
+;
+; Description : Atomically replaces the content of a CPU address-sized word with a new value if, and
+;                   only if, it is equal to an expected value.
+;
+; Prototype   : CPU_BOOLEAN  CPU_CmpSwap(CPU_ADDR  *p_dest,
+;                                        CPU_ADDR   cmp_val,
+;                                        CPU_ADDR   new_val);
+;
+; Argument(s) : p_dest      Pointer to the word to update.
+;
+;               cmp_val     Value expected in '*p_dest'.
+;
+;               new_val     Value to store in '*p_dest' if it equals 'cmp_val'.
+;
+; Return(s)   : DEF_YES, if '*p_dest' was equal to 'cmp_val' and was replaced by 'new_val'.
+;
+;               DEF_NO,  otherwise.
+;
+; Caller(s)   : Application.
+;
+;               This function is an INTERNAL CPU module function but MAY be called by application
+;               function(s).
+;
+; Note(s)     : (1) The exclusive monitor is cleared on exception entry and return, so a reservation
+;                   interrupted by an ISR or a context switch makes STREX fail and the sequence is
+;                   retried.
+;
+;               (2) MUST be defined in 'cpu_a.asm' (or 'cpu_c.c') if CPU_CFG_CMP_SWAP_ASM_PRESENT is
+;                   #define'd in 'cpu_port.h'.
+;********************************************************************************************************
+
+CPU_CmpSwap
+        LDREX   R3, [R0]                        ; Load word & set exclusive reservation
+        CMP     R3, R1                          ; Does it hold the expected value?
+        BNE     CPU_CmpSwap_Fail
+        STREX   R3, R2, [R0]                    ; Yes, try to store new value
+        CMP     R3, #0
+        BNE     CPU_CmpSwap                     ; Reservation lost, retry (see Note #1)
+        DMB
+        MOVS    R0, #1                          ; Return DEF_YES
+        BX      LR
+
+CPU_CmpSwap_Fail
+        CLREX                                   ; Drop the reservation
+        MOVS    R0, #0                          ; Return DEF_NO
+        BX      LR
+
+
 ;********************************************************************************************************
 ;                                     CPU ASSEMBLY PORT FILE END
 ;********************************************************************************************************
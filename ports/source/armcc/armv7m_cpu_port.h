@@ -225,6 +225,20 @@ typedef CPU_ADDR CPU_STK_SIZE;                                  // Defines CPU s
 
 #define  CPU_CFG_REVERSE_BIT_ASM_PRESENT
 
+/********************************************************************************************************
+ *                                     CPU COMPARE AND SWAP CONFIGURATION
+ *
+ * @note     (1) Configure CPU_CFG_CMP_SWAP_ASM_PRESENT to define the compare-and-swap function in :
+ *
+ *               (a) 'cpu_a.asm',  if CPU_CFG_CMP_SWAP_ASM_PRESENT       #define'd in 'cpu_port.h'
+ *                                     to enable the exclusive load/store implementation
+ *
+ *               (b) 'cpu_core.c', if CPU_CFG_CMP_SWAP_ASM_PRESENT   NOT #define'd in 'cpu_port.h'
+ *                                     to enable the critical section implementation otherwise
+ *******************************************************************************************************/
+
+#define  CPU_CFG_CMP_SWAP_ASM_PRESENT
+
 /********************************************************************************************************
  *                                               CPU_BREAK()
  *
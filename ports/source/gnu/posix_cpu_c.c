@@ -446,6 +446,42 @@ CPU_DATA CPU_CntTrailZeros(CPU_DATA val)
 }
 #endif
 
+/****************************************************************************************************//**
+ *                                               CPU_CmpSwap()
+ *
+ * @brief    Atomically replace a CPU address-sized word if it holds an expected value.
+ *
+ * @param    p_dest      Pointer to the word to update.
+ *
+ * @param    cmp_val     Value expected in '*p_dest'.
+ *
+ * @param    new_val     Value to store in '*p_dest' if it equals 'cmp_val'.
+ *
+ * @return   DEF_YES, if '*p_dest' was replaced by 'new_val',
+ *           DEF_NO,  otherwise.
+ *
+ * @note     (1) MUST be implemented in cpu_c.c if and only if CPU_CFG_CMP_SWAP_ASM_PRESENT is
+ *               #define'd in 'cpu_port.h'.
+ *******************************************************************************************************/
+
+#ifdef  CPU_CFG_CMP_SWAP_ASM_PRESENT
+CPU_BOOLEAN CPU_CmpSwap(CPU_ADDR *p_dest,
+                        CPU_ADDR cmp_val,
+                        CPU_ADDR new_val)
+{
+  if (__atomic_compare_exchange_n(p_dest,
+                                  &cmp_val,
+                                  new_val,
+                                  0,
+                                  __ATOMIC_ACQ_REL,
+                                  __ATOMIC_ACQUIRE) != 0) {
+    return (DEF_YES);
+  }
+
+  return (DEF_NO);
+}
+#endif
+
 /****************************************************************************************************//**
  *                                               CPU_TS_TmrInit()
  *
@@ -221,6 +221,16 @@ typedef CPU_ADDR CPU_STK_SIZE;                                  // Defines CPU s
 #define  CPU_RMB()
 #define  CPU_WMB()
 
+/********************************************************************************************************
+ *                                     CPU COMPARE AND SWAP CONFIGURATION
+ *
+ * Note(s) : (1) CPU_CmpSwap() is implemented in 'posix_cpu_c.c' with the compiler's atomic builtins.
+ *               The critical section fallback in 'cpu_core.c' would cost a signal mask change on
+ *               every call.
+ *******************************************************************************************************/
+
+#define  CPU_CFG_CMP_SWAP_ASM_PRESENT
+
 /********************************************************************************************************
  *                                           FUNCTION PROTOTYPES
  *******************************************************************************************************/
@@ -38,6 +38,7 @@ const CPU_CHAR *os_cpu_c__c = "$Id: $";
 #include  <em_core.h>
 
 #include  <kernel/include/os.h>
+#include  <kernel/source/os_priv.h>
 
 #include  <common/include/rtos_path.h>
 #include  <os_cfg.h>
@@ -320,6 +321,8 @@ void OSTaskSwHook(void)
   }
 #endif
 
+  OS_TRACE_TASK_SWITCHED_IN(OSTCBHighRdyPtr);
+
 #if OS_CFG_SCHED_LOCK_TIME_MEAS_EN > 0u
   //                                                               Keep track of per-task scheduler lock time
   if (OSTCBCurPtr->SchedLockTimeMax < (CPU_TS)OSSchedLockTimeMaxCur) {